@@ -6,29 +6,39 @@
 
 namespace duckdb {
 
+//	The moments only differ in how they finalize the state, so they share the state callbacks.
+//	This lets window functions over the same input share a single segment tree.
+template <class OP>
+static AggregateFunction GetMomentFunction() {
+	auto function =
+	    AggregateFunction::UnaryAggregate<StddevState, double, double, OP>(LogicalType::DOUBLE, LogicalType::DOUBLE);
+	auto moments = AggregateFunction::UnaryAggregate<StddevState, double, double, VarSampOperation>(
+	    LogicalType::DOUBLE, LogicalType::DOUBLE);
+	function.initialize = moments.initialize;
+	function.update = moments.update;
+	function.simple_update = moments.simple_update;
+	function.combine = moments.combine;
+	return function;
+}
+
 AggregateFunction StdDevSampFun::GetFunction() {
-	return AggregateFunction::UnaryAggregate<StddevState, double, double, STDDevSampOperation>(LogicalType::DOUBLE,
-	                                                                                           LogicalType::DOUBLE);
+	return GetMomentFunction<STDDevSampOperation>();
 }
 
 AggregateFunction StdDevPopFun::GetFunction() {
-	return AggregateFunction::UnaryAggregate<StddevState, double, double, STDDevPopOperation>(LogicalType::DOUBLE,
-	                                                                                          LogicalType::DOUBLE);
+	return GetMomentFunction<STDDevPopOperation>();
 }
 
 AggregateFunction VarPopFun::GetFunction() {
-	return AggregateFunction::UnaryAggregate<StddevState, double, double, VarPopOperation>(LogicalType::DOUBLE,
-	                                                                                       LogicalType::DOUBLE);
+	return GetMomentFunction<VarPopOperation>();
 }
 
 AggregateFunction VarSampFun::GetFunction() {
-	return AggregateFunction::UnaryAggregate<StddevState, double, double, VarSampOperation>(LogicalType::DOUBLE,
-	                                                                                        LogicalType::DOUBLE);
+	return GetMomentFunction<VarSampOperation>();
 }
 
 AggregateFunction StandardErrorOfTheMeanFun::GetFunction() {
-	return AggregateFunction::UnaryAggregate<StddevState, double, double, StandardErrorOfTheMeanOperation>(
-	    LogicalType::DOUBLE, LogicalType::DOUBLE);
+	return GetMomentFunction<StandardErrorOfTheMeanOperation>();
 }
 
 } // namespace duckdb
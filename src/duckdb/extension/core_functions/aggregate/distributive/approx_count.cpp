@@ -96,4 +96,88 @@ AggregateFunction ApproxCountDistinctFun::GetFunction() {
 	return GetApproxCountDistinctFunction(LogicalType::ANY);
 }
 
+//===--------------------------------------------------------------------===//
+// Persisted sketches
+//===--------------------------------------------------------------------===//
+struct HLLStateFunction : public ApproxCountDistinctFunction {
+	template <class T, class STATE>
+	static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data) {
+		target = StringVector::EmptyString(finalize_data.result, HyperLogLog::BLOB_SIZE);
+		state.hll.ToBlob(data_ptr_cast(target.GetDataWriteable()));
+		target.Finalize();
+	}
+};
+
+static void HLLMergeSimpleUpdateFunction(Vector inputs[], AggregateInputData &, idx_t input_count,
+                                         data_ptr_t state, idx_t count) {
+	D_ASSERT(input_count == 1);
+	UnifiedVectorFormat idata;
+	inputs[0].ToUnifiedFormat(count, idata);
+	const auto sketches = UnifiedVectorFormat::GetData<string_t>(idata);
+
+	auto &hll = reinterpret_cast<ApproxDistinctCountState *>(state)->hll;
+	if (inputs[0].GetVectorType() == VectorType::CONSTANT_VECTOR) {
+		// merging the same sketch again does not change the result
+		count = 1;
+	}
+	for (idx_t i = 0; i < count; i++) {
+		const auto idx = idata.sel->get_index(i);
+		if (idata.validity.RowIsValid(idx)) {
+			hll.MergeBlob(const_data_ptr_cast(sketches[idx].GetData()), sketches[idx].GetSize());
+		}
+	}
+}
+
+static void HLLMergeUpdateFunction(Vector inputs[], AggregateInputData &, idx_t input_count, Vector &state_vector,
+                                   idx_t count) {
+	D_ASSERT(input_count == 1);
+	UnifiedVectorFormat idata;
+	inputs[0].ToUnifiedFormat(count, idata);
+	const auto sketches = UnifiedVectorFormat::GetData<string_t>(idata);
+
+	UnifiedVectorFormat sdata;
+	state_vector.ToUnifiedFormat(count, sdata);
+	const auto states = UnifiedVectorFormat::GetDataNoConst<ApproxDistinctCountState *>(sdata);
+	for (idx_t i = 0; i < count; i++) {
+		const auto idx = idata.sel->get_index(i);
+		if (idata.validity.RowIsValid(idx)) {
+			auto &hll = states[sdata.sel->get_index(i)]->hll;
+			hll.MergeBlob(const_data_ptr_cast(sketches[idx].GetData()), sketches[idx].GetSize());
+		}
+	}
+}
+
+AggregateFunction HllStateFun::GetFunction() {
+	auto fun = AggregateFunction(
+	    {LogicalType::ANY}, LogicalType::BLOB, AggregateFunction::StateSize<ApproxDistinctCountState>,
+	    AggregateFunction::StateInitialize<ApproxDistinctCountState, HLLStateFunction>,
+	    ApproxCountDistinctUpdateFunction, AggregateFunction::StateCombine<ApproxDistinctCountState, HLLStateFunction>,
+	    AggregateFunction::StateFinalize<ApproxDistinctCountState, string_t, HLLStateFunction>,
+	    ApproxCountDistinctSimpleUpdateFunction);
+	fun.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+	return fun;
+}
+
+AggregateFunction HllMergeFun::GetFunction() {
+	auto fun = AggregateFunction(
+	    {LogicalType::BLOB}, LogicalType::BLOB, AggregateFunction::StateSize<ApproxDistinctCountState>,
+	    AggregateFunction::StateInitialize<ApproxDistinctCountState, HLLStateFunction>, HLLMergeUpdateFunction,
+	    AggregateFunction::StateCombine<ApproxDistinctCountState, HLLStateFunction>,
+	    AggregateFunction::StateFinalize<ApproxDistinctCountState, string_t, HLLStateFunction>,
+	    HLLMergeSimpleUpdateFunction);
+	fun.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+	return fun;
+}
+
+AggregateFunction HllCountFun::GetFunction() {
+	auto fun = AggregateFunction(
+	    {LogicalType::BLOB}, LogicalTypeId::BIGINT, AggregateFunction::StateSize<ApproxDistinctCountState>,
+	    AggregateFunction::StateInitialize<ApproxDistinctCountState, ApproxCountDistinctFunction>,
+	    HLLMergeUpdateFunction, AggregateFunction::StateCombine<ApproxDistinctCountState, ApproxCountDistinctFunction>,
+	    AggregateFunction::StateFinalize<ApproxDistinctCountState, int64_t, ApproxCountDistinctFunction>,
+	    HLLMergeSimpleUpdateFunction);
+	fun.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+	return fun;
+}
+
 } // namespace duckdb
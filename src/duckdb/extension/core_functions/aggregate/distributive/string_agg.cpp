@@ -14,6 +14,8 @@ struct StringAggState {
 	idx_t size;
 	idx_t alloc_size;
 	char *dataptr;
+	//! Whether the buffer lives in the arena of a spilling hash table (otherwise it is owned by the state)
+	bool arena_owned;
 };
 
 struct StringAggBindData : public FunctionData {
@@ -37,6 +39,7 @@ struct StringAggFunction {
 		state.dataptr = nullptr;
 		state.alloc_size = 0;
 		state.size = 0;
+		state.arena_owned = false;
 	}
 
 	template <class T, class STATE>
@@ -50,21 +53,54 @@ struct StringAggFunction {
 
 	template <class STATE>
 	static void Destroy(STATE &state, AggregateInputData &aggr_input_data) {
-		if (state.dataptr) {
+		if (state.dataptr && !state.arena_owned) {
 			delete[] state.dataptr;
 		}
 	}
 
+	template <class STATE>
+	static void SerializeState(STATE &state, Serializer &serializer, AggregateInputData &) {
+		serializer.WriteProperty<bool>(100, "is_set", state.dataptr != nullptr);
+		serializer.WriteProperty<idx_t>(101, "size", state.size);
+		serializer.WriteProperty(102, "data", const_data_ptr_cast(state.dataptr), state.size);
+	}
+
+	template <class STATE>
+	static void DeserializeState(STATE &state, Deserializer &deserializer, AggregateInputData &aggr_input_data) {
+		D_ASSERT(!state.dataptr);
+		const auto is_set = deserializer.ReadProperty<bool>(100, "is_set");
+		const auto size = deserializer.ReadProperty<idx_t>(101, "size");
+		if (is_set) {
+			state.alloc_size = MaxValue<idx_t>(8, NextPowerOfTwo(size));
+			state.arena_owned = aggr_input_data.spillable;
+			state.dataptr = AllocateBuffer(state, aggr_input_data.allocator);
+			state.size = size;
+		}
+		deserializer.ReadProperty(102, "data", data_ptr_cast(state.dataptr), size);
+	}
+
 	static bool IgnoreNull() {
 		return true;
 	}
 
-	static inline void PerformOperation(StringAggState &state, const char *str, const char *sep, idx_t str_size,
-	                                    idx_t sep_size) {
+	//! Allocates a buffer of "alloc_size" bytes: from the arena if the state is spillable, else on the heap
+	static inline char *AllocateBuffer(const StringAggState &state, ArenaAllocator &allocator) {
+		if (state.arena_owned) {
+			return char_ptr_cast(allocator.Allocate(state.alloc_size));
+		}
+		return new char[state.alloc_size];
+	}
+
+	static inline void PerformOperation(StringAggState &state, AggregateInputData &aggr_input_data, const char *str,
+	                                    const char *sep, idx_t str_size, idx_t sep_size) {
 		if (!state.dataptr) {
 			// first iteration: allocate space for the string and copy it into the state
+			// a spilling hash table keeps the buffers in its arena, so that they count towards its memory usage and
+			// are released when it resets the arena after spilling. Other callers (e.g., windowed aggregates, whose
+			// arena is not reset within a partition) keep them on the heap, and release them in Destroy
 			state.alloc_size = MaxValue<idx_t>(8, NextPowerOfTwo(str_size));
-			state.dataptr = new char[state.alloc_size];
+			state.arena_owned = aggr_input_data.spillable;
+			state.dataptr = AllocateBuffer(state, aggr_input_data.allocator);
 			state.size = str_size;
 			memcpy(state.dataptr, str, str_size);
 		} else {
@@ -72,13 +108,19 @@ struct StringAggFunction {
 			idx_t required_size = state.size + str_size + sep_size;
 			if (required_size > state.alloc_size) {
 				// no space! allocate extra space
+				auto old_size = state.alloc_size;
 				while (state.alloc_size < required_size) {
 					state.alloc_size *= 2;
 				}
-				auto new_data = new char[state.alloc_size];
-				memcpy(new_data, state.dataptr, state.size);
-				delete[] state.dataptr;
-				state.dataptr = new_data;
+				if (state.arena_owned) {
+					state.dataptr = char_ptr_cast(aggr_input_data.allocator.Reallocate(data_ptr_cast(state.dataptr),
+					                                                                   old_size, state.alloc_size));
+				} else {
+					auto new_data = new char[state.alloc_size];
+					memcpy(new_data, state.dataptr, state.size);
+					delete[] state.dataptr;
+					state.dataptr = new_data;
+				}
 			}
 			// copy the separator
 			memcpy(state.dataptr + state.size, sep, sep_size);
@@ -89,14 +131,14 @@ struct StringAggFunction {
 		}
 	}
 
-	static inline void PerformOperation(StringAggState &state, string_t str, optional_ptr<FunctionData> data_p) {
-		auto &data = data_p->Cast<StringAggBindData>();
-		PerformOperation(state, str.GetData(), data.sep.c_str(), str.GetSize(), data.sep.size());
+	static inline void PerformOperation(StringAggState &state, string_t str, AggregateInputData &aggr_input_data) {
+		auto &data = aggr_input_data.bind_data->Cast<StringAggBindData>();
+		PerformOperation(state, aggr_input_data, str.GetData(), data.sep.c_str(), str.GetSize(), data.sep.size());
 	}
 
 	template <class INPUT_TYPE, class STATE, class OP>
 	static void Operation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input) {
-		PerformOperation(state, input, unary_input.input.bind_data);
+		PerformOperation(state, input, unary_input.input);
 	}
 
 	template <class INPUT_TYPE, class STATE, class OP>
@@ -113,8 +155,7 @@ struct StringAggFunction {
 			// source is not set: skip combining
 			return;
 		}
-		PerformOperation(target, string_t(source.dataptr, UnsafeNumericCast<uint32_t>(source.size)),
-		                 aggr_input_data.bind_data);
+		PerformOperation(target, string_t(source.dataptr, UnsafeNumericCast<uint32_t>(source.size)), aggr_input_data);
 	}
 };
 
@@ -166,6 +207,8 @@ AggregateFunctionSet StringAggFun::GetFunctions() {
 	    AggregateFunction::StateDestroy<StringAggState, StringAggFunction>);
 	string_agg_param.serialize = StringAggSerialize;
 	string_agg_param.deserialize = StringAggDeserialize;
+	string_agg_param.state_serialize = AggregateFunction::StateSerialize<StringAggState, StringAggFunction>;
+	string_agg_param.state_deserialize = AggregateFunction::StateDeserialize<StringAggState, StringAggFunction>;
 	string_agg.AddFunction(string_agg_param);
 	string_agg_param.arguments.emplace_back(LogicalType::VARCHAR);
 	string_agg.AddFunction(string_agg_param);
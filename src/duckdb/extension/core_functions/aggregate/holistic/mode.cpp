@@ -11,6 +11,9 @@
 #include "duckdb/function/create_sort_key.hpp"
 #include "duckdb/function/aggregate/sort_key_helpers.hpp"
 #include "duckdb/common/algorithm.hpp"
+#include "duckdb/main/client_config.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/common/serializer/deserializer.hpp"
 #include <functional>
 
 // MODE( <expr1> )
@@ -459,17 +462,278 @@ AggregateFunction GetModeAggregate(const LogicalType &type) {
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Approximate Mode
+//===--------------------------------------------------------------------===//
+// With approximate_holistic_aggregates, MODE keeps a Misra-Gries frequent items summary instead of counting every
+// distinct value. Once the summary holds twice its capacity, only the values with the capacity largest counts are
+// kept (ties are broken by first occurrence, then by value), and their counts are reduced by the (capacity + 1)-th
+// largest count. Every value that occurs more than count / (capacity + 1) times survives, and the result is exact for
+// groups with few distinct values. The summaries merge in Combine (Agarwal et al., "Mergeable Summaries"), so
+// windowed modes use the segment tree.
+struct ModeSketchStandard {
+	template <class INPUT_TYPE>
+	static INPUT_TYPE GetKey(const INPUT_TYPE &input) {
+		return input;
+	}
+
+	template <class KEY_TYPE>
+	static void Finalize(const KEY_TYPE &key, Vector &result, idx_t result_idx) {
+		FlatVector::GetData<KEY_TYPE>(result)[result_idx] = key;
+	}
+};
+
+struct ModeSketchString {
+	static string GetKey(const string_t &input) {
+		return input.GetString();
+	}
+
+	static void Finalize(const string &key, Vector &result, idx_t result_idx) {
+		FlatVector::GetData<string_t>(result)[result_idx] = StringVector::AddStringOrBlob(result, key);
+	}
+};
+
+struct ModeSketchFallback : ModeSketchString {
+	static void Finalize(const string &key, Vector &result, idx_t result_idx) {
+		CreateSortKeyHelpers::DecodeSortKey(string_t(key), result, result_idx,
+		                                    OrderModifiers(OrderType::ASCENDING, OrderByNullType::NULLS_LAST));
+	}
+};
+
+template <class KEY_TYPE>
+struct ModeSketchState {
+	using Counts = unordered_map<KEY_TYPE, ModeAttr>;
+
+	Counts *counts;
+	//! The number of values added (to break ties by their first occurrence)
+	idx_t count;
+
+	Counts &GetCounts() {
+		if (!counts) {
+			counts = new Counts();
+		}
+		return *counts;
+	}
+};
+
+template <class TYPE_OP>
+struct ModeSketchFunction {
+	static constexpr idx_t CAPACITY = 1024;
+
+	template <class STATE>
+	static void Initialize(STATE &state) {
+		state.counts = nullptr;
+		state.count = 0;
+	}
+
+	template <class STATE>
+	static void Prune(STATE &state) {
+		auto &counts = *state.counts;
+		if (counts.size() <= 2 * CAPACITY) {
+			return;
+		}
+		// keep the CAPACITY largest counts - with ties (e.g., all-distinct input) this keeps the earliest values
+		// rather than dropping every value whose count equals the threshold
+		using ENTRY = typename STATE::Counts::iterator;
+		vector<ENTRY> entries;
+		entries.reserve(counts.size());
+		for (auto entry = counts.begin(); entry != counts.end(); ++entry) {
+			entries.push_back(entry);
+		}
+		std::nth_element(entries.begin(), entries.begin() + CAPACITY, entries.end(),
+		                 [](const ENTRY &lhs, const ENTRY &rhs) {
+			                 if (lhs->second.count != rhs->second.count) {
+				                 return lhs->second.count > rhs->second.count;
+			                 }
+			                 if (lhs->second.first_row != rhs->second.first_row) {
+				                 return lhs->second.first_row < rhs->second.first_row;
+			                 }
+			                 return lhs->first < rhs->first;
+		                 });
+		const auto threshold = entries[CAPACITY]->second.count;
+		for (idx_t i = 0; i < CAPACITY; i++) {
+			entries[i]->second.count -= threshold;
+		}
+		for (idx_t i = CAPACITY; i < entries.size(); i++) {
+			counts.erase(entries[i]);
+		}
+	}
+
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void Execute(STATE &state, const INPUT_TYPE &input, AggregateInputData &, idx_t count = 1) {
+		auto &attr = state.GetCounts()[TYPE_OP::GetKey(input)];
+		attr.count += count;
+		attr.first_row = MinValue<idx_t>(attr.first_row, state.count);
+		state.count += count;
+		Prune(state);
+	}
+
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void Operation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &aggr_input) {
+		Execute<INPUT_TYPE, STATE, OP>(state, input, aggr_input.input);
+	}
+
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &aggr_input,
+	                              idx_t count) {
+		Execute<INPUT_TYPE, STATE, OP>(state, input, aggr_input.input, count);
+	}
+
+	template <class STATE, class OP>
+	static void Combine(const STATE &source, STATE &target, AggregateInputData &) {
+		if (!source.counts) {
+			return;
+		}
+		auto &counts = target.GetCounts();
+		for (auto &entry : *source.counts) {
+			auto &attr = counts[entry.first];
+			attr.count += entry.second.count;
+			attr.first_row = MinValue(attr.first_row, entry.second.first_row);
+		}
+		target.count += source.count;
+		Prune(target);
+	}
+
+	template <class STATE>
+	static void Finalize(STATE &state, AggregateFinalizeData &finalize_data) {
+		if (!state.counts || state.counts->empty()) {
+			finalize_data.ReturnNull();
+			return;
+		}
+		auto mode = state.counts->begin();
+		for (auto entry = mode; entry != state.counts->end(); ++entry) {
+			// Tie break with the lowest insert position
+			if (entry->second.count > mode->second.count ||
+			    (entry->second.count == mode->second.count && entry->second.first_row < mode->second.first_row)) {
+				mode = entry;
+			}
+		}
+		TYPE_OP::Finalize(mode->first, finalize_data.result, finalize_data.result_idx);
+	}
+
+	template <class STATE>
+	static void Destroy(STATE &state, AggregateInputData &) {
+		delete state.counts;
+		state.counts = nullptr;
+	}
+
+	static bool IgnoreNull() {
+		return true;
+	}
+};
+
+template <class INPUT_TYPE>
+static AggregateFunction GetTypedModeSketchFunction(const LogicalType &type) {
+	using STATE = ModeSketchState<INPUT_TYPE>;
+	using OP = ModeSketchFunction<ModeSketchStandard>;
+	return AggregateFunction(
+	    {type}, type, AggregateFunction::StateSize<STATE>, AggregateFunction::StateInitialize<STATE, OP>,
+	    AggregateFunction::UnaryScatterUpdate<STATE, INPUT_TYPE, OP>, AggregateFunction::StateCombine<STATE, OP>,
+	    AggregateFunction::StateVoidFinalize<STATE, OP>, AggregateFunction::UnaryUpdate<STATE, INPUT_TYPE, OP>, nullptr,
+	    AggregateFunction::StateDestroy<STATE, OP>);
+}
+
+static AggregateFunction GetModeSketchAggregate(const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::INT8:
+		return GetTypedModeSketchFunction<int8_t>(type);
+	case PhysicalType::UINT8:
+		return GetTypedModeSketchFunction<uint8_t>(type);
+	case PhysicalType::INT16:
+		return GetTypedModeSketchFunction<int16_t>(type);
+	case PhysicalType::UINT16:
+		return GetTypedModeSketchFunction<uint16_t>(type);
+	case PhysicalType::INT32:
+		return GetTypedModeSketchFunction<int32_t>(type);
+	case PhysicalType::UINT32:
+		return GetTypedModeSketchFunction<uint32_t>(type);
+	case PhysicalType::INT64:
+		return GetTypedModeSketchFunction<int64_t>(type);
+	case PhysicalType::UINT64:
+		return GetTypedModeSketchFunction<uint64_t>(type);
+	case PhysicalType::INT128:
+		return GetTypedModeSketchFunction<hugeint_t>(type);
+	case PhysicalType::UINT128:
+		return GetTypedModeSketchFunction<uhugeint_t>(type);
+	case PhysicalType::FLOAT:
+		return GetTypedModeSketchFunction<float>(type);
+	case PhysicalType::DOUBLE:
+		return GetTypedModeSketchFunction<double>(type);
+	case PhysicalType::VARCHAR: {
+		using STATE = ModeSketchState<string>;
+		using OP = ModeSketchFunction<ModeSketchString>;
+		return AggregateFunction(
+		    {type}, type, AggregateFunction::StateSize<STATE>, AggregateFunction::StateInitialize<STATE, OP>,
+		    AggregateFunction::UnaryScatterUpdate<STATE, string_t, OP>, AggregateFunction::StateCombine<STATE, OP>,
+		    AggregateFunction::StateVoidFinalize<STATE, OP>, AggregateFunction::UnaryUpdate<STATE, string_t, OP>,
+		    nullptr, AggregateFunction::StateDestroy<STATE, OP>);
+	}
+	default: {
+		using STATE = ModeSketchState<string>;
+		using OP = ModeSketchFunction<ModeSketchFallback>;
+		return AggregateFunction({type}, type, AggregateFunction::StateSize<STATE>,
+		                         AggregateFunction::StateInitialize<STATE, OP>,
+		                         AggregateSortKeyHelpers::UnaryUpdate<STATE, OP>,
+		                         AggregateFunction::StateCombine<STATE, OP>,
+		                         AggregateFunction::StateVoidFinalize<STATE, OP>, nullptr, nullptr,
+		                         AggregateFunction::StateDestroy<STATE, OP>);
+	}
+	}
+}
+
+//! Whether MODE uses the approximate summary - serialized, so that a deserialized plan uses the same function
+struct ModeBindData : public FunctionData {
+	explicit ModeBindData(bool approximate_p) : approximate(approximate_p) {
+	}
+
+	bool approximate;
+
+	unique_ptr<FunctionData> Copy() const override {
+		return make_uniq<ModeBindData>(approximate);
+	}
+
+	bool Equals(const FunctionData &other_p) const override {
+		auto &other = other_p.Cast<ModeBindData>();
+		return approximate == other.approximate;
+	}
+};
+
+static void ModeSerialize(Serializer &serializer, const optional_ptr<FunctionData> bind_data_p,
+                          const AggregateFunction &function) {
+	auto &bind_data = bind_data_p->Cast<ModeBindData>();
+	serializer.WritePropertyWithDefault<bool>(100, "approximate", bind_data.approximate, false);
+}
+
+static unique_ptr<FunctionData> ModeDeserialize(Deserializer &deserializer, AggregateFunction &function);
+
+static void SetModeAggregate(AggregateFunction &function, const LogicalType &type, bool approximate) {
+	function = approximate ? GetModeSketchAggregate(type) : GetModeAggregate(type);
+	function.name = "mode";
+	function.serialize = ModeSerialize;
+	function.deserialize = ModeDeserialize;
+}
+
+static unique_ptr<FunctionData> ModeDeserialize(Deserializer &deserializer, AggregateFunction &function) {
+	bool approximate;
+	deserializer.ReadPropertyWithExplicitDefault<bool>(100, "approximate", approximate, false);
+	SetModeAggregate(function, function.arguments[0], approximate);
+	return make_uniq<ModeBindData>(approximate);
+}
+
 unique_ptr<FunctionData> BindModeAggregate(ClientContext &context, AggregateFunction &function,
                                            vector<unique_ptr<Expression>> &arguments) {
-	function = GetModeAggregate(arguments[0]->return_type);
-	function.name = "mode";
-	return nullptr;
+	const auto approximate = ClientConfig::GetConfig(context).approximate_holistic_aggregates;
+	SetModeAggregate(function, arguments[0]->return_type, approximate);
+	return make_uniq<ModeBindData>(approximate);
 }
 
 AggregateFunctionSet ModeFun::GetFunctions() {
 	AggregateFunctionSet mode("mode");
-	mode.AddFunction(AggregateFunction({LogicalTypeId::ANY}, LogicalTypeId::ANY, nullptr, nullptr, nullptr, nullptr,
-	                                   nullptr, nullptr, BindModeAggregate));
+	AggregateFunction function({LogicalTypeId::ANY}, LogicalTypeId::ANY, nullptr, nullptr, nullptr, nullptr, nullptr,
+	                           nullptr, BindModeAggregate);
+	function.serialize = ModeSerialize;
+	function.deserialize = ModeDeserialize;
+	mode.AddFunction(function);
 	return mode;
 }
 
@@ -10,6 +10,8 @@
 #include "duckdb/common/serializer/serializer.hpp"
 #include "duckdb/common/serializer/deserializer.hpp"
 #include "duckdb/function/aggregate/sort_key_helpers.hpp"
+#include "duckdb/main/client_config.hpp"
+#include "core_functions/aggregate/quantile_sketch.hpp"
 
 namespace duckdb {
 
@@ -90,7 +92,8 @@ QuantileBindData::QuantileBindData(const vector<Value> &quantiles_p) {
 	}
 }
 
-QuantileBindData::QuantileBindData(const QuantileBindData &other) : order(other.order), desc(other.desc) {
+QuantileBindData::QuantileBindData(const QuantileBindData &other)
+    : order(other.order), desc(other.desc), approximate(other.approximate) {
 	for (const auto &q : other.quantiles) {
 		quantiles.emplace_back(q);
 	}
@@ -102,7 +105,8 @@ unique_ptr<FunctionData> QuantileBindData::Copy() const {
 
 bool QuantileBindData::Equals(const FunctionData &other_p) const {
 	auto &other = other_p.Cast<QuantileBindData>();
-	return desc == other.desc && quantiles == other.quantiles && order == other.order;
+	return desc == other.desc && quantiles == other.quantiles && order == other.order &&
+	       approximate == other.approximate;
 }
 
 void QuantileBindData::Serialize(Serializer &serializer, const optional_ptr<FunctionData> bind_data_p,
@@ -115,6 +119,7 @@ void QuantileBindData::Serialize(Serializer &serializer, const optional_ptr<Func
 	serializer.WriteProperty(100, "quantiles", raw);
 	serializer.WriteProperty(101, "order", bind_data.order);
 	serializer.WriteProperty(102, "desc", bind_data.desc);
+	serializer.WritePropertyWithDefault<bool>(105, "approximate", bind_data.approximate, false);
 }
 
 unique_ptr<FunctionData> QuantileBindData::Deserialize(Deserializer &deserializer, AggregateFunction &function) {
@@ -130,6 +135,7 @@ unique_ptr<FunctionData> QuantileBindData::Deserialize(Deserializer &deserialize
 	if (deserialization_type != QuantileSerializationType::NON_DECIMAL) {
 		deserializer.ReadDeletedProperty<LogicalType>(104, "logical_type");
 	}
+	deserializer.ReadPropertyWithExplicitDefault<bool>(105, "approximate", result->approximate, false);
 
 	for (const auto &r : raw) {
 		result->quantiles.emplace_back(QuantileValue(r));
@@ -422,6 +428,8 @@ struct ScalarDiscreteQuantile {
 		using OP = QuantileScalarOperation<true>;
 		auto fun = AggregateFunction::UnaryAggregateDestructor<STATE, INPUT_TYPE, INPUT_TYPE, OP,
 		                                                       AggregateDestructorType::LEGACY>(type, type);
+		fun.state_serialize = AggregateFunction::StateSerialize<STATE, OP>;
+		fun.state_deserialize = AggregateFunction::StateDeserialize<STATE, OP>;
 #ifndef DUCKDB_SMALLER_BINARY
 		fun.window = OP::Window<STATE, INPUT_TYPE, INPUT_TYPE>;
 		fun.window_init = OP::WindowInit<STATE, INPUT_TYPE>;
@@ -439,6 +447,8 @@ struct ScalarDiscreteQuantile {
 		                      AggregateFunction::StateCombine<STATE, OP>,
 		                      AggregateFunction::StateVoidFinalize<STATE, OP>, nullptr, nullptr,
 		                      AggregateFunction::StateDestroy<STATE, OP>);
+		fun.state_serialize = AggregateFunction::StateSerialize<STATE, OP>;
+		fun.state_deserialize = AggregateFunction::StateDeserialize<STATE, OP>;
 		return fun;
 	}
 };
@@ -446,12 +456,15 @@ struct ScalarDiscreteQuantile {
 template <class STATE, class INPUT_TYPE, class RESULT_TYPE, class OP>
 static AggregateFunction QuantileListAggregate(const LogicalType &input_type, const LogicalType &child_type) { // NOLINT
 	LogicalType result_type = LogicalType::LIST(child_type);
-	return AggregateFunction(
+	AggregateFunction fun(
 	    {input_type}, result_type, AggregateFunction::StateSize<STATE>,
 	    AggregateFunction::StateInitialize<STATE, OP, AggregateDestructorType::LEGACY>,
 	    AggregateFunction::UnaryScatterUpdate<STATE, INPUT_TYPE, OP>, AggregateFunction::StateCombine<STATE, OP>,
 	    AggregateFunction::StateFinalize<STATE, RESULT_TYPE, OP>, AggregateFunction::UnaryUpdate<STATE, INPUT_TYPE, OP>,
 	    nullptr, AggregateFunction::StateDestroy<STATE, OP>);
+	fun.state_serialize = AggregateFunction::StateSerialize<STATE, OP>;
+	fun.state_deserialize = AggregateFunction::StateDeserialize<STATE, OP>;
+	return fun;
 }
 
 struct ListDiscreteQuantile {
@@ -478,6 +491,8 @@ struct ListDiscreteQuantile {
 		                      AggregateFunction::StateCombine<STATE, OP>,
 		                      AggregateFunction::StateFinalize<STATE, list_entry_t, OP>, nullptr, nullptr,
 		                      AggregateFunction::StateDestroy<STATE, OP>);
+		fun.state_serialize = AggregateFunction::StateSerialize<STATE, OP>;
+		fun.state_deserialize = AggregateFunction::StateDeserialize<STATE, OP>;
 		return fun;
 	}
 };
@@ -554,6 +569,8 @@ struct ScalarContinuousQuantile {
 		    AggregateFunction::UnaryAggregateDestructor<STATE, INPUT_TYPE, TARGET_TYPE, OP,
 		                                                AggregateDestructorType::LEGACY>(input_type, target_type);
 		fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+		fun.state_serialize = AggregateFunction::StateSerialize<STATE, OP>;
+		fun.state_deserialize = AggregateFunction::StateDeserialize<STATE, OP>;
 #ifndef DUCKDB_SMALLER_BINARY
 		fun.window = OP::template Window<STATE, INPUT_TYPE, TARGET_TYPE>;
 		fun.window_init = OP::template WindowInit<STATE, INPUT_TYPE>;
@@ -585,6 +602,170 @@ AggregateFunction GetContinuousQuantileList(const LogicalType &type) {
 	return GetContinuousQuantileTemplated<ListContinuousQuantile>(type);
 }
 
+//===--------------------------------------------------------------------===//
+// Approximate Quantiles
+//===--------------------------------------------------------------------===//
+// With approximate_holistic_aggregates, numeric quantiles are estimated from a QuantileSketch instead of
+// buffering all values. The sketches merge in Combine, so windowed quantiles use the segment tree.
+struct QuantileSketchState {
+	QuantileSketch *sketch;
+
+	QuantileSketch &GetSketch() {
+		if (!sketch) {
+			sketch = new QuantileSketch();
+		}
+		return *sketch;
+	}
+};
+
+struct QuantileSketchOperation {
+	template <class STATE>
+	static void Initialize(STATE &state) {
+		state.sketch = nullptr;
+	}
+
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &, idx_t count) {
+		state.GetSketch().Add(Cast::Operation<INPUT_TYPE, double>(input), count);
+	}
+
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void Operation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &) {
+		state.GetSketch().Add(Cast::Operation<INPUT_TYPE, double>(input));
+	}
+
+	template <class STATE, class OP>
+	static void Combine(const STATE &source, STATE &target, AggregateInputData &) {
+		if (!source.sketch) {
+			return;
+		}
+		target.GetSketch().Merge(*source.sketch);
+	}
+
+	template <class STATE>
+	static void Destroy(STATE &state, AggregateInputData &) {
+		delete state.sketch;
+		state.sketch = nullptr;
+	}
+
+	static bool IgnoreNull() {
+		return true;
+	}
+
+	template <class T>
+	static T Estimate(const QuantileSketch &sketch, const QuantileValue &quantile, bool desc) {
+		return Cast::Operation<double, T>(sketch.Quantile(desc ? 1 - quantile.dbl : quantile.dbl));
+	}
+};
+
+struct QuantileSketchScalarOperation : QuantileSketchOperation {
+	template <class T, class STATE>
+	static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data) {
+		if (!state.sketch) {
+			finalize_data.ReturnNull();
+			return;
+		}
+		auto &bind_data = finalize_data.input.bind_data->Cast<QuantileBindData>();
+		D_ASSERT(bind_data.quantiles.size() == 1);
+		target = Estimate<T>(*state.sketch, bind_data.quantiles[0], bind_data.desc);
+	}
+};
+
+template <class CHILD_TYPE>
+struct QuantileSketchListOperation : QuantileSketchOperation {
+	template <class T, class STATE>
+	static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data) {
+		if (!state.sketch) {
+			finalize_data.ReturnNull();
+			return;
+		}
+		auto &bind_data = finalize_data.input.bind_data->Cast<QuantileBindData>();
+		auto &result = ListVector::GetEntry(finalize_data.result);
+		auto ridx = ListVector::GetListSize(finalize_data.result);
+		ListVector::Reserve(finalize_data.result, ridx + bind_data.quantiles.size());
+		auto rdata = FlatVector::GetData<CHILD_TYPE>(result);
+
+		target.offset = ridx;
+		for (idx_t q = 0; q < bind_data.quantiles.size(); q++) {
+			rdata[ridx + q] = Estimate<CHILD_TYPE>(*state.sketch, bind_data.quantiles[q], bind_data.desc);
+		}
+		target.length = bind_data.quantiles.size();
+		ListVector::SetListSize(finalize_data.result, target.offset + target.length);
+	}
+};
+
+template <class INPUT_TYPE, class RESULT_TYPE>
+static AggregateFunction GetQuantileSketchTemplated(const LogicalType &input_type, const LogicalType &result_type,
+                                                    bool list) {
+	using STATE = QuantileSketchState;
+	if (list) {
+		using OP = QuantileSketchListOperation<RESULT_TYPE>;
+		return AggregateFunction::UnaryAggregateDestructor<STATE, INPUT_TYPE, list_entry_t, OP>(
+		    input_type, LogicalType::LIST(result_type));
+	}
+	using OP = QuantileSketchScalarOperation;
+	return AggregateFunction::UnaryAggregateDestructor<STATE, INPUT_TYPE, RESULT_TYPE, OP>(input_type, result_type);
+}
+
+//! Returns the sketch-based quantile for the input type, or an aggregate without update function if the type
+//! cannot be approximated (temporal and DECIMAL types, which keep their exact quantiles)
+static AggregateFunction GetQuantileSketch(const LogicalType &type, bool discrete, bool list) {
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+		return discrete ? GetQuantileSketchTemplated<int8_t, int8_t>(type, type, list)
+		                : GetQuantileSketchTemplated<int8_t, double>(type, LogicalType::DOUBLE, list);
+	case LogicalTypeId::SMALLINT:
+		return discrete ? GetQuantileSketchTemplated<int16_t, int16_t>(type, type, list)
+		                : GetQuantileSketchTemplated<int16_t, double>(type, LogicalType::DOUBLE, list);
+	case LogicalTypeId::INTEGER:
+		return discrete ? GetQuantileSketchTemplated<int32_t, int32_t>(type, type, list)
+		                : GetQuantileSketchTemplated<int32_t, double>(type, LogicalType::DOUBLE, list);
+	case LogicalTypeId::BIGINT:
+		return discrete ? GetQuantileSketchTemplated<int64_t, int64_t>(type, type, list)
+		                : GetQuantileSketchTemplated<int64_t, double>(type, LogicalType::DOUBLE, list);
+	case LogicalTypeId::HUGEINT:
+		return discrete ? GetQuantileSketchTemplated<hugeint_t, hugeint_t>(type, type, list)
+		                : GetQuantileSketchTemplated<hugeint_t, double>(type, LogicalType::DOUBLE, list);
+	case LogicalTypeId::UTINYINT:
+		return discrete ? GetQuantileSketchTemplated<uint8_t, uint8_t>(type, type, list)
+		                : GetQuantileSketchTemplated<uint8_t, double>(type, LogicalType::DOUBLE, list);
+	case LogicalTypeId::USMALLINT:
+		return discrete ? GetQuantileSketchTemplated<uint16_t, uint16_t>(type, type, list)
+		                : GetQuantileSketchTemplated<uint16_t, double>(type, LogicalType::DOUBLE, list);
+	case LogicalTypeId::UINTEGER:
+		return discrete ? GetQuantileSketchTemplated<uint32_t, uint32_t>(type, type, list)
+		                : GetQuantileSketchTemplated<uint32_t, double>(type, LogicalType::DOUBLE, list);
+	case LogicalTypeId::UBIGINT:
+		return discrete ? GetQuantileSketchTemplated<uint64_t, uint64_t>(type, type, list)
+		                : GetQuantileSketchTemplated<uint64_t, double>(type, LogicalType::DOUBLE, list);
+	case LogicalTypeId::FLOAT:
+		return GetQuantileSketchTemplated<float, float>(type, type, list);
+	case LogicalTypeId::DOUBLE:
+		return GetQuantileSketchTemplated<double, double>(type, type, list);
+	default:
+		return AggregateFunction({type}, type, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr);
+	}
+}
+
+//! Replaces an exact quantile function by its sketch-based variant (if the input type allows it)
+static void UseQuantileSketch(AggregateFunction &function, QuantileBindData &bind_data, bool discrete, bool list) {
+	if (function.arguments[0].HasAlias()) {
+		return;
+	}
+	auto sketch = GetQuantileSketch(function.arguments[0], discrete, list);
+	if (!sketch.update) {
+		return;
+	}
+	sketch.name = function.name;
+	sketch.arguments = function.arguments;
+	sketch.bind = function.bind;
+	sketch.serialize = function.serialize;
+	sketch.deserialize = function.deserialize;
+	sketch.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+	function = std::move(sketch);
+	bind_data.approximate = true;
+}
+
 //===--------------------------------------------------------------------===//
 // Quantile binding
 //===--------------------------------------------------------------------===//
@@ -686,16 +867,25 @@ struct MedianFunction {
 
 	static unique_ptr<FunctionData> Deserialize(Deserializer &deserializer, AggregateFunction &function) {
 		auto bind_data = QuantileBindData::Deserialize(deserializer, function);
+		auto &quantile_data = bind_data->Cast<QuantileBindData>();
 
-		auto &input_type = function.arguments[0];
+		auto input_type = function.arguments[0];
 		function = GetAggregate(input_type);
+		if (quantile_data.approximate) {
+			UseQuantileSketch(function, quantile_data, !CanInterpolate(input_type), false);
+		}
 		return bind_data;
 	}
 
 	static unique_ptr<FunctionData> Bind(ClientContext &context, AggregateFunction &function,
 	                                     vector<unique_ptr<Expression>> &arguments) {
-		function = GetAggregate(arguments[0]->return_type);
-		return make_uniq<QuantileBindData>(Value::DECIMAL(int16_t(5), 2, 1));
+		auto &input_type = arguments[0]->return_type;
+		function = GetAggregate(input_type);
+		auto bind_data = make_uniq<QuantileBindData>(Value::DECIMAL(int16_t(5), 2, 1));
+		if (ClientConfig::GetConfig(context).approximate_holistic_aggregates) {
+			UseQuantileSketch(function, *bind_data, !CanInterpolate(input_type), false);
+		}
+		return std::move(bind_data);
 	}
 };
 
@@ -714,16 +904,24 @@ struct DiscreteQuantileListFunction {
 
 	static unique_ptr<FunctionData> Deserialize(Deserializer &deserializer, AggregateFunction &function) {
 		auto bind_data = QuantileBindData::Deserialize(deserializer, function);
+		auto &quantile_data = bind_data->Cast<QuantileBindData>();
 
-		auto &input_type = function.arguments[0];
+		auto input_type = function.arguments[0];
 		function = GetAggregate(input_type);
+		if (quantile_data.approximate) {
+			UseQuantileSketch(function, quantile_data, true, true);
+		}
 		return bind_data;
 	}
 
 	static unique_ptr<FunctionData> Bind(ClientContext &context, AggregateFunction &function,
 	                                     vector<unique_ptr<Expression>> &arguments) {
 		function = GetAggregate(arguments[0]->return_type);
-		return BindQuantile(context, function, arguments);
+		auto bind_data = BindQuantile(context, function, arguments);
+		if (ClientConfig::GetConfig(context).approximate_holistic_aggregates) {
+			UseQuantileSketch(function, bind_data->Cast<QuantileBindData>(), true, true);
+		}
+		return bind_data;
 	}
 };
 
@@ -744,11 +942,15 @@ struct DiscreteQuantileFunction {
 		auto bind_data = QuantileBindData::Deserialize(deserializer, function);
 		auto &quantile_data = bind_data->Cast<QuantileBindData>();
 
-		auto &input_type = function.arguments[0];
-		if (quantile_data.quantiles.size() == 1) {
-			function = GetAggregate(input_type);
-		} else {
+		auto input_type = function.arguments[0];
+		const auto list = quantile_data.quantiles.size() != 1;
+		if (list) {
 			function = DiscreteQuantileListFunction::GetAggregate(input_type);
+		} else {
+			function = GetAggregate(input_type);
+		}
+		if (quantile_data.approximate) {
+			UseQuantileSketch(function, quantile_data, true, list);
 		}
 		return bind_data;
 	}
@@ -756,7 +958,11 @@ struct DiscreteQuantileFunction {
 	static unique_ptr<FunctionData> Bind(ClientContext &context, AggregateFunction &function,
 	                                     vector<unique_ptr<Expression>> &arguments) {
 		function = GetAggregate(arguments[0]->return_type);
-		return BindQuantile(context, function, arguments);
+		auto bind_data = BindQuantile(context, function, arguments);
+		if (ClientConfig::GetConfig(context).approximate_holistic_aggregates) {
+			UseQuantileSketch(function, bind_data->Cast<QuantileBindData>(), true, false);
+		}
+		return bind_data;
 	}
 };
 
@@ -775,9 +981,13 @@ struct ContinuousQuantileFunction {
 
 	static unique_ptr<FunctionData> Deserialize(Deserializer &deserializer, AggregateFunction &function) {
 		auto bind_data = QuantileBindData::Deserialize(deserializer, function);
+		auto &quantile_data = bind_data->Cast<QuantileBindData>();
 
-		auto &input_type = function.arguments[0];
+		auto input_type = function.arguments[0];
 		function = GetAggregate(input_type);
+		if (quantile_data.approximate) {
+			UseQuantileSketch(function, quantile_data, false, false);
+		}
 		return bind_data;
 	}
 
@@ -785,7 +995,11 @@ struct ContinuousQuantileFunction {
 	                                     vector<unique_ptr<Expression>> &arguments) {
 		function = GetAggregate(function.arguments[0].id() == LogicalTypeId::DECIMAL ? arguments[0]->return_type
 		                                                                             : function.arguments[0]);
-		return BindQuantile(context, function, arguments);
+		auto bind_data = BindQuantile(context, function, arguments);
+		if (ClientConfig::GetConfig(context).approximate_holistic_aggregates) {
+			UseQuantileSketch(function, bind_data->Cast<QuantileBindData>(), false, false);
+		}
+		return bind_data;
 	}
 };
 
@@ -805,9 +1019,13 @@ struct ContinuousQuantileListFunction {
 
 	static unique_ptr<FunctionData> Deserialize(Deserializer &deserializer, AggregateFunction &function) {
 		auto bind_data = QuantileBindData::Deserialize(deserializer, function);
+		auto &quantile_data = bind_data->Cast<QuantileBindData>();
 
-		auto &input_type = function.arguments[0];
+		auto input_type = function.arguments[0];
 		function = GetAggregate(input_type);
+		if (quantile_data.approximate) {
+			UseQuantileSketch(function, quantile_data, false, true);
+		}
 		return bind_data;
 	}
 
@@ -815,7 +1033,11 @@ struct ContinuousQuantileListFunction {
 	                                     vector<unique_ptr<Expression>> &arguments) {
 		function = GetAggregate(function.arguments[0].id() == LogicalTypeId::DECIMAL ? arguments[0]->return_type
 		                                                                             : function.arguments[0]);
-		return BindQuantile(context, function, arguments);
+		auto bind_data = BindQuantile(context, function, arguments);
+		if (ClientConfig::GetConfig(context).approximate_holistic_aggregates) {
+			UseQuantileSketch(function, bind_data->Cast<QuantileBindData>(), false, true);
+		}
+		return bind_data;
 	}
 };
 
@@ -4,9 +4,22 @@
 #include "duckdb/common/string_map_set.hpp"
 #include "core_functions/aggregate/histogram_helpers.hpp"
 #include "duckdb/common/owning_string_map.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/common/serializer/deserializer.hpp"
 
 namespace duckdb {
 
+//! The type in which a histogram key is (de)serialized when the state is spilled
+template <class T>
+struct HistogramSpillKey {
+	using TYPE = T;
+};
+
+template <>
+struct HistogramSpillKey<string_t> {
+	using TYPE = string;
+};
+
 template <class MAP_TYPE>
 struct HistogramFunction {
 	template <class STATE>
@@ -37,6 +50,39 @@ struct HistogramFunction {
 			(*target.hist)[entry.first] += entry.second;
 		}
 	}
+
+	template <class STATE>
+	static void SerializeState(STATE &state, Serializer &serializer, AggregateInputData &) {
+		serializer.WriteProperty<bool>(100, "is_set", state.hist != nullptr);
+		if (!state.hist) {
+			return;
+		}
+		auto entry = state.hist->begin();
+		serializer.WriteList(101, "entries", state.hist->size(), [&](Serializer::List &list, idx_t) {
+			list.WriteObject([&](Serializer &object) {
+				object.WriteProperty(100, "key", entry->first);
+				object.WriteProperty<idx_t>(101, "count", entry->second);
+			});
+			++entry;
+		});
+	}
+
+	template <class STATE>
+	static void DeserializeState(STATE &state, Deserializer &deserializer, AggregateInputData &aggr_input_data) {
+		using KEY_TYPE = typename MAP_TYPE::MAP_TYPE::key_type;
+		D_ASSERT(!state.hist);
+		if (!deserializer.ReadProperty<bool>(100, "is_set")) {
+			return;
+		}
+		state.hist = MAP_TYPE::CreateEmpty(aggr_input_data.allocator);
+		deserializer.ReadList(101, "entries", [&](Deserializer::List &list, idx_t) {
+			list.ReadObject([&](Deserializer &object) {
+				auto key = object.ReadProperty<typename HistogramSpillKey<KEY_TYPE>::TYPE>(100, "key");
+				// the map copies non-inlined strings into its own memory
+				(*state.hist)[KEY_TYPE(key)] += object.ReadProperty<idx_t>(101, "count");
+			});
+		});
+	}
 };
 
 template <class TYPE>
@@ -143,11 +189,14 @@ static AggregateFunction GetHistogramFunction(const LogicalType &type) {
 	using HIST_FUNC = HistogramFunction<MAP_TYPE>;
 
 	auto struct_type = LogicalType::MAP(type, LogicalType::UBIGINT);
-	return AggregateFunction(
+	AggregateFunction result(
 	    "histogram", {type}, struct_type, AggregateFunction::StateSize<STATE_TYPE>,
 	    AggregateFunction::StateInitialize<STATE_TYPE, HIST_FUNC>, HistogramUpdateFunction<OP, T, MAP_TYPE>,
 	    AggregateFunction::StateCombine<STATE_TYPE, HIST_FUNC>, HistogramFinalizeFunction<OP, T, MAP_TYPE>, nullptr,
 	    nullptr, AggregateFunction::StateDestroy<STATE_TYPE, HIST_FUNC>);
+	result.state_serialize = AggregateFunction::StateSerialize<STATE_TYPE, HIST_FUNC>;
+	result.state_deserialize = AggregateFunction::StateDeserialize<STATE_TYPE, HIST_FUNC>;
+	return result;
 }
 
 template <class OP, class T, class MAP_TYPE>
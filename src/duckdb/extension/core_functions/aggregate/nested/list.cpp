@@ -1,4 +1,7 @@
 #include "duckdb/common/pair.hpp"
+#include "duckdb/common/serializer/binary_deserializer.hpp"
+#include "duckdb/common/serializer/binary_serializer.hpp"
+#include "duckdb/common/serializer/memory_stream.hpp"
 #include "duckdb/common/types/list_segment.hpp"
 #include "core_functions/aggregate/nested_functions.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
@@ -185,6 +188,60 @@ static void ListCombineFunction(Vector &states_vector, Vector &combined, Aggrega
 	}
 }
 
+static void ListSerializeState(Vector &states_vector, AggregateInputData &aggr_input_data, Vector &result,
+                               idx_t count) {
+	auto states = FlatVector::GetData<ListAggState *>(states_vector);
+	auto result_data = FlatVector::GetData<string_t>(result);
+
+	auto &list_bind_data = aggr_input_data.bind_data->Cast<ListBindData>();
+	auto child_type = ListType::GetChildType(list_bind_data.stype);
+
+	MemoryStream stream;
+	for (idx_t i = 0; i < count; i++) {
+		auto &state = *states[i];
+		const auto entry_count = state.linked_list.total_capacity;
+		Vector entries(child_type, entry_count);
+		list_bind_data.functions.BuildListVector(state.linked_list, entries, 0);
+
+		stream.Rewind();
+		BinarySerializer serializer(stream);
+		serializer.Begin();
+		serializer.WriteProperty<idx_t>(100, "count", entry_count);
+		serializer.WriteObject(101, "entries", [&](Serializer &object) { entries.Serialize(object, entry_count); });
+		serializer.End();
+		result_data[i] =
+		    StringVector::AddStringOrBlob(result, const_char_ptr_cast(stream.GetData()), stream.GetPosition());
+	}
+}
+
+static void ListDeserializeState(Vector &serialized, AggregateInputData &aggr_input_data, Vector &states_vector,
+                                 idx_t count) {
+	auto serialized_data = FlatVector::GetData<string_t>(serialized);
+	auto states = FlatVector::GetData<ListAggState *>(states_vector);
+
+	auto &list_bind_data = aggr_input_data.bind_data->Cast<ListBindData>();
+	auto child_type = ListType::GetChildType(list_bind_data.stype);
+
+	for (idx_t i = 0; i < count; i++) {
+		auto &state = *states[i];
+		MemoryStream stream(data_ptr_cast(serialized_data[i].GetDataWriteable()), serialized_data[i].GetSize());
+		BinaryDeserializer deserializer(stream);
+		deserializer.Begin();
+		const auto entry_count = deserializer.ReadProperty<idx_t>(100, "count");
+		Vector entries(child_type, entry_count);
+		deserializer.ReadObject(101, "entries",
+		                        [&](Deserializer &object) { entries.Deserialize(object, entry_count); });
+		deserializer.End();
+
+		RecursiveUnifiedVectorFormat entries_data;
+		Vector::RecursiveToUnifiedFormat(entries, entry_count, entries_data);
+		for (idx_t entry_idx = 0; entry_idx < entry_count; ++entry_idx) {
+			aggr_input_data.allocator.AlignNext();
+			list_bind_data.functions.AppendRow(aggr_input_data.allocator, state.linked_list, entries_data, entry_idx);
+		}
+	}
+}
+
 unique_ptr<FunctionData> ListBindFunction(ClientContext &context, AggregateFunction &function,
                                           vector<unique_ptr<Expression>> &arguments) {
 	D_ASSERT(arguments.size() == 1);
@@ -205,6 +262,8 @@ AggregateFunction ListFun::GetFunction() {
 	    AggregateFunction({LogicalType::ANY}, LogicalTypeId::LIST, AggregateFunction::StateSize<ListAggState>,
 	                      AggregateFunction::StateInitialize<ListAggState, ListFunction>, ListUpdateFunction,
 	                      ListCombineFunction, ListFinalize, nullptr, ListBindFunction, nullptr, nullptr, nullptr);
+	func.state_serialize = ListSerializeState;
+	func.state_deserialize = ListDeserializeState;
 
 	return func;
 }
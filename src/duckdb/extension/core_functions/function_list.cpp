@@ -202,6 +202,9 @@ static const StaticFunctionDefinition core_functions[] = {
 	DUCKDB_SCALAR_FUNCTION_SET(HexFun),
 	DUCKDB_AGGREGATE_FUNCTION_SET(HistogramFun),
 	DUCKDB_AGGREGATE_FUNCTION(HistogramExactFun),
+	DUCKDB_AGGREGATE_FUNCTION(HllCountFun),
+	DUCKDB_AGGREGATE_FUNCTION(HllMergeFun),
+	DUCKDB_AGGREGATE_FUNCTION(HllStateFun),
 	DUCKDB_SCALAR_FUNCTION_SET(HoursFun),
 	DUCKDB_SCALAR_FUNCTION(InSearchPathFun),
 	DUCKDB_SCALAR_FUNCTION(InstrFun),
@@ -162,6 +162,33 @@ struct EntropyFun {
 	static AggregateFunctionSet GetFunctions();
 };
 
+struct HllStateFun {
+	static constexpr const char *Name = "hll_state";
+	static constexpr const char *Parameters = "any";
+	static constexpr const char *Description = "Builds a HyperLogLog sketch of the distinct elements, which can be stored and later combined with hll_merge or hll_count.";
+	static constexpr const char *Example = "hll_state(A)";
+
+	static AggregateFunction GetFunction();
+};
+
+struct HllMergeFun {
+	static constexpr const char *Name = "hll_merge";
+	static constexpr const char *Parameters = "sketch";
+	static constexpr const char *Description = "Merges HyperLogLog sketches created by hll_state into a single sketch.";
+	static constexpr const char *Example = "hll_merge(hll_state(A))";
+
+	static AggregateFunction GetFunction();
+};
+
+struct HllCountFun {
+	static constexpr const char *Name = "hll_count";
+	static constexpr const char *Parameters = "sketch";
+	static constexpr const char *Description = "Computes the approximate count of distinct elements of the merged HyperLogLog sketches created by hll_state.";
+	static constexpr const char *Example = "hll_count(hll_state(A))";
+
+	static AggregateFunction GetFunction();
+};
+
 struct KahanSumFun {
 	static constexpr const char *Name = "kahan_sum";
 	static constexpr const char *Parameters = "arg";
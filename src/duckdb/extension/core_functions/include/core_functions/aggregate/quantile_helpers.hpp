@@ -60,6 +60,8 @@ struct QuantileBindData : public FunctionData {
 	vector<QuantileValue> quantiles;
 	vector<idx_t> order;
 	bool desc;
+	//! Whether the quantiles are estimated with a QuantileSketch (see approximate_holistic_aggregates)
+	bool approximate = false;
 };
 
 } // namespace duckdb
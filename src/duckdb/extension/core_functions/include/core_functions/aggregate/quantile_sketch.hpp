@@ -0,0 +1,174 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/core_functions/aggregate/quantile_sketch.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/limits.hpp"
+#include "duckdb/common/numeric_utils.hpp"
+#include <cmath>
+
+namespace duckdb {
+
+//! The counts of a range of consecutive sketch buckets. At most MAX_BUCKETS buckets are kept: beyond that, the
+//! buckets of the smallest indexes are collapsed into one.
+struct QuantileSketchStore {
+	static constexpr idx_t MAX_BUCKETS = 2048;
+
+	//! The bucket index of counts[0]
+	int32_t offset = 0;
+	vector<idx_t> counts;
+
+	inline int32_t MaxIndex() const {
+		return offset + NumericCast<int32_t>(counts.size()) - 1;
+	}
+
+	void Add(int32_t index, idx_t count) {
+		if (counts.empty()) {
+			offset = index;
+			counts.push_back(count);
+			return;
+		}
+		const auto max_index = MaxIndex();
+		if (index < offset || index > max_index) {
+			Resize(MinValue(index, offset), MaxValue(index, max_index));
+		}
+		// indexes below the collapsed range fall into its lowest bucket
+		counts[NumericCast<idx_t>(MaxValue(index, offset) - offset)] += count;
+	}
+
+	void Merge(const QuantileSketchStore &other) {
+		if (other.counts.empty()) {
+			return;
+		}
+		if (!counts.empty()) {
+			Resize(MinValue(offset, other.offset), MaxValue(MaxIndex(), other.MaxIndex()));
+		}
+		for (idx_t i = 0; i < other.counts.size(); i++) {
+			if (other.counts[i]) {
+				Add(other.offset + NumericCast<int32_t>(i), other.counts[i]);
+			}
+		}
+	}
+
+private:
+	void Resize(int32_t min_index, int32_t max_index) {
+		if (int64_t(max_index) - int64_t(min_index) + 1 > int64_t(MAX_BUCKETS)) {
+			min_index = max_index - NumericCast<int32_t>(MAX_BUCKETS) + 1;
+		}
+		vector<idx_t> new_counts(NumericCast<idx_t>(max_index - min_index + 1), 0);
+		for (idx_t i = 0; i < counts.size(); i++) {
+			const auto index = MaxValue(offset + NumericCast<int32_t>(i), min_index);
+			new_counts[NumericCast<idx_t>(index - min_index)] += counts[i];
+		}
+		counts = std::move(new_counts);
+		offset = min_index;
+	}
+};
+
+//! A mergeable quantile sketch with relative error guarantees (DDSketch, Masson et al., VLDB 2019).
+//! Values are counted in buckets of logarithmically growing width, so every estimated quantile is within a
+//! relative error of ALPHA of a value of the requested rank. The bucket stores are bounded, which bounds the
+//! memory per sketch regardless of the number of values added; collapsing only degrades the accuracy of the
+//! values closest to zero.
+struct QuantileSketch {
+	static constexpr double ALPHA = 0.005;
+	static constexpr double GAMMA = (1 + ALPHA) / (1 - ALPHA);
+
+	//! The magnitudes of the positive and the negative values
+	QuantileSketchStore positive;
+	QuantileSketchStore negative;
+	idx_t zero_count = 0;
+	idx_t negative_infinity_count = 0;
+	idx_t positive_infinity_count = 0;
+	idx_t nan_count = 0;
+	//! The number of values, and the extremes of the finite values
+	idx_t count = 0;
+	double min = NumericLimits<double>::Maximum();
+	double max = NumericLimits<double>::Minimum();
+
+	static inline int32_t BucketIndex(double magnitude) {
+		return static_cast<int32_t>(std::ceil(std::log(magnitude) / std::log(GAMMA)));
+	}
+
+	//! The estimate of the values in a bucket, which is within ALPHA of all of them
+	static inline double BucketValue(int32_t index) {
+		return 2 * std::pow(GAMMA, index) / (GAMMA + 1);
+	}
+
+	void Add(double value, idx_t n = 1) {
+		count += n;
+		if (std::isnan(value)) {
+			nan_count += n;
+			return;
+		}
+		if (std::isinf(value)) {
+			(value < 0 ? negative_infinity_count : positive_infinity_count) += n;
+			return;
+		}
+		min = MinValue(min, value);
+		max = MaxValue(max, value);
+		if (value > 0) {
+			positive.Add(BucketIndex(value), n);
+		} else if (value < 0) {
+			negative.Add(BucketIndex(-value), n);
+		} else {
+			zero_count += n;
+		}
+	}
+
+	void Merge(const QuantileSketch &other) {
+		positive.Merge(other.positive);
+		negative.Merge(other.negative);
+		zero_count += other.zero_count;
+		negative_infinity_count += other.negative_infinity_count;
+		positive_infinity_count += other.positive_infinity_count;
+		nan_count += other.nan_count;
+		count += other.count;
+		min = MinValue(min, other.min);
+		max = MaxValue(max, other.max);
+	}
+
+	//! Estimates the value of rank floor(q * (count - 1)) in ascending order (NaN sorts last)
+	double Quantile(double q) const {
+		D_ASSERT(count > 0);
+		auto rank = LossyNumericCast<idx_t>(q * double(count - 1));
+		if (rank < negative_infinity_count) {
+			return -std::numeric_limits<double>::infinity();
+		}
+		rank -= negative_infinity_count;
+		for (idx_t i = negative.counts.size(); i > 0; i--) {
+			if (rank < negative.counts[i - 1]) {
+				return Clamp(-BucketValue(negative.offset + NumericCast<int32_t>(i - 1)));
+			}
+			rank -= negative.counts[i - 1];
+		}
+		if (rank < zero_count) {
+			return 0;
+		}
+		rank -= zero_count;
+		for (idx_t i = 0; i < positive.counts.size(); i++) {
+			if (rank < positive.counts[i]) {
+				return Clamp(BucketValue(positive.offset + NumericCast<int32_t>(i)));
+			}
+			rank -= positive.counts[i];
+		}
+		if (rank < positive_infinity_count) {
+			return std::numeric_limits<double>::infinity();
+		}
+		return std::numeric_limits<double>::quiet_NaN();
+	}
+
+private:
+	//! Estimates never lie outside of the range of the values added (which also keeps them castable to their type)
+	inline double Clamp(double value) const {
+		return MinValue(MaxValue(value, min), max);
+	}
+};
+
+} // namespace duckdb
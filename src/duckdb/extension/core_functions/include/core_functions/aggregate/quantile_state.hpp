@@ -9,10 +9,108 @@
 #pragma once
 
 #include "core_functions/aggregate/quantile_sort_tree.hpp"
+#include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
 #include "SkipList.h"
 
 namespace duckdb {
 
+//! The values buffered by a quantile state. In a spilling hash table they are allocated from its arena, so that
+//! their memory is accounted for (and released) together with the rest of the aggregate state. Otherwise they are
+//! owned by the state, because the arena of e.g. a windowed aggregate is not reset while it is running.
+template <class T>
+struct QuantileValueBuffer {
+	T *values = nullptr;
+	idx_t count = 0;
+	idx_t capacity = 0;
+	bool arena_owned = false;
+
+	bool empty() const { // NOLINT: match the interface of vector
+		return count == 0;
+	}
+	idx_t size() const { // NOLINT
+		return count;
+	}
+	T *data() { // NOLINT
+		return values;
+	}
+	const T *data() const { // NOLINT
+		return values;
+	}
+
+	//! Grows the buffer by "append_count" values, and returns a pointer to the first of them
+	T *Append(AggregateInputData &aggr_input, idx_t append_count) {
+		if (count + append_count > capacity) {
+			auto &allocator = aggr_input.allocator;
+			const auto new_capacity = MaxValue<idx_t>(NextPowerOfTwo(count + append_count), 8);
+			if (!values) {
+				arena_owned = aggr_input.spillable;
+			}
+			if (!arena_owned) {
+				auto &heap = allocator.GetAllocator();
+				auto new_values = heap.AllocateData(new_capacity * sizeof(T));
+				if (values) {
+					memcpy(new_values, values, count * sizeof(T));
+					heap.FreeData(data_ptr_cast(values), capacity * sizeof(T));
+				}
+				values = reinterpret_cast<T *>(new_values);
+			} else if (values) {
+				values = reinterpret_cast<T *>(allocator.ReallocateAligned(
+				    data_ptr_cast(values), AlignValue(capacity * sizeof(T)), new_capacity * sizeof(T)));
+			} else {
+				allocator.AlignNext();
+				values = reinterpret_cast<T *>(allocator.Allocate(AlignValue(new_capacity * sizeof(T))));
+			}
+			capacity = new_capacity;
+		}
+		auto result = values + count;
+		count += append_count;
+		return result;
+	}
+
+	//! Frees the values if they are owned by the state
+	void Release(ArenaAllocator &allocator) {
+		if (values && !arena_owned) {
+			allocator.GetAllocator().FreeData(data_ptr_cast(values), capacity * sizeof(T));
+		}
+		values = nullptr;
+		count = 0;
+		capacity = 0;
+	}
+};
+
+//! (De)serializes the buffered values of a quantile state when it is spilled
+template <class INPUT_TYPE>
+struct QuantileStateValues {
+	static void Serialize(const QuantileValueBuffer<INPUT_TYPE> &v, Serializer &serializer) {
+		serializer.WriteProperty<idx_t>(100, "count", v.size());
+		serializer.WriteProperty(101, "values", const_data_ptr_cast(v.data()), v.size() * sizeof(INPUT_TYPE));
+	}
+
+	template <class STATE>
+	static void Deserialize(STATE &state, Deserializer &deserializer, AggregateInputData &aggr_input) {
+		const auto count = deserializer.ReadProperty<idx_t>(100, "count");
+		auto target = count ? state.v.Append(aggr_input, count) : nullptr;
+		deserializer.ReadProperty(101, "values", data_ptr_cast(target), count * sizeof(INPUT_TYPE));
+	}
+};
+
+template <>
+struct QuantileStateValues<string_t> {
+	static void Serialize(const QuantileValueBuffer<string_t> &v, Serializer &serializer) {
+		serializer.WriteList(100, "values", v.size(),
+		                     [&](Serializer::List &list, idx_t i) { list.WriteElement(v.data()[i]); });
+	}
+
+	template <class STATE>
+	static void Deserialize(STATE &state, Deserializer &deserializer, AggregateInputData &aggr_input) {
+		deserializer.ReadList(100, "values", [&](Deserializer::List &list, idx_t) {
+			auto value = list.ReadElement<string>();
+			state.AddElement(string_t(value), aggr_input);
+		});
+	}
+};
+
 struct QuantileOperation {
 	template <class STATE>
 	static void Initialize(STATE &state) {
@@ -33,18 +131,30 @@ struct QuantileOperation {
 	}
 
 	template <class STATE, class OP>
-	static void Combine(const STATE &source, STATE &target, AggregateInputData &) {
+	static void Combine(const STATE &source, STATE &target, AggregateInputData &aggr_input_data) {
 		if (source.v.empty()) {
 			return;
 		}
-		target.v.insert(target.v.end(), source.v.begin(), source.v.end());
+		auto target_values = target.v.Append(aggr_input_data, source.v.size());
+		std::copy(source.v.data(), source.v.data() + source.v.size(), target_values);
 	}
 
 	template <class STATE>
-	static void Destroy(STATE &state, AggregateInputData &) {
+	static void Destroy(STATE &state, AggregateInputData &aggr_input_data) {
+		state.v.Release(aggr_input_data.allocator);
 		state.~STATE();
 	}
 
+	template <class STATE>
+	static void SerializeState(STATE &state, Serializer &serializer, AggregateInputData &) {
+		QuantileStateValues<typename STATE::InputType>::Serialize(state.v, serializer);
+	}
+
+	template <class STATE>
+	static void DeserializeState(STATE &state, Deserializer &deserializer, AggregateInputData &aggr_input) {
+		QuantileStateValues<typename STATE::InputType>::Deserialize(state, deserializer, aggr_input);
+	}
+
 	static bool IgnoreNull() {
 		return true;
 	}
@@ -264,14 +374,14 @@ struct QuantileState {
 	using CursorType = QuantileCursor<INPUT_TYPE>;
 
 	// Regular aggregation
-	vector<INPUT_TYPE> v;
+	QuantileValueBuffer<INPUT_TYPE> v;
 
 	// Window Quantile State
 	unique_ptr<WindowQuantileState<INPUT_TYPE>> window_state;
 	unique_ptr<CursorType> window_cursor;
 
 	void AddElement(INPUT_TYPE element, AggregateInputData &aggr_input) {
-		v.emplace_back(TYPE_OP::Operation(element, aggr_input));
+		*v.Append(aggr_input, 1) = TYPE_OP::Operation(element, aggr_input);
 	}
 
 	bool HasTree() const {
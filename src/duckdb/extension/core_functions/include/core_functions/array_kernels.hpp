@@ -1,107 +0,0 @@
-#pragma once
-#include "duckdb/common/typedefs.hpp"
-#include "duckdb/common/algorithm.hpp"
-#include <cmath>
-
-namespace duckdb {
-
-//-------------------------------------------------------------------------
-// Folding Operations
-//-------------------------------------------------------------------------
-struct InnerProductOp {
-	static constexpr bool ALLOW_EMPTY = true;
-
-	template <class TYPE>
-	static TYPE Operation(const TYPE *lhs_data, const TYPE *rhs_data, const idx_t count) {
-
-		TYPE result = 0;
-
-		auto lhs_ptr = lhs_data;
-		auto rhs_ptr = rhs_data;
-
-		for (idx_t i = 0; i < count; i++) {
-			const auto x = *lhs_ptr++;
-			const auto y = *rhs_ptr++;
-			result += x * y;
-		}
-
-		return result;
-	}
-};
-
-struct NegativeInnerProductOp {
-	static constexpr bool ALLOW_EMPTY = true;
-
-	template <class TYPE>
-	static TYPE Operation(const TYPE *lhs_data, const TYPE *rhs_data, const idx_t count) {
-		return -InnerProductOp::Operation(lhs_data, rhs_data, count);
-	}
-};
-
-struct CosineSimilarityOp {
-	static constexpr bool ALLOW_EMPTY = false;
-
-	template <class TYPE>
-	static TYPE Operation(const TYPE *lhs_data, const TYPE *rhs_data, const idx_t count) {
-
-		TYPE distance = 0;
-		TYPE norm_l = 0;
-		TYPE norm_r = 0;
-
-		auto l_ptr = lhs_data;
-		auto r_ptr = rhs_data;
-
-		for (idx_t i = 0; i < count; i++) {
-			const auto x = *l_ptr++;
-			const auto y = *r_ptr++;
-			distance += x * y;
-			norm_l += x * x;
-			norm_r += y * y;
-		}
-
-		auto similarity = distance / std::sqrt(norm_l * norm_r);
-		return std::max(static_cast<TYPE>(-1.0), std::min(similarity, static_cast<TYPE>(1.0)));
-	}
-};
-
-struct CosineDistanceOp {
-	static constexpr bool ALLOW_EMPTY = false;
-
-	template <class TYPE>
-	static TYPE Operation(const TYPE *lhs_data, const TYPE *rhs_data, const idx_t count) {
-		return static_cast<TYPE>(1.0) - CosineSimilarityOp::Operation(lhs_data, rhs_data, count);
-	}
-};
-
-struct DistanceSquaredOp {
-	static constexpr bool ALLOW_EMPTY = true;
-
-	template <class TYPE>
-	static TYPE Operation(const TYPE *lhs_data, const TYPE *rhs_data, const idx_t count) {
-
-		TYPE distance = 0;
-
-		auto l_ptr = lhs_data;
-		auto r_ptr = rhs_data;
-
-		for (idx_t i = 0; i < count; i++) {
-			const auto x = *l_ptr++;
-			const auto y = *r_ptr++;
-			const auto diff = x - y;
-			distance += diff * diff;
-		}
-
-		return distance;
-	}
-};
-
-struct DistanceOp {
-	static constexpr bool ALLOW_EMPTY = true;
-
-	template <class TYPE>
-	static TYPE Operation(const TYPE *lhs_data, const TYPE *rhs_data, const idx_t count) {
-		return std::sqrt(DistanceSquaredOp::Operation(lhs_data, rhs_data, count));
-	}
-};
-
-} // namespace duckdb
@@ -15,11 +15,9 @@ namespace duckdb {
 //! LambdaExecuteInfo holds information for executing the lambda expression on an input chunk and
 //! a resulting lambda chunk.
 struct LambdaExecuteInfo {
-	LambdaExecuteInfo(ClientContext &context, const Expression &lambda_expr, const DataChunk &args,
+	LambdaExecuteInfo(ExpressionExecutor &expr_executor, const Expression &lambda_expr, const DataChunk &args,
 	                  const bool has_index, const Vector &child_vector)
-	    : has_index(has_index) {
-
-		expr_executor = make_uniq<ExpressionExecutor>(context, lambda_expr);
+	    : expr_executor(expr_executor), has_index(has_index) {
 
 		// get the input types for the input chunk
 		vector<LogicalType> input_types;
@@ -40,7 +38,7 @@ struct LambdaExecuteInfo {
 	};
 
 	//! The expression executor that executes the lambda expression
-	unique_ptr<ExpressionExecutor> expr_executor;
+	ExpressionExecutor &expr_executor;
 	//! The input chunk on which we execute the lambda expression
 	DataChunk input_chunk;
 	//! The chunk holding the result of executing the lambda expression
@@ -183,13 +181,16 @@ LambdaFunctions::GetMutableColumnInfo(vector<LambdaFunctions::ColumnInfo> &data)
 
 void ExecuteExpression(const idx_t elem_cnt, const LambdaFunctions::ColumnInfo &column_info,
                        const vector<LambdaFunctions::ColumnInfo> &column_infos, const Vector &index_vector,
-                       LambdaExecuteInfo &info) {
+                       const optional_idx contiguous_offset, LambdaExecuteInfo &info) {
 
 	info.input_chunk.SetCardinality(elem_cnt);
 	info.lambda_chunk.SetCardinality(elem_cnt);
 
-	// slice the child vector
-	Vector slice(column_info.vector, column_info.sel, elem_cnt);
+	// slice the child vector, the lists of consecutive rows usually follow each other in the child vector,
+	// in which case we can reference a range of it instead of going through a selection vector
+	Vector slice = contiguous_offset.IsValid()
+	                   ? Vector(column_info.vector, contiguous_offset.GetIndex(), contiguous_offset.GetIndex() + elem_cnt)
+	                   : Vector(column_info.vector, column_info.sel, elem_cnt);
 
 	// reference the child vector (and the index vector)
 	if (info.has_index) {
@@ -216,7 +217,7 @@ void ExecuteExpression(const idx_t elem_cnt, const LambdaFunctions::ColumnInfo &
 	}
 
 	// execute the lambda expression
-	info.expr_executor->Execute(info.input_chunk, info.lambda_chunk);
+	info.expr_executor.Execute(info.input_chunk, info.lambda_chunk);
 }
 
 //===--------------------------------------------------------------------===//
@@ -296,7 +297,7 @@ void ExecuteLambda(DataChunk &args, ExpressionState &state, Vector &result) {
 	info.child_vector->ToUnifiedFormat(child_vector_size, child_info.format);
 
 	// get the expression executor
-	LambdaExecuteInfo execute_info(state.GetContext(), *info.lambda_expr, args, info.has_index, *info.child_vector);
+	LambdaExecuteInfo execute_info(*info.expr_executor, *info.lambda_expr, args, info.has_index, *info.child_vector);
 
 	// get list_filter specific info
 	ListFilterInfo list_filter_info;
@@ -304,10 +305,13 @@ void ExecuteLambda(DataChunk &args, ExpressionState &state, Vector &result) {
 
 	// additional index vector
 	Vector index_vector(LogicalType::BIGINT);
+	auto index_data = FlatVector::GetData<int64_t>(index_vector);
 
 	// loop over the child entries and create chunks to be executed by the expression executor
 	idx_t elem_cnt = 0;
 	idx_t offset = 0;
+	// the child offset of the first element of the current chunk, while its elements are contiguous
+	optional_idx contiguous_offset;
 	for (idx_t row_idx = 0; row_idx < info.row_count; row_idx++) {
 
 		auto list_idx = info.list_column_format.sel->get_index(row_idx);
@@ -334,7 +338,8 @@ void ExecuteLambda(DataChunk &args, ExpressionState &state, Vector &result) {
 			if (elem_cnt == STANDARD_VECTOR_SIZE) {
 
 				execute_info.lambda_chunk.Reset();
-				ExecuteExpression(elem_cnt, child_info, info.column_infos, index_vector, execute_info);
+				ExecuteExpression(elem_cnt, child_info, info.column_infos, index_vector, contiguous_offset,
+				                  execute_info);
 				auto &lambda_vector = execute_info.lambda_chunk.data[0];
 
 				FUNCTION_FUNCTOR::AppendResult(result, lambda_vector, elem_cnt, result_entries, list_filter_info,
@@ -344,14 +349,20 @@ void ExecuteLambda(DataChunk &args, ExpressionState &state, Vector &result) {
 
 			// FIXME: reuse same selection vector for inconstant rows
 			// adjust indexes for slicing
-			child_info.sel.set_index(elem_cnt, list_entry.offset + child_idx);
+			const auto child_offset = list_entry.offset + child_idx;
+			if (elem_cnt == 0) {
+				contiguous_offset = child_offset;
+			} else if (contiguous_offset.IsValid() && contiguous_offset.GetIndex() + elem_cnt != child_offset) {
+				contiguous_offset = optional_idx();
+			}
+			child_info.sel.set_index(elem_cnt, child_offset);
 			for (auto &entry : mutable_column_infos) {
 				entry.get().sel.set_index(elem_cnt, row_idx);
 			}
 
 			// set the index vector
 			if (info.has_index) {
-				index_vector.SetValue(elem_cnt, Value::BIGINT(NumericCast<int64_t>(child_idx + 1)));
+				index_data[elem_cnt] = NumericCast<int64_t>(child_idx + 1);
 			}
 
 			elem_cnt++;
@@ -359,7 +370,7 @@ void ExecuteLambda(DataChunk &args, ExpressionState &state, Vector &result) {
 	}
 
 	execute_info.lambda_chunk.Reset();
-	ExecuteExpression(elem_cnt, child_info, info.column_infos, index_vector, execute_info);
+	ExecuteExpression(elem_cnt, child_info, info.column_infos, index_vector, contiguous_offset, execute_info);
 	auto &lambda_vector = execute_info.lambda_chunk.data[0];
 
 	FUNCTION_FUNCTOR::AppendResult(result, lambda_vector, elem_cnt, result_entries, list_filter_info, execute_info);
@@ -403,6 +414,16 @@ unique_ptr<FunctionData> LambdaFunctions::ListLambdaBind(ClientContext &context,
 	return make_uniq<ListLambdaBindData>(bound_function.return_type, std::move(lambda_expr), has_index);
 }
 
+unique_ptr<FunctionLocalState> LambdaFunctions::ListLambdaInitLocalState(ExpressionState &state,
+                                                                        const BoundFunctionExpression &expr,
+                                                                        FunctionData *bind_data) {
+	auto &info = bind_data->Cast<ListLambdaBindData>();
+	if (!info.lambda_expr || !state.HasContext()) {
+		return nullptr;
+	}
+	return make_uniq<ListLambdaLocalState>(state.GetContext(), *info.lambda_expr);
+}
+
 void LambdaFunctions::ListTransformFunction(DataChunk &args, ExpressionState &state, Vector &result) {
 	ExecuteLambda<ListTransformFunctor>(args, state, result);
 }
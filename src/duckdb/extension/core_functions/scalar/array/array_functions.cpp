@@ -1,5 +1,5 @@
 #include "core_functions/scalar/array_functions.hpp"
-#include "core_functions/array_kernels.hpp"
+#include "duckdb/function/scalar/array_kernels.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
 
 namespace duckdb {
@@ -142,6 +142,20 @@ static void ArrayFixedCombine(DataChunk &args, ExpressionState &state, Vector &r
 //------------------------------------------------------------------------------
 // Given two arrays, combine and reduce their elements into a single scalar value.
 
+// Returns true if the vector is a flat or constant vector of arrays without any NULL arrays or elements
+static bool ArrayFoldIsContiguous(Vector &vec, idx_t count, idx_t array_size) {
+	auto &child = ArrayVector::GetEntry(vec);
+	switch (vec.GetVectorType()) {
+	case VectorType::CONSTANT_VECTOR:
+		return !ConstantVector::IsNull(vec) && FlatVector::Validity(child).CheckAllValid(array_size);
+	case VectorType::FLAT_VECTOR:
+		return FlatVector::Validity(vec).CheckAllValid(count) &&
+		       FlatVector::Validity(child).CheckAllValid(count * array_size);
+	default:
+		return false;
+	}
+}
+
 template <class TYPE, class OP>
 static void ArrayGenericFold(DataChunk &args, ExpressionState &state, Vector &result) {
 	const auto &lstate = state.Cast<ExecuteFunctionState>();
@@ -168,6 +182,21 @@ static void ArrayGenericFold(DataChunk &args, ExpressionState &state, Vector &re
 	const auto array_size = ArrayType::GetSize(args.data[0].GetType());
 	D_ASSERT(array_size == ArrayType::GetSize(args.data[1].GetType()));
 
+	if (ArrayFoldIsContiguous(args.data[0], count, array_size) &&
+	    ArrayFoldIsContiguous(args.data[1], count, array_size)) {
+		// Fast path: no NULLs to check per row, and the arrays are laid out back to back (or repeat a constant,
+		// e.g., the query vector of a nearest-neighbor search)
+		const auto lhs_stride = args.data[0].GetVectorType() == VectorType::CONSTANT_VECTOR ? 0 : array_size;
+		const auto rhs_stride = args.data[1].GetVectorType() == VectorType::CONSTANT_VECTOR ? 0 : array_size;
+		for (idx_t i = 0; i < count; i++) {
+			res_data[i] = OP::Operation(lhs_data + i * lhs_stride, rhs_data + i * rhs_stride, array_size);
+		}
+		if (count == 1) {
+			result.SetVectorType(VectorType::CONSTANT_VECTOR);
+		}
+		return;
+	}
+
 	for (idx_t i = 0; i < count; i++) {
 		const auto lhs_idx = lhs_format.sel->get_index(i);
 		const auto rhs_idx = rhs_format.sel->get_index(i);
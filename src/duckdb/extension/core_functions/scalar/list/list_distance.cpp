@@ -1,5 +1,5 @@
 #include "core_functions/scalar/list_functions.hpp"
-#include "core_functions/array_kernels.hpp"
+#include "duckdb/function/scalar/array_kernels.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
 
 namespace duckdb {
@@ -41,6 +41,7 @@ ScalarFunction ListFilterFun::GetFunction() {
 	fun.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
 	fun.serialize = ListLambdaBindData::Serialize;
 	fun.deserialize = ListLambdaBindData::Deserialize;
+	fun.init_local_state = LambdaFunctions::ListLambdaInitLocalState;
 	fun.bind_lambda = ListFilterBindLambda;
 
 	return fun;
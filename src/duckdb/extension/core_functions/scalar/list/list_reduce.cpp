@@ -6,14 +6,17 @@
 namespace duckdb {
 
 struct ReduceExecuteInfo {
-	ReduceExecuteInfo(LambdaFunctions::LambdaInfo &info, ClientContext &context)
-	    : left_slice(make_uniq<Vector>(*info.child_vector)) {
+	explicit ReduceExecuteInfo(LambdaFunctions::LambdaInfo &info)
+	    : left_slice(make_uniq<Vector>(*info.child_vector)),
+	      finished_values(info.lambda_expr->return_type, info.row_count) {
 		SelectionVector left_vector(info.row_count);
 		active_rows.Resize(info.row_count);
 		active_rows.SetAllValid(info.row_count);
 
 		left_sel.Initialize(info.row_count);
 		active_rows_sel.Initialize(info.row_count);
+		finished_sel.Initialize(info.row_count);
+		result_sel.Initialize(info.row_count);
 
 		idx_t reduced_row_idx = 0;
 
@@ -29,6 +32,7 @@ struct ReduceExecuteInfo {
 				// Set the row as invalid and remove it from the active rows.
 				FlatVector::SetNull(info.result, original_row_idx, true);
 				active_rows.SetInvalid(original_row_idx);
+				result_sel.set_index(original_row_idx, 0);
 			}
 		}
 		left_slice->Slice(left_vector, reduced_row_idx);
@@ -41,16 +45,22 @@ struct ReduceExecuteInfo {
 		for (auto &entry : info.column_infos) {
 			input_types.push_back(entry.vector.get().GetType());
 		}
-
-		expr_executor = make_uniq<ExpressionExecutor>(context, *info.lambda_expr);
 	};
 	ValidityMask active_rows;
 	unique_ptr<Vector> left_slice;
-	unique_ptr<ExpressionExecutor> expr_executor;
 	vector<LogicalType> input_types;
 
 	SelectionVector left_sel;
 	SelectionVector active_rows_sel;
+
+	//! The reduced values of all finished rows, in the order in which the rows finished
+	Vector finished_values;
+	//! The number of finished rows
+	idx_t finished_count = 0;
+	//! The left slice entries of the rows finishing in the current iteration
+	SelectionVector finished_sel;
+	//! Maps each (valid) row to its entry in finished_values
+	SelectionVector result_sel;
 };
 
 static bool ExecuteReduce(idx_t loops, ReduceExecuteInfo &execute_info, LambdaFunctions::LambdaInfo &info,
@@ -66,6 +76,7 @@ static bool ExecuteReduce(idx_t loops, ReduceExecuteInfo &execute_info, LambdaFu
 	SelectionVector right_sel;
 	right_sel.Initialize(info.row_count);
 
+	idx_t finished_in_loop = 0;
 	idx_t bits_per_entry = sizeof(idx_t) * 8;
 	for (idx_t entry_idx = 0; original_row_idx < info.row_count; entry_idx++) {
 		if (data[entry_idx] == 0) {
@@ -87,8 +98,9 @@ static bool ExecuteReduce(idx_t loops, ReduceExecuteInfo &execute_info, LambdaFu
 
 			} else {
 				execute_info.active_rows.SetInvalid(original_row_idx);
-				auto val = execute_info.left_slice->GetValue(valid_row_idx);
-				info.result.SetValue(original_row_idx, val);
+				execute_info.finished_sel.set_index(finished_in_loop, valid_row_idx);
+				execute_info.result_sel.set_index(original_row_idx, execute_info.finished_count + finished_in_loop);
+				finished_in_loop++;
 			}
 
 			original_row_idx++;
@@ -96,6 +108,13 @@ static bool ExecuteReduce(idx_t loops, ReduceExecuteInfo &execute_info, LambdaFu
 		}
 	}
 
+	// move the values of the finished rows out of the left slice
+	if (finished_in_loop) {
+		VectorOperations::Copy(*execute_info.left_slice, execute_info.finished_values, execute_info.finished_sel,
+		                       finished_in_loop, 0, execute_info.finished_count);
+		execute_info.finished_count += finished_in_loop;
+	}
+
 	if (reduced_row_idx == 0) {
 		return true;
 	}
@@ -134,7 +153,7 @@ static bool ExecuteReduce(idx_t loops, ReduceExecuteInfo &execute_info, LambdaFu
 
 	result_chunk.Reset();
 	result_chunk.SetCardinality(reduced_row_idx);
-	execute_info.expr_executor->Execute(input_chunk, result_chunk);
+	info.expr_executor->Execute(input_chunk, result_chunk);
 
 	// We need to copy the result into left_slice to avoid data loss due to vector.Reference(...).
 	// Otherwise, we only keep the data of the previous iteration alive, not that of previous iterations.
@@ -151,7 +170,7 @@ void LambdaFunctions::ListReduceFunction(DataChunk &args, ExpressionState &state
 		return;
 	}
 
-	ReduceExecuteInfo execute_info(info, state.GetContext());
+	ReduceExecuteInfo execute_info(info);
 
 	// Since the left slice references the result chunk, we need to create two result chunks.
 	// This means there is always an empty result chunk for the next iteration,
@@ -174,6 +193,18 @@ void LambdaFunctions::ListReduceFunction(DataChunk &args, ExpressionState &state
 		loops++;
 	}
 
+	// scatter the reduced values to their rows, and restore the NULL rows afterwards
+	if (execute_info.finished_count) {
+		VectorOperations::Copy(execute_info.finished_values, info.result, execute_info.result_sel, info.row_count, 0,
+		                       0);
+		for (idx_t row_idx = 0; row_idx < info.row_count; row_idx++) {
+			auto list_column_format_index = info.list_column_format.sel->get_index(row_idx);
+			if (!info.list_column_format.validity.RowIsValid(list_column_format_index)) {
+				FlatVector::SetNull(info.result, row_idx, true);
+			}
+		}
+	}
+
 	if (info.is_all_constant && !info.is_volatile) {
 		info.result.SetVectorType(VectorType::CONSTANT_VECTOR);
 	}
@@ -224,6 +255,7 @@ ScalarFunction ListReduceFun::GetFunction() {
 	fun.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
 	fun.serialize = ListLambdaBindData::Serialize;
 	fun.deserialize = ListLambdaBindData::Deserialize;
+	fun.init_local_state = LambdaFunctions::ListLambdaInitLocalState;
 	fun.bind_lambda = ListReduceBindLambda;
 
 	return fun;
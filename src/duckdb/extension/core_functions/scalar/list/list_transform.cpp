@@ -33,6 +33,7 @@ ScalarFunction ListTransformFun::GetFunction() {
 	fun.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
 	fun.serialize = ListLambdaBindData::Serialize;
 	fun.deserialize = ListLambdaBindData::Deserialize;
+	fun.init_local_state = LambdaFunctions::ListLambdaInitLocalState;
 	fun.bind_lambda = ListTransformBindLambda;
 
 	return fun;
@@ -5,12 +5,88 @@
 #include "duckdb/common/operator/multiply.hpp"
 #include "duckdb/common/types/timestamp.hpp"
 #include "duckdb/common/exception/conversion_exception.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
 #include "unicode/ucal.h"
 
 namespace duckdb {
 
+ICUOffsetCache::ICUOffsetCache(const icu::BasicTimeZone &tz) {
+	lower = Timestamp::FromDatetime(Date::FromDate(MIN_YEAR, 1, 1), dtime_t(0));
+	upper = Timestamp::FromDatetime(Date::FromDate(MAX_YEAR, 1, 1), dtime_t(0));
+	const auto upper_millis = UDate(upper.value / Interval::MICROS_PER_MSEC);
+
+	auto base = UDate(lower.value / Interval::MICROS_PER_MSEC);
+	int32_t raw_offset;
+	int32_t dst_offset;
+	UErrorCode status = U_ZERO_ERROR;
+	tz.getOffset(base, false, raw_offset, dst_offset, status);
+	if (U_FAILURE(status)) {
+		throw InternalException("Unable to get ICU time zone offset.");
+	}
+	offsets.push_back(int64_t(raw_offset + dst_offset) * Interval::MICROS_PER_MSEC);
+
+	icu::TimeZoneTransition transition;
+	while (tz.getNextTransition(base, false, transition)) {
+		base = transition.getTime();
+		if (base >= upper_millis) {
+			break;
+		}
+		tz.getOffset(base, false, raw_offset, dst_offset, status);
+		if (U_FAILURE(status)) {
+			throw InternalException("Unable to get ICU time zone offset.");
+		}
+		// Transitions that only change the name or the split between raw and DST offset do not matter
+		const auto offset = int64_t(raw_offset + dst_offset) * Interval::MICROS_PER_MSEC;
+		if (offset != offsets.back()) {
+			transitions.push_back(int64_t(base) * Interval::MICROS_PER_MSEC);
+			offsets.push_back(offset);
+		}
+	}
+}
+
+shared_ptr<ICUOffsetCache> ICUOffsetCache::Get(const icu::Calendar &calendar) {
+	if (strcmp(calendar.getType(), "gregorian") != 0) {
+		return nullptr;
+	}
+	auto tz = dynamic_cast<const icu::BasicTimeZone *>(&calendar.getTimeZone());
+	if (!tz) {
+		return nullptr;
+	}
+	icu::UnicodeString tz_id;
+	tz->getID(tz_id);
+	string key;
+	tz_id.toUTF8String(key);
+
+	// The transitions only depend on the zone, so every zone is cached once per process
+	static mutex caches_lock;
+	static unordered_map<string, shared_ptr<ICUOffsetCache>> caches;
+	lock_guard<mutex> guard(caches_lock);
+	auto &entry = caches[key];
+	if (!entry) {
+		entry = make_shared_ptr<ICUOffsetCache>(*tz);
+	}
+	return entry;
+}
+
+bool ICUOffsetCache::TryGetInstant(timestamp_t local, timestamp_t &instant) const {
+	// Offsets are less than a day, so a local time whose surrounding days contain no transition has a unique offset.
+	// Local times that are skipped or repeated around a transition are left to the calendar.
+	const auto window = 2 * Interval::MICROS_PER_DAY;
+	if (local.value - window < lower.value || local.value + window >= upper.value) {
+		return false;
+	}
+	const auto span = FindSpan(local.value - window);
+	if (span != FindSpan(local.value + window)) {
+		return false;
+	}
+	instant = timestamp_t(local.value - offsets[span]);
+	return true;
+}
+
 ICUDateFunc::BindData::BindData(const BindData &other)
-    : tz_setting(other.tz_setting), cal_setting(other.cal_setting), calendar(other.calendar->clone()) {
+    : tz_setting(other.tz_setting), cal_setting(other.cal_setting), calendar(other.calendar->clone()),
+      offsets(other.offsets) {
 }
 
 ICUDateFunc::BindData::BindData(const string &tz_setting_p, const string &cal_setting_p)
@@ -55,6 +131,8 @@ void ICUDateFunc::BindData::InitCalendar() {
 	//	The only error here is if we have a non-Gregorian calendar,
 	//	and we just ignore that and hope for the best...
 	ucal_setGregorianChange((UCalendar *)calendar.get(), U_DATE_MIN, &success); // NOLINT
+
+	offsets = ICUOffsetCache::Get(*calendar);
 }
 
 bool ICUDateFunc::BindData::Equals(const FunctionData &other_p) const {
@@ -126,6 +126,132 @@ struct ICUDateTrunc : public ICUDateFunc {
 		calendar->set(UCAL_ERA, era);
 	}
 
+	//	Local time truncations, used with the offset cache
+	typedef timestamp_t (*local_trunc_t)(timestamp_t local);
+
+	static timestamp_t LocalTruncUnit(timestamp_t local, int64_t unit) {
+		auto remainder = local.value % unit;
+		if (remainder < 0) {
+			remainder += unit;
+		}
+		return timestamp_t(local.value - remainder);
+	}
+
+	static timestamp_t LocalTruncMicrosecond(timestamp_t local) {
+		return local;
+	}
+
+	static timestamp_t LocalTruncMillisecond(timestamp_t local) {
+		return LocalTruncUnit(local, Interval::MICROS_PER_MSEC);
+	}
+
+	static timestamp_t LocalTruncSecond(timestamp_t local) {
+		return LocalTruncUnit(local, Interval::MICROS_PER_SEC);
+	}
+
+	static timestamp_t LocalTruncMinute(timestamp_t local) {
+		return LocalTruncUnit(local, Interval::MICROS_PER_MINUTE);
+	}
+
+	static timestamp_t LocalTruncHour(timestamp_t local) {
+		return LocalTruncUnit(local, Interval::MICROS_PER_HOUR);
+	}
+
+	static timestamp_t LocalTruncDay(timestamp_t local) {
+		return LocalTruncUnit(local, Interval::MICROS_PER_DAY);
+	}
+
+	static timestamp_t LocalTruncWeek(timestamp_t local) {
+		return Timestamp::FromDatetime(Date::GetMondayOfCurrentWeek(Timestamp::GetDate(local)), dtime_t(0));
+	}
+
+	static timestamp_t LocalTruncYears(timestamp_t local, int32_t years, int32_t months) {
+		int32_t yyyy, mm, dd;
+		Date::Convert(Timestamp::GetDate(local), yyyy, mm, dd);
+		yyyy = (yyyy / years) * years;
+		mm = ((mm - 1) / months) * months + 1;
+		return Timestamp::FromDatetime(Date::FromDate(yyyy, mm, 1), dtime_t(0));
+	}
+
+	static timestamp_t LocalTruncMonth(timestamp_t local) {
+		return LocalTruncYears(local, 1, 1);
+	}
+
+	static timestamp_t LocalTruncQuarter(timestamp_t local) {
+		return LocalTruncYears(local, 1, 3);
+	}
+
+	static timestamp_t LocalTruncYear(timestamp_t local) {
+		return LocalTruncYears(local, 1, 12);
+	}
+
+	static timestamp_t LocalTruncDecade(timestamp_t local) {
+		return LocalTruncYears(local, 10, 12);
+	}
+
+	static timestamp_t LocalTruncCentury(timestamp_t local) {
+		return LocalTruncYears(local, 100, 12);
+	}
+
+	static timestamp_t LocalTruncMillenium(timestamp_t local) {
+		return LocalTruncYears(local, 1000, 12);
+	}
+
+	static local_trunc_t LocalTruncationFactory(DatePartSpecifier type) {
+		switch (type) {
+		case DatePartSpecifier::MILLENNIUM:
+			return LocalTruncMillenium;
+		case DatePartSpecifier::CENTURY:
+			return LocalTruncCentury;
+		case DatePartSpecifier::DECADE:
+			return LocalTruncDecade;
+		case DatePartSpecifier::YEAR:
+			return LocalTruncYear;
+		case DatePartSpecifier::QUARTER:
+			return LocalTruncQuarter;
+		case DatePartSpecifier::MONTH:
+			return LocalTruncMonth;
+		case DatePartSpecifier::WEEK:
+		case DatePartSpecifier::YEARWEEK:
+			return LocalTruncWeek;
+		case DatePartSpecifier::DAY:
+		case DatePartSpecifier::DOW:
+		case DatePartSpecifier::ISODOW:
+		case DatePartSpecifier::DOY:
+		case DatePartSpecifier::JULIAN_DAY:
+			return LocalTruncDay;
+		case DatePartSpecifier::HOUR:
+			return LocalTruncHour;
+		case DatePartSpecifier::MINUTE:
+			return LocalTruncMinute;
+		case DatePartSpecifier::SECOND:
+		case DatePartSpecifier::EPOCH:
+			return LocalTruncSecond;
+		case DatePartSpecifier::MILLISECONDS:
+			return LocalTruncMillisecond;
+		case DatePartSpecifier::MICROSECONDS:
+			return LocalTruncMicrosecond;
+		default:
+			return nullptr;
+		}
+	}
+
+	static bool TryTruncLocal(const ICUOffsetCache &offsets, local_trunc_t truncator, timestamp_t input,
+	                          timestamp_t &result) {
+		int64_t offset;
+		if (!offsets.TryGetOffset(input, offset)) {
+			return false;
+		}
+		const auto local = truncator(timestamp_t(input.value + offset));
+		if (truncator == LocalTruncMicrosecond || truncator == LocalTruncMillisecond ||
+		    truncator == LocalTruncSecond || truncator == LocalTruncMinute) {
+			//	Sub-hour truncations keep the offset of the input (cf. PreserveOffsets)
+			result = timestamp_t(local.value - offset);
+			return true;
+		}
+		return offsets.TryGetInstant(local, result);
+	}
+
 	template <typename T>
 	static void ICUDateTruncFunction(DataChunk &args, ExpressionState &state, Vector &result) {
 		D_ASSERT(args.ColumnCount() == 2);
@@ -135,6 +261,7 @@ struct ICUDateTrunc : public ICUDateFunc {
 		auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
 		auto &info = func_expr.bind_info->Cast<BindData>();
 		CalendarPtr calendar(info.calendar->clone());
+		auto offsets = info.offsets.get();
 
 		if (part_arg.GetVectorType() == VectorType::CONSTANT_VECTOR) {
 			// Common case of constant part.
@@ -143,9 +270,15 @@ struct ICUDateTrunc : public ICUDateFunc {
 				ConstantVector::SetNull(result, true);
 			} else {
 				const auto specifier = ConstantVector::GetData<string_t>(part_arg)->GetString();
-				auto truncator = TruncationFactory(GetDatePartSpecifier(specifier));
+				const auto part_code = GetDatePartSpecifier(specifier);
+				auto truncator = TruncationFactory(part_code);
+				auto local_truncator = offsets ? LocalTruncationFactory(part_code) : nullptr;
 				UnaryExecutor::Execute<T, timestamp_t>(date_arg, result, args.size(), [&](T input) {
 					if (Timestamp::IsFinite(input)) {
+						timestamp_t truncated;
+						if (local_truncator && TryTruncLocal(*offsets, local_truncator, input, truncated)) {
+							return truncated;
+						}
 						auto micros = SetTime(calendar.get(), input);
 						truncator(calendar.get(), micros);
 						return GetTimeUnsafe(calendar.get(), micros);
@@ -158,7 +291,13 @@ struct ICUDateTrunc : public ICUDateFunc {
 			BinaryExecutor::Execute<string_t, T, timestamp_t>(
 			    part_arg, date_arg, result, args.size(), [&](string_t specifier, T input) {
 				    if (Timestamp::IsFinite(input)) {
-					    auto truncator = TruncationFactory(GetDatePartSpecifier(specifier.GetString()));
+					    const auto part_code = GetDatePartSpecifier(specifier.GetString());
+					    auto local_truncator = offsets ? LocalTruncationFactory(part_code) : nullptr;
+					    timestamp_t truncated;
+					    if (local_truncator && TryTruncLocal(*offsets, local_truncator, input, truncated)) {
+						    return truncated;
+					    }
+					    auto truncator = TruncationFactory(part_code);
 					    auto micros = SetTime(calendar.get(), input);
 					    truncator(calendar.get(), micros);
 					    return GetTimeUnsafe(calendar.get(), micros);
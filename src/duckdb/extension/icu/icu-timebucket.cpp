@@ -129,6 +129,69 @@ struct ICUTimeBucket : public ICUDateFunc {
 		return Add(calendar, truncated_origin, interval_t {static_cast<int32_t>(result_months), 0, 0});
 	}
 
+	//	Bucketing in local time, used with the offset cache.
+	//	The input and the bucket must both be away from offset transitions for the result to match the calendar.
+	static shared_ptr<ICUOffsetCache> GetBucketOffsets(icu::Calendar *calendar, int64_t origin_micros) {
+		auto offsets = ICUOffsetCache::Get(*calendar);
+		timestamp_t origin;
+		if (offsets && !offsets->TryGetInstant(Timestamp::FromEpochMicroSeconds(origin_micros), origin)) {
+			return nullptr;
+		}
+		return offsets;
+	}
+
+	static inline bool TryGetLocal(const ICUOffsetCache &offsets, timestamp_t ts, timestamp_t &ts_local) {
+		int64_t offset;
+		if (!offsets.TryGetOffset(ts, offset)) {
+			return false;
+		}
+		ts_local = timestamp_t(ts.value + offset);
+		timestamp_t instant;
+		return offsets.TryGetInstant(ts_local, instant);
+	}
+
+	static inline bool TryLocalDaysBucket(const ICUOffsetCache &offsets, int32_t bucket_width_days, timestamp_t ts,
+	                                      timestamp_t &result) {
+		const auto max_days = int64_t(ICUOffsetCache::MAX_YEAR - ICUOffsetCache::MIN_YEAR) * Interval::DAYS_PER_YEAR;
+		timestamp_t ts_local;
+		if (bucket_width_days <= 0 || bucket_width_days > max_days || !TryGetLocal(offsets, ts, ts_local)) {
+			return false;
+		}
+		const auto origin_local = DEFAULT_ORIGIN_MICROS_1;
+		const int64_t ts_days = (ts_local.value - origin_local) / Interval::MICROS_PER_DAY;
+		auto result_days = (ts_days / bucket_width_days) * bucket_width_days;
+		auto bucket_local = origin_local + result_days * Interval::MICROS_PER_DAY;
+		if (ts_local.value < bucket_local) {
+			bucket_local -= bucket_width_days * Interval::MICROS_PER_DAY;
+		}
+		return offsets.TryGetInstant(timestamp_t(bucket_local), result);
+	}
+
+	static inline bool TryLocalMonthsBucket(const ICUOffsetCache &offsets, int32_t bucket_width_months, timestamp_t ts,
+	                                        timestamp_t &result) {
+		const auto max_months = int64_t(ICUOffsetCache::MAX_YEAR - ICUOffsetCache::MIN_YEAR) * Interval::MONTHS_PER_YEAR;
+		timestamp_t ts_local;
+		if (bucket_width_months <= 0 || bucket_width_months > max_months || !TryGetLocal(offsets, ts, ts_local)) {
+			return false;
+		}
+		//	The origin is 2000-01-01
+		int32_t yyyy, mm, dd;
+		Date::Convert(Timestamp::GetDate(ts_local), yyyy, mm, dd);
+		const int64_t ts_months = (yyyy - 2000) * Interval::MONTHS_PER_YEAR + (mm - 1);
+		auto result_months = (ts_months / bucket_width_months) * bucket_width_months;
+		if (ts_months < 0 && ts_months % bucket_width_months != 0) {
+			result_months -= bucket_width_months;
+		}
+		auto years = result_months / Interval::MONTHS_PER_YEAR;
+		auto months = result_months % Interval::MONTHS_PER_YEAR;
+		if (months < 0) {
+			--years;
+			months += Interval::MONTHS_PER_YEAR;
+		}
+		const auto bucket_date = Date::FromDate(int32_t(2000 + years), int32_t(months + 1), 1);
+		return offsets.TryGetInstant(Timestamp::FromDatetime(bucket_date, dtime_t(0)), result);
+	}
+
 	template <typename TA, typename TB, typename TR, typename OP>
 	static void ExecuteBinary(DataChunk &args, ExpressionState &state, Vector &result) {
 		D_ASSERT(args.ColumnCount() == 2);
@@ -388,18 +451,30 @@ struct ICUTimeBucket : public ICUDateFunc {
 						    return WidthConvertibleToMicrosBinaryOperator::Operation(bucket_width, ts, calendar);
 					    });
 					break;
-				case BucketWidthType::CONVERTIBLE_TO_DAYS:
+				case BucketWidthType::CONVERTIBLE_TO_DAYS: {
+					auto offsets = GetBucketOffsets(calendar, DEFAULT_ORIGIN_MICROS_1);
 					BinaryExecutor::Execute<interval_t, timestamp_t, timestamp_t>(
 					    bucket_width_arg, ts_arg, result, args.size(), [&](interval_t bucket_width, timestamp_t ts) {
+						    timestamp_t bucket;
+						    if (offsets && TryLocalDaysBucket(*offsets, bucket_width.days, ts, bucket)) {
+							    return bucket;
+						    }
 						    return WidthConvertibleToDaysBinaryOperator::Operation(bucket_width, ts, calendar);
 					    });
 					break;
-				case BucketWidthType::CONVERTIBLE_TO_MONTHS:
+				}
+				case BucketWidthType::CONVERTIBLE_TO_MONTHS: {
+					auto offsets = GetBucketOffsets(calendar, DEFAULT_ORIGIN_MICROS_2);
 					BinaryExecutor::Execute<interval_t, timestamp_t, timestamp_t>(
 					    bucket_width_arg, ts_arg, result, args.size(), [&](interval_t bucket_width, timestamp_t ts) {
+						    timestamp_t bucket;
+						    if (offsets && TryLocalMonthsBucket(*offsets, bucket_width.months, ts, bucket)) {
+							    return bucket;
+						    }
 						    return WidthConvertibleToMonthsBinaryOperator::Operation(bucket_width, ts, calendar);
 					    });
 					break;
+				}
 				case BucketWidthType::UNCLASSIFIED:
 					BinaryExecutor::Execute<interval_t, timestamp_t, timestamp_t>(
 					    bucket_width_arg, ts_arg, result, args.size(), [&](interval_t bucket_width, timestamp_t ts) {
@@ -583,24 +658,36 @@ struct ICUTimeBucket : public ICUDateFunc {
 						                                                                     calendar);
 					    });
 					break;
-				case BucketWidthType::CONVERTIBLE_TO_DAYS:
+				case BucketWidthType::CONVERTIBLE_TO_DAYS: {
 					origin =
 					    ICUDateFunc::FromNaive(calendar, Timestamp::FromEpochMicroSeconds(DEFAULT_ORIGIN_MICROS_1));
+					auto offsets = GetBucketOffsets(calendar, DEFAULT_ORIGIN_MICROS_1);
 					BinaryExecutor::Execute<interval_t, timestamp_t, timestamp_t>(
 					    bucket_width_arg, ts_arg, result, args.size(), [&](interval_t bucket_width, timestamp_t ts) {
+						    timestamp_t bucket;
+						    if (offsets && TryLocalDaysBucket(*offsets, bucket_width.days, ts, bucket)) {
+							    return bucket;
+						    }
 						    return TimeZoneWidthConvertibleToDaysBinaryOperator::Operation(bucket_width, ts, origin,
 						                                                                   calendar);
 					    });
 					break;
-				case BucketWidthType::CONVERTIBLE_TO_MONTHS:
+				}
+				case BucketWidthType::CONVERTIBLE_TO_MONTHS: {
 					origin =
 					    ICUDateFunc::FromNaive(calendar, Timestamp::FromEpochMicroSeconds(DEFAULT_ORIGIN_MICROS_2));
+					auto offsets = GetBucketOffsets(calendar, DEFAULT_ORIGIN_MICROS_2);
 					BinaryExecutor::Execute<interval_t, timestamp_t, timestamp_t>(
 					    bucket_width_arg, ts_arg, result, args.size(), [&](interval_t bucket_width, timestamp_t ts) {
+						    timestamp_t bucket;
+						    if (offsets && TryLocalMonthsBucket(*offsets, bucket_width.months, ts, bucket)) {
+							    return bucket;
+						    }
 						    return TimeZoneWidthConvertibleToMonthsBinaryOperator::Operation(bucket_width, ts, origin,
 						                                                                     calendar);
 					    });
 					break;
+				}
 				case BucketWidthType::UNCLASSIFIED:
 					TernaryExecutor::Execute<interval_t, timestamp_t, string_t, timestamp_t>(
 					    bucket_width_arg, ts_arg, tz_arg, result, args.size(),
@@ -154,9 +154,15 @@ struct ICUFromNaiveTimestamp : public ICUDateFunc {
 		auto &cast_data = parameters.cast_data->Cast<CastData>();
 		auto &info = cast_data.info->Cast<BindData>();
 		CalendarPtr calendar(info.calendar->clone());
+		auto offsets = info.offsets.get();
 
 		UnaryExecutor::Execute<timestamp_t, timestamp_t>(source, result, count, [&](timestamp_t input) {
-			return Operation(calendar.get(), OP::template Operation<timestamp_t, timestamp_t>(input));
+			const auto naive = OP::template Operation<timestamp_t, timestamp_t>(input);
+			timestamp_t instant;
+			if (offsets && offsets->TryGetInstant(naive, instant)) {
+				return instant;
+			}
+			return Operation(calendar.get(), naive);
 		});
 		return true;
 	}
@@ -232,9 +238,15 @@ struct ICUToNaiveTimestamp : public ICUDateFunc {
 		auto &cast_data = parameters.cast_data->Cast<CastData>();
 		auto &info = cast_data.info->Cast<BindData>();
 		CalendarPtr calendar(info.calendar->clone());
+		auto offsets = info.offsets.get();
 
-		UnaryExecutor::Execute<timestamp_t, timestamp_t>(
-		    source, result, count, [&](timestamp_t input) { return Operation(calendar.get(), input); });
+		UnaryExecutor::Execute<timestamp_t, timestamp_t>(source, result, count, [&](timestamp_t input) {
+			int64_t offset;
+			if (offsets && offsets->TryGetOffset(input, offset)) {
+				return timestamp_t(input.value + offset);
+			}
+			return Operation(calendar.get(), input);
+		});
 		return true;
 	}
 
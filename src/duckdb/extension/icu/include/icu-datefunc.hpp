@@ -12,10 +12,47 @@
 
 #include "duckdb/common/enums/date_part_specifier.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "unicode/basictz.h"
 #include "unicode/calendar.h"
 
 namespace duckdb {
 
+//! The UTC offsets of a time zone between MIN_YEAR and MAX_YEAR, built from the transitions of its BasicTimeZone.
+//! Converting an instant in that range to local time is a binary search plus an addition.
+class ICUOffsetCache {
+public:
+	static constexpr int32_t MIN_YEAR = 1900;
+	static constexpr int32_t MAX_YEAR = 2100;
+
+	explicit ICUOffsetCache(const icu::BasicTimeZone &tz);
+
+	//! Gets the (shared) cache of the time zone of the calendar, or nullptr if the calendar is not Gregorian
+	static shared_ptr<ICUOffsetCache> Get(const icu::Calendar &calendar);
+
+	//! Gets the offset in µs at the instant, if the instant is cached
+	inline bool TryGetOffset(timestamp_t instant, int64_t &offset) const {
+		if (instant < lower || instant >= upper) {
+			return false;
+		}
+		offset = offsets[FindSpan(instant.value)];
+		return true;
+	}
+	//! Converts a local time back to an instant, if it is cached and unambiguous
+	bool TryGetInstant(timestamp_t local, timestamp_t &instant) const;
+
+private:
+	inline idx_t FindSpan(int64_t micros) const {
+		return idx_t(std::upper_bound(transitions.begin(), transitions.end(), micros) - transitions.begin());
+	}
+
+	timestamp_t lower;
+	timestamp_t upper;
+	//! The instants (µs) at which the offset changes
+	vector<int64_t> transitions;
+	//! The offset (µs) before the first transition and after each transition
+	vector<int64_t> offsets;
+};
+
 struct ICUDateFunc {
 	using CalendarPtr = duckdb::unique_ptr<icu::Calendar>;
 
@@ -27,6 +64,8 @@ struct ICUDateFunc {
 		string tz_setting;
 		string cal_setting;
 		CalendarPtr calendar;
+		//! The offsets of the time zone, if they can be cached
+		shared_ptr<ICUOffsetCache> offsets;
 
 		bool Equals(const FunctionData &other_p) const override;
 		duckdb::unique_ptr<FunctionData> Copy() const override;
@@ -40,6 +40,9 @@ profiler_settings_t MetricsUtils::GetOptimizerMetrics() {
         MetricsType::OPTIMIZER_MATERIALIZED_CTE,
         MetricsType::OPTIMIZER_SUM_REWRITER,
         MetricsType::OPTIMIZER_LATE_MATERIALIZATION,
+        MetricsType::OPTIMIZER_COMMON_SUBPLAN,
+        MetricsType::OPTIMIZER_AGGREGATE_PUSHDOWN,
+        MetricsType::OPTIMIZER_HNSW_INDEX_SCAN,
     };
 }
 
@@ -112,6 +115,12 @@ MetricsType MetricsUtils::GetOptimizerMetricByType(OptimizerType type) {
             return MetricsType::OPTIMIZER_SUM_REWRITER;
         case OptimizerType::LATE_MATERIALIZATION:
             return MetricsType::OPTIMIZER_LATE_MATERIALIZATION;
+        case OptimizerType::COMMON_SUBPLAN:
+            return MetricsType::OPTIMIZER_COMMON_SUBPLAN;
+        case OptimizerType::AGGREGATE_PUSHDOWN:
+            return MetricsType::OPTIMIZER_AGGREGATE_PUSHDOWN;
+        case OptimizerType::HNSW_INDEX_SCAN:
+            return MetricsType::OPTIMIZER_HNSW_INDEX_SCAN;
        default:
             throw InternalException("OptimizerType %s cannot be converted to a MetricsType", EnumUtil::ToString(type));
     };
@@ -173,6 +182,12 @@ OptimizerType MetricsUtils::GetOptimizerTypeByMetric(MetricsType type) {
             return OptimizerType::SUM_REWRITER;
         case MetricsType::OPTIMIZER_LATE_MATERIALIZATION:
             return OptimizerType::LATE_MATERIALIZATION;
+        case MetricsType::OPTIMIZER_COMMON_SUBPLAN:
+            return OptimizerType::COMMON_SUBPLAN;
+        case MetricsType::OPTIMIZER_AGGREGATE_PUSHDOWN:
+            return OptimizerType::AGGREGATE_PUSHDOWN;
+        case MetricsType::OPTIMIZER_HNSW_INDEX_SCAN:
+            return OptimizerType::HNSW_INDEX_SCAN;
     default:
             return OptimizerType::INVALID;
     };
@@ -207,6 +222,9 @@ bool MetricsUtils::IsOptimizerMetric(MetricsType type) {
         case MetricsType::OPTIMIZER_MATERIALIZED_CTE:
         case MetricsType::OPTIMIZER_SUM_REWRITER:
         case MetricsType::OPTIMIZER_LATE_MATERIALIZATION:
+        case MetricsType::OPTIMIZER_COMMON_SUBPLAN:
+        case MetricsType::OPTIMIZER_AGGREGATE_PUSHDOWN:
+        case MetricsType::OPTIMIZER_HNSW_INDEX_SCAN:
             return true;
         default:
             return false;
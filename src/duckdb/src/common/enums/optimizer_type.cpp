@@ -39,6 +39,9 @@ static const DefaultOptimizerType internal_optimizer_types[] = {
     {"materialized_cte", OptimizerType::MATERIALIZED_CTE},
     {"sum_rewriter", OptimizerType::SUM_REWRITER},
     {"late_materialization", OptimizerType::LATE_MATERIALIZATION},
+    {"common_subplan", OptimizerType::COMMON_SUBPLAN},
+    {"aggregate_pushdown", OptimizerType::AGGREGATE_PUSHDOWN},
+    {"hnsw_index_scan", OptimizerType::HNSW_INDEX_SCAN},
     {nullptr, OptimizerType::INVALID}};
 
 string OptimizerTypeToString(OptimizerType type) {
@@ -0,0 +1,15 @@
+#include "duckdb/common/plan_node_counter.hpp"
+
+namespace duckdb {
+
+static thread_local idx_t plan_node_count = 0;
+
+void PlanNodeCounter::Increment(idx_t count) {
+	plan_node_count += count;
+}
+
+idx_t PlanNodeCounter::GetCount() {
+	return plan_node_count;
+}
+
+} // namespace duckdb
@@ -26,6 +26,9 @@ void RowOperations::InitializeStates(TupleDataLayout &layout, Vector &addresses,
 			auto row_idx = sel.get_index(i);
 			auto row = pointers[row_idx];
 			aggr.function.initialize(aggr.function, row + offsets[aggr_idx]);
+			if (aggr.spillable) {
+				Store<AggregateSpillSlot>(AggregateSpillSlot {nullptr, 0, 0}, row + offsets[aggr_idx] + aggr.spill_offset);
+			}
 		}
 		++aggr_idx;
 	}
@@ -50,6 +53,7 @@ void RowOperations::DestroyStates(RowOperationsState &state, TupleDataLayout &la
 void RowOperations::UpdateStates(RowOperationsState &state, AggregateObject &aggr, Vector &addresses,
                                  DataChunk &payload, idx_t arg_idx, idx_t count) {
 	AggregateInputData aggr_input_data(aggr.GetFunctionData(), state.allocator);
+	aggr_input_data.spillable = state.spillable;
 	aggr.function.update(aggr.child_count == 0 ? nullptr : &payload.data[arg_idx], aggr_input_data, aggr.child_count,
 	                     addresses, count);
 }
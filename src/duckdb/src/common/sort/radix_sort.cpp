@@ -3,9 +3,121 @@
 #include "duckdb/common/sort/duckdb_pdqsort.hpp"
 #include "duckdb/common/sort/sort.hpp"
 
+#include <algorithm>
+#include <numeric>
+
 namespace duckdb {
 
-//! Calls std::sort on strings that are tied by their prefix after the radix sort
+//! A string that is tied by its prefix, and the radix sorting row it belongs to
+struct TiedString {
+	data_ptr_t row_ptr;
+	const_data_ptr_t data;
+	idx_t size;
+};
+
+//! Compares two tied strings from byte 'depth' onwards
+static inline bool TiedStringLessThan(const TiedString &l, const TiedString &r, const idx_t depth, const bool desc) {
+	const auto min_size = MinValue(l.size, r.size);
+	int comp_res = min_size > depth ? memcmp(l.data + depth, r.data + depth, min_size - depth) : 0;
+	if (comp_res == 0) {
+		comp_res = l.size < r.size ? -1 : (l.size > r.size ? 1 : 0);
+	}
+	return desc ? comp_res > 0 : comp_res < 0;
+}
+
+//! Comparison-based sort of strings that are tied by their first 'depth' bytes
+static void ComparisonSortTiedStrings(TiedString *strings, const idx_t count, const idx_t depth, const bool desc) {
+	std::sort(strings, strings + count,
+	          [&depth, &desc](const TiedString &l, const TiedString &r) { return TiedStringLessThan(l, r, depth, desc); });
+}
+
+//! MSD radix sort on the bytes of strings that are tied by their first 'depth' bytes, which replaces comparison-based
+//! tie-breaking for strings. Uses an explicit stack because long shared prefixes can lead to deep recursion
+static void RadixSortTiedStrings(data_ptr_t *entry_ptrs, const idx_t count, const idx_t depth, const bool desc,
+                                 const data_ptr_t blob_ptr, const idx_t tie_col_offset, const SortLayout &sort_layout) {
+	const auto row_width = sort_layout.blob_layout.GetRowWidth();
+	auto strings_block = make_unsafe_uniq_array_uninitialized<TiedString>(count);
+	auto temp_block = make_unsafe_uniq_array_uninitialized<TiedString>(count);
+	auto strings = strings_block.get();
+	auto temp = temp_block.get();
+	for (idx_t i = 0; i < count; i++) {
+		auto &entry = strings[i];
+		entry.row_ptr = entry_ptrs[i];
+		const auto string_ptr =
+		    blob_ptr + Load<uint32_t>(entry.row_ptr + sort_layout.comparison_size) * row_width + tie_col_offset;
+		const auto tie_string = Load<string_t>(string_ptr);
+		entry.size = tie_string.GetSize();
+		// Inlined strings must be read from the row, not from the copy we just loaded
+		entry.data = tie_string.IsInlined() ? string_ptr + sizeof(uint32_t) : const_data_ptr_cast(tie_string.GetData());
+	}
+
+	// Bucket 0 holds the strings that end at the current depth, bucket 1 + b the strings with byte b at this depth
+	static constexpr idx_t BUCKET_COUNT = SortConstants::VALUES_PER_RADIX + 1;
+	struct TiedRange {
+		idx_t start;
+		idx_t count;
+		idx_t depth;
+	};
+	vector<TiedRange> ranges;
+	ranges.push_back({0, count, depth});
+	idx_t counts[BUCKET_COUNT];
+	idx_t locations[BUCKET_COUNT];
+	while (!ranges.empty()) {
+		const auto range = ranges.back();
+		ranges.pop_back();
+		auto range_strings = strings + range.start;
+		if (range.count <= SortConstants::INSERTION_SORT_THRESHOLD) {
+			ComparisonSortTiedStrings(range_strings, range.count, range.depth, desc);
+			continue;
+		}
+		// Collect counts
+		memset(counts, 0, sizeof(counts));
+		for (idx_t i = 0; i < range.count; i++) {
+			const auto &entry = range_strings[i];
+			counts[entry.size > range.depth ? 1 + entry.data[range.depth] : 0]++;
+		}
+		if (counts[0] == range.count) {
+			// All strings end here, only their sizes can differ (they may be padded with zero bytes in the prefix)
+			ComparisonSortTiedStrings(range_strings, range.count, range.depth, desc);
+			continue;
+		}
+		idx_t max_count = 0;
+		for (idx_t bucket = 1; bucket < BUCKET_COUNT; bucket++) {
+			max_count = MaxValue(max_count, counts[bucket]);
+		}
+		if (max_count == range.count) {
+			// All strings share this byte too
+			ranges.push_back({range.start, range.count, range.depth + 1});
+			continue;
+		}
+		// Compute locations from counts (in reverse bucket order for descending order)
+		idx_t location = 0;
+		for (idx_t i = 0; i < BUCKET_COUNT; i++) {
+			const auto bucket = desc ? BUCKET_COUNT - 1 - i : i;
+			locations[bucket] = location;
+			location += counts[bucket];
+		}
+		// Re-order the strings and sort the buckets
+		for (idx_t i = 0; i < range.count; i++) {
+			const auto &entry = range_strings[i];
+			temp[locations[entry.size > range.depth ? 1 + entry.data[range.depth] : 0]++] = entry;
+		}
+		memcpy(range_strings, temp, range.count * sizeof(TiedString));
+		if (counts[0] > 1) {
+			ComparisonSortTiedStrings(range_strings + locations[0] - counts[0], counts[0], range.depth, desc);
+		}
+		for (idx_t bucket = 1; bucket < BUCKET_COUNT; bucket++) {
+			if (counts[bucket] > 1) {
+				ranges.push_back({range.start + locations[bucket] - counts[bucket], counts[bucket], range.depth + 1});
+			}
+		}
+	}
+	for (idx_t i = 0; i < count; i++) {
+		entry_ptrs[i] = strings[i].row_ptr;
+	}
+}
+
+//! Sorts rows that are tied by the prefix of a blob column after the radix sort
 static void SortTiedBlobs(BufferManager &buffer_manager, const data_ptr_t dataptr, const idx_t &start, const idx_t &end,
                           const idx_t &tie_col, bool *ties, const data_ptr_t blob_ptr, const SortLayout &sort_layout) {
 	const auto row_width = sort_layout.blob_layout.GetRowWidth();
@@ -23,20 +135,27 @@ static void SortTiedBlobs(BufferManager &buffer_manager, const data_ptr_t datapt
 		entry_ptrs[i - start] = row_ptr;
 		row_ptr += sort_layout.entry_size;
 	}
-	// Slow pointer-based sorting
-	const int order = sort_layout.order_types[tie_col] == OrderType::DESCENDING ? -1 : 1;
+	const bool desc = sort_layout.order_types[tie_col] == OrderType::DESCENDING;
 	const idx_t &col_idx = sort_layout.sorting_to_blob_col.at(tie_col);
 	const auto &tie_col_offset = sort_layout.blob_layout.GetOffsets()[col_idx];
 	auto logical_type = sort_layout.blob_layout.GetTypes()[col_idx];
-	std::sort(entry_ptrs, entry_ptrs + end - start,
-	          [&blob_ptr, &order, &sort_layout, &tie_col_offset, &row_width, &logical_type](const data_ptr_t l,
-	                                                                                        const data_ptr_t r) {
-		          idx_t left_idx = Load<uint32_t>(l + sort_layout.comparison_size);
-		          idx_t right_idx = Load<uint32_t>(r + sort_layout.comparison_size);
-		          data_ptr_t left_ptr = blob_ptr + left_idx * row_width + tie_col_offset;
-		          data_ptr_t right_ptr = blob_ptr + right_idx * row_width + tie_col_offset;
-		          return order * Comparators::CompareVal(left_ptr, right_ptr, logical_type) < 0;
-	          });
+	if (logical_type.InternalType() == PhysicalType::VARCHAR) {
+		// The tied strings share the bytes that are in the radix sorting data: continue with an MSD radix sort
+		const idx_t depth = sort_layout.common_prefix_lengths[tie_col] + sort_layout.prefix_lengths[tie_col];
+		RadixSortTiedStrings(entry_ptrs, end - start, depth, desc, blob_ptr, tie_col_offset, sort_layout);
+	} else {
+		// Slow pointer-based sorting
+		const int order = desc ? -1 : 1;
+		std::sort(entry_ptrs, entry_ptrs + end - start,
+		          [&blob_ptr, &order, &sort_layout, &tie_col_offset, &row_width,
+		           &logical_type](const data_ptr_t l, const data_ptr_t r) {
+			          idx_t left_idx = Load<uint32_t>(l + sort_layout.comparison_size);
+			          idx_t right_idx = Load<uint32_t>(r + sort_layout.comparison_size);
+			          data_ptr_t left_ptr = blob_ptr + left_idx * row_width + tie_col_offset;
+			          data_ptr_t right_ptr = blob_ptr + right_idx * row_width + tie_col_offset;
+			          return order * Comparators::CompareVal(left_ptr, right_ptr, logical_type) < 0;
+		          });
+	}
 	// Re-order
 	auto temp_block = buffer_manager.GetBufferAllocator().Allocate((end - start) * sort_layout.entry_size);
 	data_ptr_t temp_ptr = temp_block.get();
@@ -349,4 +468,55 @@ void LocalSortState::SortInMemory() {
 	}
 }
 
+void LocalSortState::MergeSortedRuns() {
+	auto &sb = *sorted_blocks.back();
+	auto &block = *sb.radix_sorting_data.back();
+	const auto &count = block.count;
+	auto handle = buffer_manager->Pin(block.block);
+	const auto dataptr = handle.Ptr();
+	const auto &entry_size = sort_layout->entry_size;
+	const auto &comparison_size = sort_layout->comparison_size;
+	// Assign an index to each row
+	data_ptr_t idx_dataptr = dataptr + comparison_size;
+	for (uint32_t i = 0; i < count; i++) {
+		Store<uint32_t>(i, idx_dataptr);
+		idx_dataptr += entry_size;
+	}
+	const auto run_count = run_starts.size();
+	if (run_count == 1) {
+		// The rows are already sorted
+		return;
+	}
+	// K-way merge the sorted runs into a temporary block, using a heap of the runs that are not exhausted yet
+	vector<idx_t> positions(run_starts.begin(), run_starts.end());
+	vector<idx_t> ends(run_count);
+	for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+		ends[run_idx] = run_idx + 1 < run_count ? run_starts[run_idx + 1] : count;
+	}
+	auto greater = [&](const idx_t &l, const idx_t &r) {
+		const auto comp_res =
+		    FastMemcmp(dataptr + positions[l] * entry_size, dataptr + positions[r] * entry_size, comparison_size);
+		return comp_res > 0 || (comp_res == 0 && l > r);
+	};
+	vector<idx_t> heap(run_count);
+	std::iota(heap.begin(), heap.end(), 0);
+	std::make_heap(heap.begin(), heap.end(), greater);
+
+	auto temp_block =
+	    buffer_manager->Allocate(MemoryTag::ORDER_BY, MaxValue(count * entry_size, buffer_manager->GetBlockSize()));
+	data_ptr_t target_ptr = temp_block.Ptr();
+	while (!heap.empty()) {
+		std::pop_heap(heap.begin(), heap.end(), greater);
+		const auto run_idx = heap.back();
+		FastMemcpy(target_ptr, dataptr + positions[run_idx] * entry_size, entry_size);
+		target_ptr += entry_size;
+		if (++positions[run_idx] < ends[run_idx]) {
+			std::push_heap(heap.begin(), heap.end(), greater);
+		} else {
+			heap.pop_back();
+		}
+	}
+	memcpy(dataptr, temp_block.Ptr(), count * entry_size);
+}
+
 } // namespace duckdb
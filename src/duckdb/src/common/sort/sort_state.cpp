@@ -42,6 +42,25 @@ idx_t GetNestedSortingColSize(idx_t &col_size, const LogicalType &type) {
 	}
 }
 
+//! Computes the length of the prefix that all strings share from the (truncated) min/max statistics.
+//! Any string between min and max starts with the common prefix of min and max
+static idx_t GetCommonStringPrefixLength(const BaseStatistics &stats) {
+	if (!stats.CanHaveNoNull()) {
+		return 0;
+	}
+	const auto min = StringStats::Min(stats);
+	const auto max = StringStats::Max(stats);
+	idx_t common_prefix_length = 0;
+	while (common_prefix_length < min.size() && common_prefix_length < max.size() &&
+	       min[common_prefix_length] == max[common_prefix_length]) {
+		common_prefix_length++;
+	}
+	if (StringStats::HasMaxStringLength(stats)) {
+		common_prefix_length = MinValue<idx_t>(common_prefix_length, StringStats::MaxStringLength(stats));
+	}
+	return common_prefix_length;
+}
+
 SortLayout::SortLayout(const vector<BoundOrderByNode> &orders)
     : column_count(orders.size()), all_constant(true), comparison_size(0), entry_size(0) {
 	vector<LogicalType> blob_layout_types;
@@ -66,12 +85,16 @@ SortLayout::SortLayout(const vector<BoundOrderByNode> &orders)
 
 		idx_t col_size = has_null.back() ? 1 : 0;
 		prefix_lengths.push_back(0);
+		common_prefix_lengths.push_back(0);
 		if (!TypeIsConstantSize(physical_type) && physical_type != PhysicalType::VARCHAR) {
 			prefix_lengths.back() = GetNestedSortingColSize(col_size, expr.return_type);
 		} else if (physical_type == PhysicalType::VARCHAR) {
 			idx_t size_before = col_size;
+			if (stats.back()) {
+				common_prefix_lengths.back() = GetCommonStringPrefixLength(*stats.back());
+			}
 			if (stats.back() && StringStats::HasMaxStringLength(*stats.back())) {
-				col_size += StringStats::MaxStringLength(*stats.back());
+				col_size += StringStats::MaxStringLength(*stats.back()) - common_prefix_lengths.back();
 				if (col_size > 12) {
 					col_size = 12;
 				} else {
@@ -100,7 +123,8 @@ SortLayout::SortLayout(const vector<BoundOrderByNode> &orders)
 			}
 			if (logical_types[col_idx].InternalType() == PhysicalType::VARCHAR && stats[col_idx] &&
 			    StringStats::HasMaxStringLength(*stats[col_idx])) {
-				idx_t diff = StringStats::MaxStringLength(*stats[col_idx]) - prefix_lengths[col_idx];
+				idx_t diff = StringStats::MaxStringLength(*stats[col_idx]) - common_prefix_lengths[col_idx] -
+				             prefix_lengths[col_idx];
 				if (diff > 0) {
 					// Increase all sizes accordingly
 					idx_t increase = MinValue(bytes_to_fill, diff);
@@ -144,6 +168,7 @@ SortLayout SortLayout::GetPrefixComparisonLayout(idx_t num_prefix_cols) const {
 		result.column_sizes.push_back(column_sizes[col_idx]);
 
 		result.prefix_lengths.push_back(prefix_lengths[col_idx]);
+		result.common_prefix_lengths.push_back(common_prefix_lengths[col_idx]);
 		result.stats.push_back(stats[col_idx]);
 		result.has_null.push_back(has_null[col_idx]);
 	}
@@ -153,7 +178,7 @@ SortLayout SortLayout::GetPrefixComparisonLayout(idx_t num_prefix_cols) const {
 	return result;
 }
 
-LocalSortState::LocalSortState() : initialized(false) {
+LocalSortState::LocalSortState() : initialized(false), detect_sorted_runs(false), has_sorted_runs(false) {
 	if (!Radix::IsLittleEndian()) {
 		throw NotImplementedException("Sorting is not supported on big endian architectures");
 	}
@@ -182,6 +207,13 @@ void LocalSortState::Initialize(GlobalSortState &global_sort_state, BufferManage
 	entries_per_block = RowDataCollection::EntriesPerBlock(payload_row_width, block_size);
 	payload_data = make_uniq<RowDataCollection>(*buffer_manager, entries_per_block, payload_row_width);
 	payload_heap = make_uniq<RowDataCollection>(*buffer_manager, block_size, 1U, true);
+
+	// Sorted run detection - only if the comparison keys fully determine the order (no ties to break on blobs)
+	detect_sorted_runs = detect_sorted_runs && sort_layout->all_constant;
+	if (detect_sorted_runs) {
+		last_key = make_unsafe_uniq_array_uninitialized<data_t>(sort_layout->comparison_size);
+	}
+	ResetSortedRuns();
 	initialized = true;
 }
 
@@ -196,7 +228,11 @@ void LocalSortState::SinkChunk(DataChunk &sort, DataChunk &payload) {
 		bool desc = sort_layout->order_types[sort_col] == OrderType::DESCENDING;
 		RowOperations::RadixScatter(sort.data[sort_col], sort.size(), sel_ptr, sort.size(), data_pointers, desc,
 		                            has_null, nulls_first, sort_layout->prefix_lengths[sort_col],
-		                            sort_layout->column_sizes[sort_col]);
+		                            sort_layout->column_sizes[sort_col], 0,
+		                            sort_layout->common_prefix_lengths[sort_col]);
+	}
+	if (has_sorted_runs) {
+		TrackSortedRuns(data_pointers, sort.size());
 	}
 
 	// Also fully serialize blob sorting columns (to be able to break ties
@@ -255,11 +291,48 @@ void LocalSortState::Sort(GlobalSortState &global_sort_state, bool reorder_heap)
 	auto payload_block = ConcatenateBlocks(*payload_data);
 	sb.payload_data->data_blocks.push_back(std::move(payload_block));
 	// Now perform the actual sort
-	SortInMemory();
+	if (has_sorted_runs) {
+		MergeSortedRuns();
+	} else {
+		SortInMemory();
+	}
+	ResetSortedRuns();
 	// Re-order before the merge sort
 	ReOrder(global_sort_state, reorder_heap);
 }
 
+void LocalSortState::ResetSortedRuns() {
+	has_sorted_runs = detect_sorted_runs;
+	run_starts.clear();
+	run_starts.push_back(0);
+}
+
+void LocalSortState::TrackSortedRuns(data_ptr_t key_locations[], idx_t count) {
+	D_ASSERT(sort_layout->all_constant);
+	if (count == 0) {
+		return;
+	}
+	// The radix scatter has moved the key locations past the comparison keys
+	const auto &comparison_size = sort_layout->comparison_size;
+	const idx_t offset = radix_sorting_data->count - count;
+	for (idx_t i = 0; i < count; i++) {
+		if (offset + i == 0) {
+			continue;
+		}
+		const auto prev_key = i == 0 ? last_key.get() : key_locations[i - 1] - comparison_size;
+		if (FastMemcmp(prev_key, key_locations[i] - comparison_size, comparison_size) <= 0) {
+			continue;
+		}
+		// The row is smaller than the previous row: a new sorted run starts here
+		if (run_starts.size() == SortConstants::MAX_SORTED_RUNS) {
+			has_sorted_runs = false;
+			return;
+		}
+		run_starts.push_back(offset + i);
+	}
+	memcpy(last_key.get(), key_locations[count - 1] - comparison_size, comparison_size);
+}
+
 unique_ptr<RowDataBlock> LocalSortState::ConcatenateBlocks(RowDataCollection &row_data) {
 	//	Don't copy and delete if there is only one block.
 	if (row_data.blocks.size() == 1) {
@@ -437,18 +510,17 @@ void GlobalSortState::InitializeMergeRound() {
 	// If we reverse this list, the blocks that were merged last will be merged first in the next round
 	// These are still in memory, therefore this reduces the amount of read/write to disk!
 	std::reverse(sorted_blocks.begin(), sorted_blocks.end());
-	// Uneven number of blocks - keep one on the side
-	if (sorted_blocks.size() % 2 == 1) {
-		odd_one_out = std::move(sorted_blocks.back());
-		sorted_blocks.pop_back();
-	}
-	// Init merge path path indices
-	pair_idx = 0;
-	num_pairs = sorted_blocks.size() / 2;
-	l_start = 0;
-	r_start = 0;
+	// Divide the blocks into groups of (almost) equal size that are each merged into a single block
+	const idx_t num_groups = (sorted_blocks.size() + MERGE_FAN_IN - 1) / MERGE_FAN_IN;
+	group_offsets.clear();
+	for (idx_t g_idx = 0; g_idx <= num_groups; g_idx++) {
+		group_offsets.push_back(g_idx * sorted_blocks.size() / num_groups);
+	}
+	// Init merge path indices
+	group_idx = 0;
+	run_starts.assign(num_groups ? group_offsets[1] - group_offsets[0] : 0, 0);
 	// Allocate room for merge results
-	for (idx_t p_idx = 0; p_idx < num_pairs; p_idx++) {
+	for (idx_t g_idx = 0; g_idx < num_groups; g_idx++) {
 		sorted_blocks_temp.emplace_back();
 	}
 }
@@ -460,10 +532,6 @@ void GlobalSortState::CompleteMergeRound(bool keep_radix_data) {
 		sorted_blocks.back()->AppendSortedBlocks(sorted_block_vector);
 	}
 	sorted_blocks_temp.clear();
-	if (odd_one_out) {
-		sorted_blocks.push_back(std::move(odd_one_out));
-		odd_one_out = nullptr;
-	}
 	// Only one block left: Done!
 	if (sorted_blocks.size() == 1 && !keep_radix_data) {
 		sorted_blocks[0]->radix_sorting_data.clear();
@@ -112,6 +112,29 @@ void HyperLogLog::Update(Vector &input, Vector &hash_vec, const idx_t count) {
 	}
 }
 
+void HyperLogLog::ToBlob(data_ptr_t target) const {
+	target[0] = static_cast<uint8_t>(HLLStorageType::HLL_V2);
+	memcpy(target + 1, k, sizeof(k));
+}
+
+void HyperLogLog::MergeBlob(const_data_ptr_t blob, idx_t size) {
+	if (size != BLOB_SIZE || blob[0] != static_cast<uint8_t>(HLLStorageType::HLL_V2)) {
+		throw InvalidInputException("Invalid HyperLogLog sketch: expected a BLOB of %llu bytes created by hll_state",
+		                            BLOB_SIZE);
+	}
+	// Count() uses the registers as indexes, so validate all of them before merging any
+	const auto registers = blob + 1;
+	for (idx_t i = 0; i < M; ++i) {
+		if (registers[i] > Q + 1) {
+			throw InvalidInputException("Invalid HyperLogLog sketch: register %llu has value %d, expected at most %llu",
+			                            i, registers[i], Q + 1);
+		}
+	}
+	for (idx_t i = 0; i < M; ++i) {
+		k[i] = MaxValue<uint8_t>(k[i], registers[i]);
+	}
+}
+
 unique_ptr<HyperLogLog> HyperLogLog::Copy() const {
 	auto result = make_uniq<HyperLogLog>();
 	memcpy(result->k, this->k, sizeof(k));
@@ -7,28 +7,25 @@
 
 namespace duckdb {
 
-AdaptiveFilter::AdaptiveFilter(const Expression &expr) : observe_interval(10), execute_interval(20), warmup(true) {
+constexpr double AdaptiveFilter::SMOOTHING_FACTOR;
+constexpr idx_t AdaptiveFilter::EXPLORE_INTERVAL;
+
+AdaptiveFilter::AdaptiveFilter(const Expression &expr) {
 	auto &conj_expr = expr.Cast<BoundConjunctionExpression>();
 	D_ASSERT(conj_expr.children.size() > 1);
+	is_disjunction = conj_expr.GetExpressionType() == ExpressionType::CONJUNCTION_OR;
 	for (idx_t idx = 0; idx < conj_expr.children.size(); idx++) {
 		permutation.push_back(idx);
 		if (conj_expr.children[idx]->CanThrow()) {
 			disable_permutations = true;
 		}
-		if (idx != conj_expr.children.size() - 1) {
-			swap_likeliness.push_back(100);
-		}
 	}
-	right_random_border = 100 * (conj_expr.children.size() - 1);
+	statistics.resize(permutation.size());
 }
 
-AdaptiveFilter::AdaptiveFilter(const TableFilterSet &table_filters)
-    : observe_interval(10), execute_interval(20), warmup(true) {
+AdaptiveFilter::AdaptiveFilter(const TableFilterSet &table_filters) {
 	permutation = ExpressionHeuristics::GetInitialOrder(table_filters);
-	for (idx_t idx = 1; idx < table_filters.filters.size(); idx++) {
-		swap_likeliness.push_back(100);
-	}
-	right_random_border = 100 * (table_filters.filters.size() - 1);
+	statistics.resize(permutation.size());
 }
 
 AdaptiveFilterState AdaptiveFilter::BeginFilter() const {
@@ -37,76 +34,63 @@ AdaptiveFilterState AdaptiveFilter::BeginFilter() const {
 	}
 	AdaptiveFilterState state;
 	state.start_time = high_resolution_clock::now();
+	state.adaptive = true;
 	return state;
 }
 
-void AdaptiveFilter::EndFilter(AdaptiveFilterState state) {
-	if (permutation.size() <= 1 || disable_permutations) {
-		// nothing to permute
+void AdaptiveFilter::EndPredicate(AdaptiveFilterState &state, idx_t predicate_idx, idx_t input_count,
+                                  idx_t output_count) {
+	if (!state.adaptive) {
 		return;
 	}
 	auto end_time = high_resolution_clock::now();
-	AdaptRuntimeStatistics(duration_cast<duration<double>>(end_time - state.start_time).count());
-}
-
-void AdaptiveFilter::AdaptRuntimeStatistics(double duration) {
-	iteration_count++;
-	runtime_sum += duration;
-
-	D_ASSERT(!disable_permutations);
-	if (!warmup) {
-		// the last swap was observed
-		if (observe && iteration_count == observe_interval) {
-			// keep swap if runtime decreased, else reverse swap
-			if (prev_mean - (runtime_sum / static_cast<double>(iteration_count)) <= 0) {
-				// reverse swap because runtime didn't decrease
-				std::swap(permutation[swap_idx], permutation[swap_idx + 1]);
-
-				// decrease swap likeliness, but make sure there is always a small likeliness left
-				if (swap_likeliness[swap_idx] > 1) {
-					swap_likeliness[swap_idx] /= 2;
-				}
-			} else {
-				// keep swap because runtime decreased, reset likeliness
-				swap_likeliness[swap_idx] = 100;
-			}
-			observe = false;
-
-			// reset values
-			iteration_count = 0;
-			runtime_sum = 0.0;
-		} else if (!observe && iteration_count == execute_interval) {
-			// save old mean to evaluate swap
-			prev_mean = runtime_sum / static_cast<double>(iteration_count);
-
-			// get swap index and swap likeliness
-			// a <= i <= b
-			auto random_number = generator.NextRandomInteger(1, NumericCast<uint32_t>(right_random_border));
-
-			swap_idx = random_number / 100;                    // index to be swapped
-			idx_t likeliness = random_number - 100 * swap_idx; // random number between [0, 100)
+	auto elapsed = duration_cast<duration<double>>(end_time - state.start_time).count();
+	state.start_time = end_time;
+	if (input_count == 0) {
+		return;
+	}
+	D_ASSERT(output_count <= input_count);
+	auto cost = elapsed / static_cast<double>(input_count);
+	auto selectivity = static_cast<double>(output_count) / static_cast<double>(input_count);
 
-			// check if swap is going to happen
-			if (swap_likeliness[swap_idx] > likeliness) { // always true for the first swap of an index
-				// swap
-				std::swap(permutation[swap_idx], permutation[swap_idx + 1]);
+	auto &stats = statistics[predicate_idx];
+	if (!stats.observed) {
+		stats.cost = cost;
+		stats.selectivity = selectivity;
+		stats.observed = true;
+		return;
+	}
+	stats.cost += SMOOTHING_FACTOR * (cost - stats.cost);
+	stats.selectivity += SMOOTHING_FACTOR * (selectivity - stats.selectivity);
+}
 
-				// observe whether swap will be applied
-				observe = true;
-			}
+double AdaptiveFilter::GetRank(idx_t predicate_idx) const {
+	auto &stats = statistics[predicate_idx];
+	if (!stats.observed) {
+		// predicates that have never been evaluated go first so that we learn about them
+		return NumericLimits<double>::Maximum();
+	}
+	// guard against timer resolution - a predicate is never free
+	auto cost = MaxValue<double>(stats.cost, 1e-12);
+	auto benefit = is_disjunction ? stats.selectivity : 1.0 - stats.selectivity;
+	return benefit / cost;
+}
 
-			// reset values
-			iteration_count = 0;
-			runtime_sum = 0.0;
-		}
-	} else {
-		if (iteration_count == 5) {
-			// initially set all values
-			iteration_count = 0;
-			runtime_sum = 0.0;
-			observe = false;
-			warmup = false;
-		}
+void AdaptiveFilter::EndFilter(AdaptiveFilterState state) {
+	if (!state.adaptive) {
+		// nothing to permute
+		return;
+	}
+	iteration_count++;
+	// order the predicates by descending rank - ties keep their current relative order
+	std::stable_sort(permutation.begin(), permutation.end(),
+	                 [&](idx_t a, idx_t b) { return GetRank(a) > GetRank(b); });
+	if (iteration_count % EXPLORE_INTERVAL == 0) {
+		// periodically evaluate a predicate first: predicates late in the order are only evaluated on the tuples that
+		// passed all previous predicates (or not at all), so their statistics can become stale
+		auto explore = std::find(permutation.begin(), permutation.end(), explore_idx % permutation.size());
+		std::rotate(permutation.begin(), explore, explore + 1);
+		explore_idx++;
 	}
 }
 
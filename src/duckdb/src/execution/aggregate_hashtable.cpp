@@ -16,6 +16,122 @@ namespace duckdb {
 
 using ValidityBytes = TupleDataLayout::ValidityBytes;
 
+static vector<LogicalType> SpillableAggregateTypes(const TupleDataLayout &layout) {
+	vector<LogicalType> types;
+	for (auto &aggr : layout.GetAggregates()) {
+		if (aggr.spillable) {
+			types.emplace_back(LogicalType::BLOB);
+		}
+	}
+	return types;
+}
+
+SpilledAggregateStates::SpilledAggregateStates(BufferManager &buffer_manager, const TupleDataLayout &layout)
+    : payloads(buffer_manager, SpillableAggregateTypes(layout)) {
+	payloads.InitializeAppend(append_state);
+	payload_chunk.Initialize(Allocator::DefaultAllocator(), payloads.Types());
+}
+
+void SpilledAggregateStates::Spill(RowOperationsState &state, const TupleDataLayout &layout, Vector &row_locations,
+                                   idx_t count) {
+	if (count == 0) {
+		return;
+	}
+	auto rows = FlatVector::GetData<data_ptr_t>(row_locations);
+	auto &offsets = layout.GetOffsets();
+	auto &aggregates = layout.GetAggregates();
+
+	payload_chunk.Reset();
+	// ColumnDataCollection::Append fills up the last chunk before it allocates a new one, so we know where each of the
+	// payloads will be stored
+	const auto first_position = payloads.Count();
+	Vector states(LogicalType::POINTER);
+	auto state_data = FlatVector::GetData<data_ptr_t>(states);
+	idx_t column_idx = 0;
+	for (idx_t aggr_idx = 0; aggr_idx < aggregates.size(); aggr_idx++) {
+		auto &aggr = aggregates[aggr_idx];
+		if (!aggr.spillable) {
+			continue;
+		}
+		const auto state_offset = offsets[layout.ColumnCount() + aggr_idx];
+		for (idx_t i = 0; i < count; i++) {
+			state_data[i] = rows[i] + state_offset;
+			D_ASSERT(!Load<AggregateSpillSlot>(state_data[i] + aggr.spill_offset).spilled_states);
+		}
+
+		AggregateInputData aggr_input_data(aggr.GetFunctionData(), state.allocator);
+		aggr.function.state_serialize(states, aggr_input_data, payload_chunk.data[column_idx], count);
+
+		// Release the payloads, and leave empty states that refer to the serialized payloads
+		if (aggr.function.destructor) {
+			aggr.function.destructor(states, aggr_input_data, count);
+		}
+		for (idx_t i = 0; i < count; i++) {
+			aggr.function.initialize(aggr.function, state_data[i]);
+			const auto position = first_position + i;
+			AggregateSpillSlot slot {this, NumericCast<uint32_t>(position / STANDARD_VECTOR_SIZE),
+			                         NumericCast<uint32_t>(position % STANDARD_VECTOR_SIZE)};
+			Store<AggregateSpillSlot>(slot, state_data[i] + aggr.spill_offset);
+		}
+		column_idx++;
+	}
+	payload_chunk.SetCardinality(count);
+	payloads.Append(append_state, payload_chunk);
+}
+
+void SpilledAggregateStates::Reload(RowOperationsState &state, const TupleDataLayout &layout, Vector &row_locations,
+                                    idx_t count) {
+	auto rows = FlatVector::GetData<data_ptr_t>(row_locations);
+	auto &offsets = layout.GetOffsets();
+	auto &aggregates = layout.GetAggregates();
+
+	// Spilled rows are mostly combined in the order they were spilled, so we cache the last fetched chunk
+	optional_ptr<SpilledAggregateStates> fetched_states;
+	idx_t fetched_chunk_idx = DConstants::INVALID_INDEX;
+	DataChunk fetched;
+
+	Vector states(LogicalType::POINTER);
+	auto state_data = FlatVector::GetData<data_ptr_t>(states);
+	idx_t column_idx = 0;
+	for (idx_t aggr_idx = 0; aggr_idx < aggregates.size(); aggr_idx++) {
+		auto &aggr = aggregates[aggr_idx];
+		if (!aggr.spillable) {
+			continue;
+		}
+		const auto state_offset = offsets[layout.ColumnCount() + aggr_idx];
+		Vector serialized(LogicalType::BLOB);
+		auto serialized_data = FlatVector::GetData<string_t>(serialized);
+		idx_t spilled_count = 0;
+		for (idx_t i = 0; i < count; i++) {
+			const auto state_ptr = rows[i] + state_offset;
+			const auto slot = Load<AggregateSpillSlot>(state_ptr + aggr.spill_offset);
+			if (!slot.spilled_states) {
+				continue;
+			}
+			const idx_t chunk_idx = slot.chunk_index;
+			if (slot.spilled_states != fetched_states.get() || chunk_idx != fetched_chunk_idx) {
+				if (fetched.ColumnCount() == 0) {
+					fetched.Initialize(Allocator::DefaultAllocator(), slot.spilled_states->payloads.Types());
+				} else {
+					fetched.Reset();
+				}
+				slot.spilled_states->payloads.FetchChunk(chunk_idx, fetched);
+				fetched_states = slot.spilled_states;
+				fetched_chunk_idx = chunk_idx;
+			}
+			D_ASSERT(slot.row_index < fetched.size());
+			const auto &payload = FlatVector::GetData<string_t>(fetched.data[column_idx])[slot.row_index];
+			serialized_data[spilled_count] = StringVector::AddStringOrBlob(serialized, payload);
+			state_data[spilled_count++] = state_ptr;
+			Store<AggregateSpillSlot>(AggregateSpillSlot {nullptr, 0, 0}, state_ptr + aggr.spill_offset);
+		}
+
+		AggregateInputData aggr_input_data(aggr.GetFunctionData(), state.allocator);
+		aggr.function.state_deserialize(serialized, aggr_input_data, states, spilled_count);
+		column_idx++;
+	}
+}
+
 GroupedAggregateHashTable::GroupedAggregateHashTable(ClientContext &context, Allocator &allocator,
                                                      vector<LogicalType> group_types, vector<LogicalType> payload_types,
                                                      const vector<BoundAggregateExpression *> &bindings,
@@ -47,6 +163,12 @@ GroupedAggregateHashTable::GroupedAggregateHashTable(ClientContext &context, All
 	// Append hash column to the end and initialise the row layout
 	group_types_p.emplace_back(LogicalType::HASH);
 	layout.Initialize(std::move(group_types_p), std::move(aggregate_objects_p));
+	for (auto &aggr : layout.GetAggregates()) {
+		if (aggr.spillable) {
+			spillable_allocator = make_shared_ptr<ArenaAllocator>(allocator);
+			break;
+		}
+	}
 
 	hash_offset = layout.GetOffsets()[layout.ColumnCount() - 1];
 
@@ -146,6 +268,38 @@ shared_ptr<ArenaAllocator> GroupedAggregateHashTable::GetAggregateAllocator() {
 	return aggregate_allocator;
 }
 
+shared_ptr<ArenaAllocator> GroupedAggregateHashTable::GetSpillableAllocator() {
+	return spillable_allocator;
+}
+
+shared_ptr<SpilledAggregateStates> GroupedAggregateHashTable::GetSpilledStates() {
+	return spilled_states;
+}
+
+void GroupedAggregateHashTable::SpillStates(PartitionedTupleData &data) {
+	if (!spillable_allocator || data.Count() == 0) {
+		return;
+	}
+	if (!spilled_states) {
+		spilled_states = make_shared_ptr<SpilledAggregateStates>(buffer_manager, layout);
+	}
+
+	RowOperationsState row_state(*spillable_allocator);
+	for (auto &data_collection : data.GetPartitions()) {
+		if (data_collection->Count() == 0) {
+			continue;
+		}
+		TupleDataChunkIterator iterator(*data_collection, TupleDataPinProperties::UNPIN_AFTER_DONE, false);
+		auto &row_locations = iterator.GetChunkState().row_locations;
+		do {
+			spilled_states->Spill(row_state, layout, row_locations, iterator.GetCurrentChunkCount());
+		} while (iterator.Next());
+	}
+
+	// No state refers to the payloads allocated by the spillable aggregates anymore
+	spillable_allocator->Reset();
+}
+
 GroupedAggregateHashTable::~GroupedAggregateHashTable() {
 	Destroy();
 }
@@ -493,8 +647,13 @@ void GroupedAggregateHashTable::UpdateAggregates(DataChunk &payload, const unsaf
 	idx_t filter_idx = 0;
 	idx_t payload_idx = 0;
 	RowOperationsState row_state(*aggregate_allocator);
+	unique_ptr<RowOperationsState> spillable_row_state;
+	if (spillable_allocator) {
+		spillable_row_state = make_uniq<RowOperationsState>(*spillable_allocator, true);
+	}
 	for (idx_t i = 0; i < aggregates.size(); i++) {
 		auto &aggr = aggregates[i];
+		auto &aggr_row_state = aggr.spillable ? *spillable_row_state : row_state;
 		if (filter_idx >= filter.size() || i < filter[filter_idx]) {
 			// Skip all the aggregates that are not in the filter
 			payload_idx += aggr.child_count;
@@ -504,10 +663,10 @@ void GroupedAggregateHashTable::UpdateAggregates(DataChunk &payload, const unsaf
 		D_ASSERT(i == filter[filter_idx]);
 
 		if (aggr.aggr_type != AggregateType::DISTINCT && aggr.filter) {
-			RowOperations::UpdateFilteredStates(row_state, filter_set.GetFilterData(i), aggr, state.addresses, payload,
-			                                    payload_idx);
+			RowOperations::UpdateFilteredStates(aggr_row_state, filter_set.GetFilterData(i), aggr, state.addresses,
+			                                    payload, payload_idx);
 		} else {
-			RowOperations::UpdateStates(row_state, aggr, state.addresses, payload, payload_idx, payload.size());
+			RowOperations::UpdateStates(aggr_row_state, aggr, state.addresses, payload, payload_idx, payload.size());
 		}
 
 		// Move to the next aggregate
@@ -814,6 +973,9 @@ void GroupedAggregateHashTable::Combine(GroupedAggregateHashTable &other) {
 
 	// Inherit ownership to all stored aggregate allocators
 	stored_allocators.emplace_back(other.aggregate_allocator);
+	if (other.spillable_allocator) {
+		stored_allocators.emplace_back(other.spillable_allocator);
+	}
 	for (const auto &stored_allocator : other.stored_allocators) {
 		stored_allocators.emplace_back(stored_allocator);
 	}
@@ -836,6 +998,10 @@ void GroupedAggregateHashTable::Combine(TupleDataCollection &other_data, optiona
 	while (fm_state.Scan()) {
 		const auto input_chunk_size = fm_state.groups.size();
 		FindOrCreateGroups(fm_state.groups, fm_state.hashes, fm_state.group_addresses, fm_state.new_groups_sel);
+		if (spillable_allocator) {
+			SpilledAggregateStates::Reload(row_state, layout, fm_state.scan_state.chunk_state.row_locations,
+			                               input_chunk_size);
+		}
 		RowOperations::CombineStates(row_state, layout, fm_state.scan_state.chunk_state.row_locations,
 		                             fm_state.group_addresses, input_chunk_size);
 		if (layout.HasDestructor()) {
@@ -146,18 +146,46 @@ void ColumnBindingResolver::VisitOperator(LogicalOperator &op) {
 	bindings = op.GetColumnBindings();
 }
 
+optional_idx ColumnBindingResolver::FindBinding(const ColumnBinding &binding) {
+	static constexpr const idx_t MIN_INDEXED_BINDINGS = 32;
+	if (bindings.size() < MIN_INDEXED_BINDINGS) {
+		// few bindings: linear search
+		for (idx_t i = 0; i < bindings.size(); i++) {
+			if (binding == bindings[i]) {
+				return i;
+			}
+		}
+		return optional_idx();
+	}
+	// many bindings (e.g. a very wide query): searching linearly for every column reference is quadratic
+	// the bindings are reassigned for every operator, so we verify that the indexed entry is still valid
+	auto entry = binding_index.find(binding);
+	if (entry != binding_index.end() && entry->second < bindings.size() && bindings[entry->second] == binding) {
+		return entry->second;
+	}
+	// the index is stale: rebuild it
+	binding_index.clear();
+	for (idx_t i = 0; i < bindings.size(); i++) {
+		binding_index.emplace(bindings[i], i);
+	}
+	entry = binding_index.find(binding);
+	if (entry == binding_index.end()) {
+		return optional_idx();
+	}
+	return entry->second;
+}
+
 unique_ptr<Expression> ColumnBindingResolver::VisitReplace(BoundColumnRefExpression &expr,
                                                            unique_ptr<Expression> *expr_ptr) {
 	D_ASSERT(expr.depth == 0);
 	// check the current set of column bindings to see which index corresponds to the column reference
-	for (idx_t i = 0; i < bindings.size(); i++) {
-		if (expr.binding == bindings[i]) {
-			if (verify_only) {
-				// in verification mode
-				return nullptr;
-			}
-			return make_uniq<BoundReferenceExpression>(expr.GetAlias(), expr.return_type, i);
+	auto binding_idx = FindBinding(expr.binding);
+	if (binding_idx.IsValid()) {
+		if (verify_only) {
+			// in verification mode
+			return nullptr;
 		}
+		return make_uniq<BoundReferenceExpression>(expr.GetAlias(), expr.return_type, binding_idx.GetIndex());
 	}
 	// LCOV_EXCL_START
 	// could not bind the column reference, this should never happen and indicates a bug in the code
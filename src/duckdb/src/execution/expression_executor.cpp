@@ -2,6 +2,7 @@
 
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/execution_context.hpp"
+#include "duckdb/execution/fused_expression.hpp"
 #include "duckdb/storage/statistics/base_statistics.hpp"
 #include "duckdb/planner/expression/list.hpp"
 
@@ -65,6 +66,9 @@ void ExpressionExecutor::AddExpression(const Expression &expr) {
 void ExpressionExecutor::Initialize(const Expression &expression, ExpressionExecutorState &state) {
 	state.executor = this;
 	state.root_state = InitializeState(expression, state);
+	if (HasContext() && ClientConfig::GetConfig(GetContext()).enable_fused_expressions) {
+		InitializeFusedExpressions(*state.root_state);
+	}
 }
 
 void ExpressionExecutor::Execute(DataChunk *input, DataChunk &result) {
@@ -167,6 +171,18 @@ unique_ptr<ExpressionState> ExpressionExecutor::InitializeState(const Expression
 	}
 }
 
+void ExpressionExecutor::InitializeFusedExpressions(ExpressionState &state) {
+	state.fused_expression = FusedExpression::TryCreate(state.expr);
+	if (state.fused_expression) {
+		return;
+	}
+	for (auto &child : state.child_states) {
+		if (child) {
+			InitializeFusedExpressions(*child);
+		}
+	}
+}
+
 void ExpressionExecutor::Execute(const Expression &expr, ExpressionState *state, const SelectionVector *sel,
                                  idx_t count, Vector &result) {
 #ifdef DEBUG
@@ -16,20 +16,12 @@ unique_ptr<ExpressionState> ExpressionExecutor::InitializeState(const BoundCastE
 		CastLocalStateParameters parameters(context_ptr, expr.bound_cast.cast_data);
 		result->local_state = expr.bound_cast.init_local_state(parameters);
 	}
+	result->InitializeDictionaryCache(expr.return_type);
 	return std::move(result);
 }
 
-void ExpressionExecutor::Execute(const BoundCastExpression &expr, ExpressionState *state, const SelectionVector *sel,
-                                 idx_t count, Vector &result) {
-	auto lstate = ExecuteFunctionState::GetFunctionState(*state);
-
-	// resolve the child
-	state->intermediate_chunk.Reset();
-
-	auto &child = state->intermediate_chunk.data[0];
-	auto child_state = state->child_states[0].get();
-
-	Execute(*expr.child, child_state, sel, count, child);
+static void ExecuteCast(const BoundCastExpression &expr, optional_ptr<FunctionLocalState> lstate, Vector &child,
+                        Vector &result, idx_t count) {
 	if (expr.try_cast) {
 		string error_message;
 		CastParameters parameters(expr.bound_cast.cast_data.get(), false, &error_message, lstate);
@@ -44,4 +36,30 @@ void ExpressionExecutor::Execute(const BoundCastExpression &expr, ExpressionStat
 	}
 }
 
+void ExpressionExecutor::Execute(const BoundCastExpression &expr, ExpressionState *state, const SelectionVector *sel,
+                                 idx_t count, Vector &result) {
+	auto lstate = ExecuteFunctionState::GetFunctionState(*state);
+
+	// resolve the child
+	state->intermediate_chunk.Reset();
+
+	auto &child = state->intermediate_chunk.data[0];
+	auto child_state = state->child_states[0].get();
+
+	Execute(*expr.child, child_state, sel, count, child);
+	if (state->dictionary_cache) {
+		// try to cast once per dictionary entry
+		state->intermediate_chunk.SetCardinality(count);
+		auto dictionary =
+		    state->dictionary_cache->Evaluate(state->intermediate_chunk, [&](DataChunk &entries, Vector &entry_result) {
+			    ExecuteCast(expr, lstate, entries.data[0], entry_result, entries.size());
+		    });
+		if (dictionary) {
+			state->dictionary_cache->Slice(*dictionary, count, result);
+			return;
+		}
+	}
+	ExecuteCast(expr, lstate, child, result, count);
+}
+
 } // namespace duckdb
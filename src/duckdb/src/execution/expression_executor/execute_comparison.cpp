@@ -1,6 +1,7 @@
 #include "duckdb/common/uhugeint.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/fused_expression.hpp"
 #include "duckdb/planner/expression/bound_comparison_expression.hpp"
 #include "duckdb/common/operator/comparison_operators.hpp"
 #include "duckdb/common/vector_operations/binary_executor.hpp"
@@ -16,20 +17,13 @@ unique_ptr<ExpressionState> ExpressionExecutor::InitializeState(const BoundCompa
 	result->AddChild(*expr.right);
 
 	result->Finalize();
+	result->InitializeDictionaryCache(LogicalType::BOOLEAN);
 	return result;
 }
 
-void ExpressionExecutor::Execute(const BoundComparisonExpression &expr, ExpressionState *state,
-                                 const SelectionVector *sel, idx_t count, Vector &result) {
-	// resolve the children
-	state->intermediate_chunk.Reset();
-	auto &left = state->intermediate_chunk.data[0];
-	auto &right = state->intermediate_chunk.data[1];
-
-	Execute(*expr.left, state->child_states[0].get(), sel, count, left);
-	Execute(*expr.right, state->child_states[1].get(), sel, count, right);
-
-	switch (expr.GetExpressionType()) {
+static void ExecuteComparison(ExpressionType comparison_type, Vector &left, Vector &right, Vector &result,
+                              idx_t count) {
+	switch (comparison_type) {
 	case ExpressionType::COMPARE_EQUAL:
 		VectorOperations::Equals(left, right, result, count);
 		break;
@@ -59,6 +53,38 @@ void ExpressionExecutor::Execute(const BoundComparisonExpression &expr, Expressi
 	}
 }
 
+static optional_ptr<Vector> EvaluateDictionaryComparison(const BoundComparisonExpression &expr, ExpressionState &state,
+                                                         idx_t count) {
+	state.intermediate_chunk.SetCardinality(count);
+	return state.dictionary_cache->Evaluate(state.intermediate_chunk, [&](DataChunk &entries, Vector &entry_result) {
+		ExecuteComparison(expr.GetExpressionType(), entries.data[0], entries.data[1], entry_result, entries.size());
+	});
+}
+
+void ExpressionExecutor::Execute(const BoundComparisonExpression &expr, ExpressionState *state,
+                                 const SelectionVector *sel, idx_t count, Vector &result) {
+	if (chunk && state->fused_expression && state->fused_expression->Execute(*chunk, sel, count, result)) {
+		return;
+	}
+	// resolve the children
+	state->intermediate_chunk.Reset();
+	auto &left = state->intermediate_chunk.data[0];
+	auto &right = state->intermediate_chunk.data[1];
+
+	Execute(*expr.left, state->child_states[0].get(), sel, count, left);
+	Execute(*expr.right, state->child_states[1].get(), sel, count, right);
+
+	if (state->dictionary_cache) {
+		// try to compare once per dictionary entry
+		auto dictionary = EvaluateDictionaryComparison(expr, *state, count);
+		if (dictionary) {
+			state->dictionary_cache->Slice(*dictionary, count, result);
+			return;
+		}
+	}
+	ExecuteComparison(expr.GetExpressionType(), left, right, result, count);
+}
+
 static void UpdateNullMask(Vector &vec, optional_ptr<const SelectionVector> sel, idx_t count, ValidityMask &null_mask) {
 	UnifiedVectorFormat vdata;
 	vec.ToUnifiedFormat(count, vdata);
@@ -349,6 +375,11 @@ idx_t VectorOperations::LessThanEquals(Vector &left, Vector &right, optional_ptr
 idx_t ExpressionExecutor::Select(const BoundComparisonExpression &expr, ExpressionState *state,
                                  const SelectionVector *sel, idx_t count, SelectionVector *true_sel,
                                  SelectionVector *false_sel) {
+	idx_t true_count;
+	if (chunk && state->fused_expression &&
+	    state->fused_expression->Select(*chunk, sel, count, true_sel, false_sel, true_count)) {
+		return true_count;
+	}
 	// resolve the children
 	state->intermediate_chunk.Reset();
 	auto &left = state->intermediate_chunk.data[0];
@@ -357,6 +388,12 @@ idx_t ExpressionExecutor::Select(const BoundComparisonExpression &expr, Expressi
 	Execute(*expr.left, state->child_states[0].get(), sel, count, left);
 	Execute(*expr.right, state->child_states[1].get(), sel, count, right);
 
+	if (state->dictionary_cache) {
+		auto dictionary = EvaluateDictionaryComparison(expr, *state, count);
+		if (dictionary) {
+			return state->dictionary_cache->Select(*dictionary, sel, count, true_sel, false_sel);
+		}
+	}
 	switch (expr.GetExpressionType()) {
 	case ExpressionType::COMPARE_EQUAL:
 		return VectorOperations::Equals(left, right, sel, count, true_sel, false_sel);
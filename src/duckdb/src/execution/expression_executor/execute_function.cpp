@@ -1,4 +1,5 @@
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/fused_expression.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
 
 namespace duckdb {
@@ -21,6 +22,7 @@ unique_ptr<ExpressionState> ExpressionExecutor::InitializeState(const BoundFunct
 	if (expr.function.init_local_state) {
 		result->local_state = expr.function.init_local_state(*result, expr, expr.bind_info.get());
 	}
+	result->InitializeDictionaryCache(expr.return_type);
 	return std::move(result);
 }
 
@@ -59,6 +61,9 @@ static void VerifyNullHandling(const BoundFunctionExpression &expr, DataChunk &a
 
 void ExpressionExecutor::Execute(const BoundFunctionExpression &expr, ExpressionState *state,
                                  const SelectionVector *sel, idx_t count, Vector &result) {
+	if (chunk && state->fused_expression && state->fused_expression->Execute(*chunk, sel, count, result)) {
+		return;
+	}
 	state->intermediate_chunk.Reset();
 	auto &arguments = state->intermediate_chunk;
 	if (!state->types.empty()) {
@@ -76,6 +81,17 @@ void ExpressionExecutor::Execute(const BoundFunctionExpression &expr, Expression
 	arguments.Verify();
 
 	D_ASSERT(expr.function.function);
+	if (state->dictionary_cache) {
+		// try to evaluate the function once per dictionary entry
+		auto dictionary = state->dictionary_cache->Evaluate(arguments, [&](DataChunk &entries, Vector &entry_result) {
+			expr.function.function(entries, *state, entry_result);
+			VerifyNullHandling(expr, entries, entry_result);
+		});
+		if (dictionary) {
+			state->dictionary_cache->Slice(*dictionary, count, result);
+			return;
+		}
+	}
 	// #ifdef DEBUG
 	expr.function.function(arguments, *state, result);
 
@@ -1,6 +1,8 @@
 #include "duckdb/execution/expression_executor_state.hpp"
 
+#include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/fused_expression.hpp"
 #include "duckdb/planner/expression.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
 
@@ -42,9 +44,182 @@ ClientContext &ExpressionState::GetContext() {
 ExpressionState::ExpressionState(const Expression &expr, ExpressionExecutorState &root) : expr(expr), root(root) {
 }
 
+ExpressionState::~ExpressionState() {
+}
+
+void ExpressionState::InitializeDictionaryCache(const LogicalType &result_type) {
+	if (!expr.IsConsistent()) {
+		// the result might differ between evaluations of the same value
+		return;
+	}
+	// all children except a single one must be foldable - so that the constant arguments are the same for every chunk
+	idx_t non_foldable_count = 0;
+	for (auto &child : child_states) {
+		if (!child->expr.IsFoldable()) {
+			non_foldable_count++;
+		}
+	}
+	if (non_foldable_count != 1) {
+		return;
+	}
+	dictionary_cache = make_uniq<DictionaryExpressionCache>(result_type);
+}
+
 ExpressionExecutorState::ExpressionExecutorState() {
 }
 
+//===--------------------------------------------------------------------===//
+// Dictionary Expression Cache
+//===--------------------------------------------------------------------===//
+constexpr idx_t DictionaryExpressionCache::MAX_DICTIONARY_SIZE_THRESHOLD;
+constexpr idx_t DictionaryExpressionCache::DICTIONARY_THRESHOLD;
+
+DictionaryExpressionCache::DictionaryExpressionCache(const LogicalType &result_type)
+    : result_type(result_type), unique_entries(STANDARD_VECTOR_SIZE) {
+}
+
+void DictionaryExpressionCache::Reset() {
+	dictionary_id.clear();
+	dictionary_size = 0;
+	results.reset();
+	result_count = 0;
+}
+
+bool DictionaryExpressionCache::Initialize(Vector &input, idx_t count) {
+	auto opt_dict_size = DictionaryVector::DictionarySize(input);
+	if (!opt_dict_size.IsValid()) {
+		// dict size not known - this is not a dictionary that comes from the storage
+		return false;
+	}
+	auto dict_size = opt_dict_size.GetIndex();
+	auto &input_id = DictionaryVector::DictionaryId(input);
+	if (input_id.empty()) {
+		// dictionary has no id, we can't cache across vectors
+		// only evaluate per entry if there are fewer entries than rows
+		if (dict_size * DICTIONARY_THRESHOLD > count) {
+			return false;
+		}
+	} else {
+		if (dict_size >= MAX_DICTIONARY_SIZE_THRESHOLD) {
+			return false;
+		}
+		if (results && input_id == dictionary_id && dict_size == dictionary_size) {
+			// the results of this dictionary are cached
+			return true;
+		}
+	}
+	// new dictionary (or the same id with a different size) - initialize the cache for all of its entries
+	if (dict_size > capacity) {
+		found_entry = make_unsafe_uniq_array<bool>(dict_size);
+		result_index = make_unsafe_uniq_array<sel_t>(dict_size);
+		capacity = dict_size;
+	}
+	memset(found_entry.get(), 0, dict_size * sizeof(bool));
+	// the previous results might still be referenced by an earlier result - so we always create a new vector
+	results = make_uniq<Vector>(result_type, dict_size);
+	result_count = 0;
+	dictionary_id = input_id;
+	dictionary_size = dict_size;
+	return true;
+}
+
+optional_ptr<Vector> DictionaryExpressionCache::Evaluate(DataChunk &arguments,
+                                                         const std::function<void(DataChunk &, Vector &)> &execute) {
+	// we need exactly one dictionary argument - all other arguments must be constant
+	optional_idx dict_arg;
+	for (idx_t i = 0; i < arguments.ColumnCount(); i++) {
+		auto vector_type = arguments.data[i].GetVectorType();
+		if (vector_type == VectorType::CONSTANT_VECTOR) {
+			continue;
+		}
+		if (vector_type != VectorType::DICTIONARY_VECTOR || dict_arg.IsValid()) {
+			return nullptr;
+		}
+		dict_arg = i;
+	}
+	if (!dict_arg.IsValid()) {
+		return nullptr;
+	}
+	auto &input = arguments.data[dict_arg.GetIndex()];
+	auto count = arguments.size();
+	if (!Initialize(input, count)) {
+		return nullptr;
+	}
+	// find the entries that are referenced by this chunk but that we have not computed yet
+	auto &offsets = DictionaryVector::SelVector(input);
+	idx_t unique_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto dict_idx = offsets.get_index(i);
+		unique_entries.set_index(unique_count, dict_idx);
+		unique_count += !found_entry[dict_idx];
+		found_entry[dict_idx] = true;
+	}
+	if (unique_count == 0) {
+		return input;
+	}
+	if (entry_arguments.ColumnCount() == 0) {
+		entry_arguments.InitializeEmpty(arguments.GetTypes());
+	}
+	for (idx_t i = 0; i < arguments.ColumnCount(); i++) {
+		if (i == dict_arg.GetIndex()) {
+			entry_arguments.data[i].Slice(DictionaryVector::Child(input), unique_entries, unique_count);
+		} else {
+			entry_arguments.data[i].Reference(arguments.data[i]);
+		}
+	}
+	entry_arguments.SetCardinality(unique_count);
+
+	Vector entry_results(result_type);
+	try {
+		execute(entry_arguments, entry_results);
+	} catch (...) {
+		// the entries have been marked as found - invalidate the cache
+		Reset();
+		throw;
+	}
+	VectorOperations::Copy(entry_results, *results, unique_count, 0, result_count);
+	for (idx_t i = 0; i < unique_count; i++) {
+		result_index[unique_entries.get_index(i)] = UnsafeNumericCast<sel_t>(result_count + i);
+	}
+	result_count += unique_count;
+	return input;
+}
+
+void DictionaryExpressionCache::Slice(Vector &input, idx_t count, Vector &result) {
+	auto &offsets = DictionaryVector::SelVector(input);
+	SelectionVector result_sel(count);
+	for (idx_t i = 0; i < count; i++) {
+		result_sel.set_index(i, result_index[offsets.get_index(i)]);
+	}
+	result.Slice(*results, result_sel, count);
+}
+
+idx_t DictionaryExpressionCache::Select(Vector &input, const SelectionVector *sel, idx_t count,
+                                        SelectionVector *true_sel, SelectionVector *false_sel) {
+	D_ASSERT(result_type == LogicalType::BOOLEAN);
+	auto &offsets = DictionaryVector::SelVector(input);
+	auto result_data = FlatVector::GetData<bool>(*results);
+	auto &result_validity = FlatVector::Validity(*results);
+	idx_t true_count = 0;
+	idx_t false_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto result_idx = result_index[offsets.get_index(i)];
+		auto row_idx = sel ? sel->get_index(i) : i;
+		if (result_validity.RowIsValid(result_idx) && result_data[result_idx]) {
+			if (true_sel) {
+				true_sel->set_index(true_count, row_idx);
+			}
+			true_count++;
+		} else {
+			if (false_sel) {
+				false_sel->set_index(false_count, row_idx);
+			}
+			false_count++;
+		}
+	}
+	return true_count;
+}
+
 void ExpressionState::Verify(ExpressionExecutorState &root_executor) {
 	D_ASSERT(&root_executor == &root);
 	for (auto &entry : child_states) {
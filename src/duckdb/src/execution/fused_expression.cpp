@@ -0,0 +1,543 @@
+#include "duckdb/execution/fused_expression.hpp"
+
+#include "duckdb/common/operator/add.hpp"
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/operator/multiply.hpp"
+#include "duckdb/common/operator/subtract.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+
+namespace duckdb {
+
+FusedExpression::FusedExpression(PhysicalType type, ExpressionType comparison, FusedArithmeticChain left_p,
+                                 FusedArithmeticChain right_p)
+    : type(type), comparison(comparison), left(std::move(left_p)), right(std::move(right_p)) {
+	// assign every referenced column a slot in the unified formats
+	for (auto chain : {&left, &right}) {
+		for (auto &operand : chain->operands) {
+			if (operand.column_index == DConstants::INVALID_INDEX) {
+				continue;
+			}
+			auto entry = std::find(columns.begin(), columns.end(), operand.column_index);
+			operand.format_index = NumericCast<idx_t>(entry - columns.begin());
+			if (entry == columns.end()) {
+				columns.push_back(operand.column_index);
+			}
+		}
+	}
+	formats.resize(columns.size());
+	if (comparison != ExpressionType::INVALID) {
+		// the values of both sides of the comparison are computed into these buffers
+		left_values = make_unsafe_uniq_array<data_t>(STANDARD_VECTOR_SIZE * GetTypeIdSize(type));
+		right_values = make_unsafe_uniq_array<data_t>(STANDARD_VECTOR_SIZE * GetTypeIdSize(type));
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Fusing
+//===--------------------------------------------------------------------===//
+static bool IsFusableType(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static bool TryGetArithmetic(const Expression &expr, FusedArithmeticType &result) {
+	if (expr.GetExpressionClass() != ExpressionClass::BOUND_FUNCTION || !IsFusableType(expr.return_type)) {
+		return false;
+	}
+	auto &func = expr.Cast<BoundFunctionExpression>();
+	if (func.children.size() != 2 || func.bind_info) {
+		return false;
+	}
+	for (auto &child : func.children) {
+		if (child->return_type != func.return_type) {
+			return false;
+		}
+	}
+	auto &name = func.function.name;
+	if (name == "+" || name == "add") {
+		result = FusedArithmeticType::ADD;
+	} else if (name == "-" || name == "subtract") {
+		result = FusedArithmeticType::SUBTRACT;
+	} else if (name == "*" || name == "multiply") {
+		result = FusedArithmeticType::MULTIPLY;
+	} else {
+		return false;
+	}
+	return true;
+}
+
+static bool TryCreateOperand(const Expression &expr, FusedOperand &result) {
+	switch (expr.GetExpressionClass()) {
+	case ExpressionClass::BOUND_REF:
+		result.column_index = expr.Cast<BoundReferenceExpression>().index;
+		return true;
+	case ExpressionClass::BOUND_CONSTANT: {
+		auto &value = expr.Cast<BoundConstantExpression>().value;
+		if (value.IsNull()) {
+			return false;
+		}
+		result.constant = value;
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+static bool HasColumnOperand(const FusedArithmeticChain &chain) {
+	for (auto &operand : chain.operands) {
+		if (operand.column_index != DConstants::INVALID_INDEX) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static bool TryCreateChain(const Expression &expr, FusedArithmeticChain &chain) {
+	FusedArithmeticType op;
+	if (!TryGetArithmetic(expr, op)) {
+		FusedOperand operand;
+		if (!TryCreateOperand(expr, operand)) {
+			return false;
+		}
+		chain.operands.push_back(std::move(operand));
+		return true;
+	}
+	auto &func = expr.Cast<BoundFunctionExpression>();
+	FusedOperand operand;
+	if (TryCreateOperand(*func.children[1], operand)) {
+		// "(...) OP x"
+		if (!TryCreateChain(*func.children[0], chain)) {
+			return false;
+		}
+	} else if (TryCreateOperand(*func.children[0], operand)) {
+		// "x OP (...)" - the nested computation is evaluated first and x becomes the left-hand side of the operation
+		if (!TryCreateChain(*func.children[1], chain)) {
+			return false;
+		}
+		operand.swapped = true;
+	} else {
+		// both sides are computations - not a chain
+		return false;
+	}
+	operand.op = op;
+	chain.operands.push_back(std::move(operand));
+	return chain.operands.size() <= FusedExpression::MAX_OPERANDS;
+}
+
+unique_ptr<FusedExpression> FusedExpression::TryCreate(const Expression &expr) {
+	switch (expr.GetExpressionClass()) {
+	case ExpressionClass::BOUND_COMPARISON: {
+		auto &comparison = expr.Cast<BoundComparisonExpression>();
+		switch (comparison.GetExpressionType()) {
+		case ExpressionType::COMPARE_EQUAL:
+		case ExpressionType::COMPARE_NOTEQUAL:
+		case ExpressionType::COMPARE_LESSTHAN:
+		case ExpressionType::COMPARE_GREATERTHAN:
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			break;
+		default:
+			return nullptr;
+		}
+		auto &type = comparison.left->return_type;
+		if (!IsFusableType(type) || comparison.right->return_type != type) {
+			return nullptr;
+		}
+		FusedArithmeticChain left, right;
+		if (!TryCreateChain(*comparison.left, left) || !TryCreateChain(*comparison.right, right)) {
+			return nullptr;
+		}
+		if (left.operands.size() + right.operands.size() <= 2) {
+			// a plain comparison: nothing is saved by fusing
+			return nullptr;
+		}
+		if (!HasColumnOperand(left) && !HasColumnOperand(right)) {
+			// constant expressions are folded by the optimizer
+			return nullptr;
+		}
+		return make_uniq<FusedExpression>(type.InternalType(), comparison.GetExpressionType(), std::move(left),
+		                                  std::move(right));
+	}
+	case ExpressionClass::BOUND_FUNCTION: {
+		FusedArithmeticChain chain;
+		if (!TryCreateChain(expr, chain) || chain.operands.size() <= 2) {
+			// a single binary operation is already a single loop
+			return nullptr;
+		}
+		if (!HasColumnOperand(chain)) {
+			return nullptr;
+		}
+		return make_uniq<FusedExpression>(expr.return_type.InternalType(), ExpressionType::INVALID, std::move(chain),
+		                                  FusedArithmeticChain());
+	}
+	default:
+		return nullptr;
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Kernels
+//===--------------------------------------------------------------------===//
+template <class T, bool IS_FLOATING = std::is_floating_point<T>::value>
+struct FusedOperators {
+	using ADD = AddOperatorOverflowCheck;
+	using SUBTRACT = SubtractOperatorOverflowCheck;
+	using MULTIPLY = MultiplyOperatorOverflowCheck;
+};
+
+template <class T>
+struct FusedOperators<T, true> {
+	using ADD = AddOperator;
+	using SUBTRACT = SubtractOperator;
+	using MULTIPLY = MultiplyOperator;
+};
+
+//! Loads the first operand of a chain into the dense result array
+template <class T>
+static void LoadOperand(const FusedOperand &operand, const vector<UnifiedVectorFormat> &formats,
+                        const SelectionVector *sel, idx_t count, T *result, ValidityMask &mask) {
+	if (operand.column_index == DConstants::INVALID_INDEX) {
+		auto constant = operand.constant.GetValueUnsafe<T>();
+		for (idx_t i = 0; i < count; i++) {
+			result[i] = constant;
+		}
+		return;
+	}
+	auto &format = formats[operand.format_index];
+	auto data = UnifiedVectorFormat::GetData<T>(format);
+	if (format.validity.AllValid()) {
+		for (idx_t i = 0; i < count; i++) {
+			result[i] = data[format.sel->get_index(sel ? sel->get_index(i) : i)];
+		}
+		return;
+	}
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = format.sel->get_index(sel ? sel->get_index(i) : i);
+		if (format.validity.RowIsValid(idx)) {
+			result[i] = data[idx];
+		} else {
+			mask.SetInvalid(i);
+		}
+	}
+}
+
+template <class T, class OP, bool SWAPPED>
+static inline T FusedOperation(T result, T value) {
+	return SWAPPED ? OP::template Operation<T, T, T>(value, result) : OP::template Operation<T, T, T>(result, value);
+}
+
+//! Applies "result OP constant" to the rows that are not NULL yet
+template <class T, class OP, bool SWAPPED>
+static void ApplyConstant(T constant, idx_t count, T *result, ValidityMask &mask) {
+	if (mask.AllValid()) {
+		for (idx_t i = 0; i < count; i++) {
+			result[i] = FusedOperation<T, OP, SWAPPED>(result[i], constant);
+		}
+		return;
+	}
+	for (idx_t i = 0; i < count; i++) {
+		if (mask.RowIsValid(i)) {
+			result[i] = FusedOperation<T, OP, SWAPPED>(result[i], constant);
+		}
+	}
+}
+
+//! Applies "result OP column" to the rows that are not NULL yet - a NULL in the column makes the row NULL
+template <class T, class OP, bool SWAPPED>
+static void ApplyColumn(const UnifiedVectorFormat &format, const SelectionVector *sel, idx_t count, T *result,
+                        ValidityMask &mask) {
+	auto data = UnifiedVectorFormat::GetData<T>(format);
+	if (mask.AllValid() && format.validity.AllValid()) {
+		for (idx_t i = 0; i < count; i++) {
+			auto idx = format.sel->get_index(sel ? sel->get_index(i) : i);
+			result[i] = FusedOperation<T, OP, SWAPPED>(result[i], data[idx]);
+		}
+		return;
+	}
+	for (idx_t i = 0; i < count; i++) {
+		if (!mask.RowIsValid(i)) {
+			continue;
+		}
+		auto idx = format.sel->get_index(sel ? sel->get_index(i) : i);
+		if (!format.validity.RowIsValid(idx)) {
+			mask.SetInvalid(i);
+			continue;
+		}
+		result[i] = FusedOperation<T, OP, SWAPPED>(result[i], data[idx]);
+	}
+}
+
+template <class T, class OP, bool SWAPPED>
+static void ApplyOperand(const FusedOperand &operand, const vector<UnifiedVectorFormat> &formats,
+                         const SelectionVector *sel, idx_t count, T *result, ValidityMask &mask) {
+	if (operand.column_index == DConstants::INVALID_INDEX) {
+		ApplyConstant<T, OP, SWAPPED>(operand.constant.GetValueUnsafe<T>(), count, result, mask);
+	} else {
+		ApplyColumn<T, OP, SWAPPED>(formats[operand.format_index], sel, count, result, mask);
+	}
+}
+
+template <class T, class OP>
+static void ApplyOperand(const FusedOperand &operand, const vector<UnifiedVectorFormat> &formats,
+                         const SelectionVector *sel, idx_t count, T *result, ValidityMask &mask) {
+	if (operand.swapped) {
+		ApplyOperand<T, OP, true>(operand, formats, sel, count, result, mask);
+	} else {
+		ApplyOperand<T, OP, false>(operand, formats, sel, count, result, mask);
+	}
+}
+
+//! Evaluates the chain for the (selected) rows into a dense array, one vectorized loop per operation. A row becomes
+//! NULL at its first NULL operand and is skipped by the later operations, so every operation is performed on the
+//! same rows as in the interpreted path (which may error on them).
+template <class T>
+static void EvaluateChain(const FusedArithmeticChain &chain, const vector<UnifiedVectorFormat> &formats,
+                          const SelectionVector *sel, idx_t count, T *result, ValidityMask &mask) {
+	using OPS = FusedOperators<T>;
+	LoadOperand<T>(chain.operands[0], formats, sel, count, result, mask);
+	for (idx_t i = 1; i < chain.operands.size(); i++) {
+		auto &operand = chain.operands[i];
+		switch (operand.op) {
+		case FusedArithmeticType::ADD:
+			ApplyOperand<T, typename OPS::ADD>(operand, formats, sel, count, result, mask);
+			break;
+		case FusedArithmeticType::SUBTRACT:
+			ApplyOperand<T, typename OPS::SUBTRACT>(operand, formats, sel, count, result, mask);
+			break;
+		default:
+			ApplyOperand<T, typename OPS::MULTIPLY>(operand, formats, sel, count, result, mask);
+			break;
+		}
+	}
+}
+
+template <class T, class OP>
+static void FusedComparisonLoop(const T *left, const T *right, idx_t count, Vector &result) {
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<bool>(result);
+	for (idx_t i = 0; i < count; i++) {
+		result_data[i] = OP::Operation(left[i], right[i]);
+	}
+}
+
+template <class T, class OP>
+static idx_t FusedSelectLoop(const T *left, const ValidityMask &left_mask, const T *right,
+                             const ValidityMask &right_mask, const SelectionVector *sel, idx_t count,
+                             SelectionVector *true_sel, SelectionVector *false_sel) {
+	idx_t true_count = 0;
+	idx_t false_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto row = sel ? sel->get_index(i) : i;
+		if (left_mask.RowIsValid(i) && right_mask.RowIsValid(i) && OP::Operation(left[i], right[i])) {
+			if (true_sel) {
+				true_sel->set_index(true_count, row);
+			}
+			true_count++;
+		} else {
+			if (false_sel) {
+				false_sel->set_index(false_count, row);
+			}
+			false_count++;
+		}
+	}
+	return true_count;
+}
+
+template <class T>
+void FusedExpression::EvaluateChains(const SelectionVector *sel, idx_t count) {
+	D_ASSERT(count <= STANDARD_VECTOR_SIZE);
+	left_validity.Reset();
+	right_validity.Reset();
+	// both sides are always evaluated, as the interpreted path computes them independently
+	EvaluateChain<T>(left, formats, sel, count, reinterpret_cast<T *>(left_values.get()), left_validity);
+	EvaluateChain<T>(right, formats, sel, count, reinterpret_cast<T *>(right_values.get()), right_validity);
+}
+
+template <class T>
+void FusedExpression::ExecuteTyped(const SelectionVector *sel, idx_t count, Vector &result) {
+	if (comparison == ExpressionType::INVALID) {
+		result.SetVectorType(VectorType::FLAT_VECTOR);
+		EvaluateChain<T>(left, formats, sel, count, FlatVector::GetData<T>(result), FlatVector::Validity(result));
+		return;
+	}
+	EvaluateChains<T>(sel, count);
+	auto lvalues = reinterpret_cast<const T *>(left_values.get());
+	auto rvalues = reinterpret_cast<const T *>(right_values.get());
+	switch (comparison) {
+	case ExpressionType::COMPARE_EQUAL:
+		FusedComparisonLoop<T, Equals>(lvalues, rvalues, count, result);
+		break;
+	case ExpressionType::COMPARE_NOTEQUAL:
+		FusedComparisonLoop<T, NotEquals>(lvalues, rvalues, count, result);
+		break;
+	case ExpressionType::COMPARE_LESSTHAN:
+		FusedComparisonLoop<T, LessThan>(lvalues, rvalues, count, result);
+		break;
+	case ExpressionType::COMPARE_GREATERTHAN:
+		FusedComparisonLoop<T, GreaterThan>(lvalues, rvalues, count, result);
+		break;
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		FusedComparisonLoop<T, LessThanEquals>(lvalues, rvalues, count, result);
+		break;
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		FusedComparisonLoop<T, GreaterThanEquals>(lvalues, rvalues, count, result);
+		break;
+	default:
+		throw InternalException("Unsupported comparison for FusedExpression");
+	}
+	// the comparison is NULL where either side is NULL (the values of those rows are ignored)
+	auto &result_mask = FlatVector::Validity(result);
+	if (!left_validity.AllValid() || !right_validity.AllValid()) {
+		for (idx_t i = 0; i < count; i++) {
+			if (!left_validity.RowIsValid(i) || !right_validity.RowIsValid(i)) {
+				result_mask.SetInvalid(i);
+			}
+		}
+	}
+}
+
+template <class T>
+idx_t FusedExpression::SelectTyped(const SelectionVector *sel, idx_t count, SelectionVector *true_sel,
+                                   SelectionVector *false_sel) {
+	EvaluateChains<T>(sel, count);
+	auto lvalues = reinterpret_cast<const T *>(left_values.get());
+	auto rvalues = reinterpret_cast<const T *>(right_values.get());
+	auto &lmask = left_validity;
+	auto &rmask = right_validity;
+	switch (comparison) {
+	case ExpressionType::COMPARE_EQUAL:
+		return FusedSelectLoop<T, Equals>(lvalues, lmask, rvalues, rmask, sel, count, true_sel, false_sel);
+	case ExpressionType::COMPARE_NOTEQUAL:
+		return FusedSelectLoop<T, NotEquals>(lvalues, lmask, rvalues, rmask, sel, count, true_sel, false_sel);
+	case ExpressionType::COMPARE_LESSTHAN:
+		return FusedSelectLoop<T, LessThan>(lvalues, lmask, rvalues, rmask, sel, count, true_sel, false_sel);
+	case ExpressionType::COMPARE_GREATERTHAN:
+		return FusedSelectLoop<T, GreaterThan>(lvalues, lmask, rvalues, rmask, sel, count, true_sel, false_sel);
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		return FusedSelectLoop<T, LessThanEquals>(lvalues, lmask, rvalues, rmask, sel, count, true_sel, false_sel);
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		return FusedSelectLoop<T, GreaterThanEquals>(lvalues, lmask, rvalues, rmask, sel, count, true_sel,
+		                                             false_sel);
+	default:
+		throw InternalException("Unsupported comparison for FusedExpression");
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Execution
+//===--------------------------------------------------------------------===//
+bool FusedExpression::Prepare(DataChunk &input) {
+	bool all_constant = true;
+	for (idx_t i = 0; i < columns.size(); i++) {
+		auto &column = input.data[columns[i]];
+		if (column.GetVectorType() != VectorType::CONSTANT_VECTOR) {
+			all_constant = false;
+		}
+		column.ToUnifiedFormat(input.size(), formats[i]);
+	}
+	// with only constant inputs the interpreted path produces a constant vector
+	return !all_constant;
+}
+
+bool FusedExpression::Execute(DataChunk &input, const SelectionVector *sel, idx_t count, Vector &result) {
+	if (!Prepare(input)) {
+		return false;
+	}
+	switch (type) {
+	case PhysicalType::INT8:
+		ExecuteTyped<int8_t>(sel, count, result);
+		break;
+	case PhysicalType::INT16:
+		ExecuteTyped<int16_t>(sel, count, result);
+		break;
+	case PhysicalType::INT32:
+		ExecuteTyped<int32_t>(sel, count, result);
+		break;
+	case PhysicalType::INT64:
+		ExecuteTyped<int64_t>(sel, count, result);
+		break;
+	case PhysicalType::UINT8:
+		ExecuteTyped<uint8_t>(sel, count, result);
+		break;
+	case PhysicalType::UINT16:
+		ExecuteTyped<uint16_t>(sel, count, result);
+		break;
+	case PhysicalType::UINT32:
+		ExecuteTyped<uint32_t>(sel, count, result);
+		break;
+	case PhysicalType::UINT64:
+		ExecuteTyped<uint64_t>(sel, count, result);
+		break;
+	case PhysicalType::FLOAT:
+		ExecuteTyped<float>(sel, count, result);
+		break;
+	case PhysicalType::DOUBLE:
+		ExecuteTyped<double>(sel, count, result);
+		break;
+	default:
+		throw InternalException("Unsupported type for FusedExpression");
+	}
+	return true;
+}
+
+bool FusedExpression::Select(DataChunk &input, const SelectionVector *sel, idx_t count, SelectionVector *true_sel,
+                             SelectionVector *false_sel, idx_t &true_count) {
+	D_ASSERT(comparison != ExpressionType::INVALID);
+	if (!Prepare(input)) {
+		return false;
+	}
+	switch (type) {
+	case PhysicalType::INT8:
+		true_count = SelectTyped<int8_t>(sel, count, true_sel, false_sel);
+		break;
+	case PhysicalType::INT16:
+		true_count = SelectTyped<int16_t>(sel, count, true_sel, false_sel);
+		break;
+	case PhysicalType::INT32:
+		true_count = SelectTyped<int32_t>(sel, count, true_sel, false_sel);
+		break;
+	case PhysicalType::INT64:
+		true_count = SelectTyped<int64_t>(sel, count, true_sel, false_sel);
+		break;
+	case PhysicalType::UINT8:
+		true_count = SelectTyped<uint8_t>(sel, count, true_sel, false_sel);
+		break;
+	case PhysicalType::UINT16:
+		true_count = SelectTyped<uint16_t>(sel, count, true_sel, false_sel);
+		break;
+	case PhysicalType::UINT32:
+		true_count = SelectTyped<uint32_t>(sel, count, true_sel, false_sel);
+		break;
+	case PhysicalType::UINT64:
+		true_count = SelectTyped<uint64_t>(sel, count, true_sel, false_sel);
+		break;
+	case PhysicalType::FLOAT:
+		true_count = SelectTyped<float>(sel, count, true_sel, false_sel);
+		break;
+	case PhysicalType::DOUBLE:
+		true_count = SelectTyped<double>(sel, count, true_sel, false_sel);
+		break;
+	default:
+		throw InternalException("Unsupported type for FusedExpression");
+	}
+	return true;
+}
+
+} // namespace duckdb
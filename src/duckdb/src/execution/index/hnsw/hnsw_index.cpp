@@ -0,0 +1,728 @@
+#include "duckdb/execution/index/hnsw/hnsw_index.hpp"
+
+#include "duckdb/common/exception/binder_exception.hpp"
+#include "duckdb/common/queue.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/function/scalar/array_kernels.hpp"
+#include "duckdb/storage/partial_block_manager.hpp"
+#include "duckdb/storage/table/append_state.hpp"
+#include "duckdb/storage/table_io_manager.hpp"
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// Options
+//===--------------------------------------------------------------------===//
+
+static idx_t ParseHNSWInteger(const string &name, const Value &value, idx_t min, idx_t max) {
+	auto result = value.DefaultCastAs(LogicalType::BIGINT).GetValue<int64_t>();
+	if (result < NumericCast<int64_t>(min) || result > NumericCast<int64_t>(max)) {
+		throw BinderException("HNSW index option '%s' must be between %llu and %llu, got %lld", name, min, max, result);
+	}
+	return NumericCast<idx_t>(result);
+}
+
+HNSWOptions HNSWOptions::Parse(const case_insensitive_map_t<Value> &options) {
+	HNSWOptions result;
+	for (auto &entry : options) {
+		auto &name = entry.first;
+		auto &value = entry.second;
+		if (value.IsNull()) {
+			throw BinderException("HNSW index option '%s' cannot be NULL", name);
+		}
+		if (name == "metric") {
+			auto metric = StringUtil::Lower(value.ToString());
+			if (metric == "l2sq") {
+				result.metric = HNSWMetric::L2SQ;
+			} else if (metric == "cosine") {
+				result.metric = HNSWMetric::COSINE;
+			} else if (metric == "ip") {
+				result.metric = HNSWMetric::INNER_PRODUCT;
+			} else {
+				throw BinderException("Unrecognized HNSW metric '%s', expected one of 'l2sq', 'cosine' or 'ip'",
+				                      metric);
+			}
+		} else if (name == "m") {
+			result.m = ParseHNSWInteger(name, value, 2, 128);
+		} else if (name == "ef_construction") {
+			result.ef_construction = ParseHNSWInteger(name, value, 1, 100000);
+		} else if (name == "ef_search") {
+			result.ef_search = ParseHNSWInteger(name, value, 1, 100000);
+		} else {
+			throw BinderException("Unrecognized HNSW index option '%s', expected one of 'metric', 'm', "
+			                      "'ef_construction' or 'ef_search'",
+			                      name);
+		}
+	}
+	return result;
+}
+
+string HNSWOptions::MetricToString(HNSWMetric metric) {
+	switch (metric) {
+	case HNSWMetric::L2SQ:
+		return "l2sq";
+	case HNSWMetric::COSINE:
+		return "cosine";
+	case HNSWMetric::INNER_PRODUCT:
+		return "ip";
+	default:
+		throw InternalException("Unrecognized HNSW metric");
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Serialization Helpers
+//===--------------------------------------------------------------------===//
+
+//! Writes a byte stream into a chain of allocator segments. Each segment starts with the pointer to the next one.
+class HNSWSegmentWriter {
+public:
+	explicit HNSWSegmentWriter(FixedSizeAllocator &allocator) : allocator(allocator) {
+		root = NewSegment();
+	}
+
+	IndexPointer root;
+
+public:
+	void WriteData(const_data_ptr_t data, idx_t size) {
+		while (size > 0) {
+			if (offset == CAPACITY) {
+				// Link the full segment to a new one.
+				auto previous = segment;
+				Store<IndexPointer>(NewSegment(), previous);
+			}
+			auto copy_count = MinValue<idx_t>(size, CAPACITY - offset);
+			memcpy(segment + sizeof(IndexPointer) + offset, data, copy_count);
+			offset += copy_count;
+			data += copy_count;
+			size -= copy_count;
+		}
+	}
+
+	template <class T>
+	void Write(const T &value) {
+		WriteData(const_data_ptr_cast(&value), sizeof(T));
+	}
+
+	template <class T>
+	void WriteVector(const vector<T> &values) {
+		WriteData(const_data_ptr_cast(values.data()), values.size() * sizeof(T));
+	}
+
+private:
+	static constexpr idx_t CAPACITY = HNSWIndex::SEGMENT_SIZE - sizeof(IndexPointer);
+
+	IndexPointer NewSegment() {
+		auto pointer = allocator.New();
+		pointer.SetMetadata(1);
+		segment = allocator.Get(pointer);
+		Store<IndexPointer>(IndexPointer(), segment);
+		offset = 0;
+		return pointer;
+	}
+
+	FixedSizeAllocator &allocator;
+	data_ptr_t segment = nullptr;
+	idx_t offset = 0;
+};
+
+//! Reads a byte stream written by the HNSWSegmentWriter.
+class HNSWSegmentReader {
+public:
+	HNSWSegmentReader(FixedSizeAllocator &allocator, IndexPointer root) : allocator(allocator) {
+		segment = allocator.Get(root, false);
+	}
+
+public:
+	void ReadData(data_ptr_t data, idx_t size) {
+		while (size > 0) {
+			if (offset == CAPACITY) {
+				auto next = Load<IndexPointer>(segment);
+				if (!next.HasMetadata()) {
+					throw SerializationException("Unexpected end of serialized HNSW index data");
+				}
+				segment = allocator.Get(next, false);
+				offset = 0;
+			}
+			auto copy_count = MinValue<idx_t>(size, CAPACITY - offset);
+			memcpy(data, segment + sizeof(IndexPointer) + offset, copy_count);
+			offset += copy_count;
+			data += copy_count;
+			size -= copy_count;
+		}
+	}
+
+	template <class T>
+	T Read() {
+		T value;
+		ReadData(data_ptr_cast(&value), sizeof(T));
+		return value;
+	}
+
+	template <class T>
+	void ReadVector(vector<T> &values, idx_t count) {
+		values.resize(count);
+		ReadData(data_ptr_cast(values.data()), count * sizeof(T));
+	}
+
+private:
+	static constexpr idx_t CAPACITY = HNSWIndex::SEGMENT_SIZE - sizeof(IndexPointer);
+
+	FixedSizeAllocator &allocator;
+	data_ptr_t segment;
+	idx_t offset = 0;
+};
+
+//===--------------------------------------------------------------------===//
+// HNSW
+//===--------------------------------------------------------------------===//
+
+//! Fixed seed of the node layers. Index creation inserts from parallel threads in no fixed order, so the graph
+//! (and therefore the approximate search result) can still differ between builds over the same data.
+static constexpr int64_t HNSW_RANDOM_SEED = 0x484E5357;
+//! Upper bound of the node layers.
+static constexpr idx_t HNSW_MAX_LEVEL = 16;
+
+HNSWIndex::HNSWIndex(const string &name, const IndexConstraintType index_constraint_type,
+                     const vector<column_t> &column_ids, TableIOManager &table_io_manager,
+                     const vector<unique_ptr<Expression>> &unbound_expressions, AttachedDatabase &db,
+                     const case_insensitive_map_t<Value> &options, const IndexStorageInfo &info)
+    : BoundIndex(name, HNSWIndex::TYPE_NAME, index_constraint_type, column_ids, table_io_manager, unbound_expressions,
+                 db),
+      parameters(HNSWOptions::Parse(options)), random(HNSW_RANDOM_SEED) {
+
+	if (logical_types.size() != 1) {
+		throw InvalidInputException("HNSW indexes require exactly one key column");
+	}
+	if (logical_types[0].id() != LogicalTypeId::ARRAY ||
+	    ArrayType::GetChildType(logical_types[0]).id() != LogicalTypeId::FLOAT) {
+		throw InvalidTypeException(logical_types[0], "HNSW index keys must be of type FLOAT[n].");
+	}
+	dimensions = ArrayType::GetSize(logical_types[0]);
+
+	auto &block_manager = table_io_manager.GetIndexBlockManager();
+	allocator = make_uniq<FixedSizeAllocator>(SEGMENT_SIZE, block_manager);
+
+	if (!info.IsValid()) {
+		// We create a new HNSW index.
+		return;
+	}
+
+	// Initialize the allocator and load the graph.
+	allocator->Init(info.allocator_infos[0]);
+	IndexPointer root_pointer;
+	root_pointer.Set(info.root);
+	Deserialize(root_pointer);
+	dirty = false;
+}
+
+//===--------------------------------------------------------------------===//
+// Distances
+//===--------------------------------------------------------------------===//
+
+float HNSWIndex::Distance(const float *lhs, const float *rhs) const {
+	// The graph uses the same kernels as the array distance functions.
+	switch (parameters.metric) {
+	case HNSWMetric::L2SQ:
+		return DistanceSquaredOp::Operation<float>(lhs, rhs, dimensions);
+	case HNSWMetric::COSINE:
+		// Cosine vectors are normalized on insertion.
+		return 1 - InnerProductOp::Operation<float>(lhs, rhs, dimensions);
+	default:
+		return NegativeInnerProductOp::Operation<float>(lhs, rhs, dimensions);
+	}
+}
+
+static void NormalizeVector(float *data, idx_t count) {
+	float norm = 0;
+	for (idx_t i = 0; i < count; i++) {
+		norm += data[i] * data[i];
+	}
+	if (norm == 0) {
+		return;
+	}
+	auto scale = 1 / std::sqrt(norm);
+	for (idx_t i = 0; i < count; i++) {
+		data[i] *= scale;
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Graph
+//===--------------------------------------------------------------------===//
+
+uint32_t *HNSWIndex::GetLinks(uint32_t node, idx_t level) {
+	if (level == 0) {
+		return base_links.data() + node * (MaxLinks(0) + 1);
+	}
+	D_ASSERT(level <= levels[node]);
+	return upper_links[node].data() + (level - 1) * (MaxLinks(level) + 1);
+}
+
+idx_t HNSWIndex::RandomLevel() {
+	// Layers are exponentially decaying with base m (the "mL = 1 / ln(M)" normalization).
+	auto uniform = MaxValue<double>(random.NextRandom(), 1e-9);
+	auto level = static_cast<idx_t>(std::floor(-std::log(uniform) / std::log(static_cast<double>(parameters.m))));
+	return MinValue<idx_t>(level, HNSW_MAX_LEVEL);
+}
+
+uint32_t HNSWIndex::GreedySearch(const float *query, uint32_t entry, idx_t from_level, idx_t to_level) {
+	auto current = entry;
+	auto current_distance = Distance(query, GetVector(current));
+	for (idx_t level = from_level + 1; level > to_level; level--) {
+		bool changed = true;
+		while (changed) {
+			changed = false;
+			auto links = GetLinks(current, level - 1);
+			for (idx_t i = 1; i <= links[0]; i++) {
+				auto distance = Distance(query, GetVector(links[i]));
+				if (distance < current_distance) {
+					current_distance = distance;
+					current = links[i];
+					changed = true;
+				}
+			}
+		}
+	}
+	return current;
+}
+
+void HNSWIndex::SearchLayer(const float *query, uint32_t entry, idx_t ef, idx_t level, bool skip_deleted,
+                            vector<HNSWCandidate> &result) {
+	visited_epoch++;
+	if (visited_epoch == 0) {
+		std::fill(visited.begin(), visited.end(), 0);
+		visited_epoch = 1;
+	}
+
+	// Nearest-first queue of nodes to expand, and furthest-first queue of the ef nearest (live) nodes.
+	std::priority_queue<HNSWCandidate, vector<HNSWCandidate>, std::greater<HNSWCandidate>> candidates;
+	std::priority_queue<HNSWCandidate> nearest;
+
+	auto entry_distance = Distance(query, GetVector(entry));
+	visited[entry] = visited_epoch;
+	candidates.emplace(entry_distance, entry);
+	if (!skip_deleted || !deleted[entry]) {
+		nearest.emplace(entry_distance, entry);
+	}
+
+	while (!candidates.empty()) {
+		auto candidate = candidates.top();
+		if (nearest.size() >= ef && candidate.first > nearest.top().first) {
+			break;
+		}
+		candidates.pop();
+
+		auto links = GetLinks(candidate.second, level);
+		for (idx_t i = 1; i <= links[0]; i++) {
+			auto neighbor = links[i];
+			if (visited[neighbor] == visited_epoch) {
+				continue;
+			}
+			visited[neighbor] = visited_epoch;
+
+			auto distance = Distance(query, GetVector(neighbor));
+			if (nearest.size() >= ef && distance >= nearest.top().first) {
+				continue;
+			}
+			candidates.emplace(distance, neighbor);
+			if (skip_deleted && deleted[neighbor]) {
+				continue;
+			}
+			nearest.emplace(distance, neighbor);
+			if (nearest.size() > ef) {
+				nearest.pop();
+			}
+		}
+	}
+
+	result.resize(nearest.size());
+	for (idx_t i = nearest.size(); i > 0; i--) {
+		result[i - 1] = nearest.top();
+		nearest.pop();
+	}
+}
+
+void HNSWIndex::SelectNeighbors(vector<HNSWCandidate> &candidates, idx_t max_count) {
+	if (candidates.size() <= max_count) {
+		return;
+	}
+
+	// Keep a candidate only if it is closer to the base node than to any already selected neighbor.
+	// This spreads the links over different directions, which keeps clustered data navigable.
+	vector<HNSWCandidate> selected;
+	for (auto &candidate : candidates) {
+		if (selected.size() >= max_count) {
+			break;
+		}
+		auto candidate_vector = GetVector(candidate.second);
+		bool keep = true;
+		for (auto &neighbor : selected) {
+			if (Distance(candidate_vector, GetVector(neighbor.second)) < candidate.first) {
+				keep = false;
+				break;
+			}
+		}
+		if (keep) {
+			selected.push_back(candidate);
+		}
+	}
+	candidates = std::move(selected);
+}
+
+void HNSWIndex::Connect(uint32_t node, uint32_t neighbor, idx_t level) {
+	auto links = GetLinks(node, level);
+	auto max_links = MaxLinks(level);
+	if (links[0] < max_links) {
+		links[++links[0]] = neighbor;
+		return;
+	}
+
+	// The node is full: shrink its links, including the new neighbor.
+	auto node_vector = GetVector(node);
+	vector<HNSWCandidate> candidates;
+	candidates.reserve(max_links + 1);
+	for (idx_t i = 1; i <= links[0]; i++) {
+		candidates.emplace_back(Distance(node_vector, GetVector(links[i])), links[i]);
+	}
+	candidates.emplace_back(Distance(node_vector, GetVector(neighbor)), neighbor);
+	std::sort(candidates.begin(), candidates.end());
+	SelectNeighbors(candidates, max_links);
+
+	links[0] = NumericCast<uint32_t>(candidates.size());
+	for (idx_t i = 0; i < candidates.size(); i++) {
+		links[i + 1] = candidates[i].second;
+	}
+}
+
+void HNSWIndex::InsertVector(const float *vector_data, row_t row_id) {
+	auto entry = node_map.find(row_id);
+	if (entry != node_map.end() && !deleted[entry->second]) {
+		deleted[entry->second] = 1;
+		deleted_count++;
+	}
+
+	auto node = NumericCast<uint32_t>(node_row_ids.size());
+	auto level = RandomLevel();
+	vectors.insert(vectors.end(), vector_data, vector_data + dimensions);
+	if (parameters.metric == HNSWMetric::COSINE) {
+		NormalizeVector(vectors.data() + node * dimensions, dimensions);
+	}
+	node_row_ids.push_back(row_id);
+	levels.push_back(NumericCast<uint8_t>(level));
+	deleted.push_back(0);
+	base_links.resize(base_links.size() + MaxLinks(0) + 1, 0);
+	upper_links.emplace_back(level * (MaxLinks(1) + 1), 0);
+	visited.push_back(0);
+	node_map[row_id] = node;
+	dirty = true;
+
+	if (node == 0) {
+		entry_point = node;
+		max_level = level;
+		return;
+	}
+
+	// Descend greedily through the layers above the node, then link it on each of its layers.
+	auto query = GetVector(node);
+	auto current = entry_point;
+	if (max_level > level) {
+		current = GreedySearch(query, entry_point, max_level, level + 1);
+	}
+
+	vector<HNSWCandidate> candidates;
+	for (idx_t layer = MinValue(level, max_level) + 1; layer > 0; layer--) {
+		SearchLayer(query, current, parameters.ef_construction, layer - 1, false, candidates);
+		current = candidates[0].second;
+		SelectNeighbors(candidates, parameters.m);
+
+		auto links = GetLinks(node, layer - 1);
+		links[0] = NumericCast<uint32_t>(candidates.size());
+		for (idx_t i = 0; i < candidates.size(); i++) {
+			links[i + 1] = candidates[i].second;
+			Connect(candidates[i].second, node, layer - 1);
+		}
+	}
+
+	if (level > max_level) {
+		entry_point = node;
+		max_level = level;
+	}
+}
+
+void HNSWIndex::Search(const float *query, idx_t count, unsafe_vector<row_t> &result) {
+	lock_guard<mutex> guard(lock);
+	if (node_row_ids.size() == deleted_count) {
+		return;
+	}
+
+	vector<float> normalized;
+	if (parameters.metric == HNSWMetric::COSINE) {
+		normalized.assign(query, query + dimensions);
+		NormalizeVector(normalized.data(), dimensions);
+		query = normalized.data();
+	}
+
+	auto current = GreedySearch(query, entry_point, max_level, 1);
+	vector<HNSWCandidate> candidates;
+	SearchLayer(query, current, MaxValue(parameters.ef_search, count), 0, true, candidates);
+
+	auto result_count = MinValue<idx_t>(count, candidates.size());
+	for (idx_t i = 0; i < result_count; i++) {
+		result.push_back(node_row_ids[candidates[i].second]);
+	}
+}
+
+void HNSWIndex::Clear() {
+	vectors.clear();
+	node_row_ids.clear();
+	levels.clear();
+	deleted.clear();
+	base_links.clear();
+	upper_links.clear();
+	node_map.clear();
+	visited.clear();
+	deleted_count = 0;
+	entry_point = 0;
+	max_level = 0;
+	dirty = true;
+}
+
+void HNSWIndex::Rebuild() {
+	vector<float> live_vectors;
+	vector<row_t> live_row_ids;
+	for (uint32_t node = 0; node < node_row_ids.size(); node++) {
+		if (deleted[node]) {
+			continue;
+		}
+		auto vector_data = GetVector(node);
+		live_vectors.insert(live_vectors.end(), vector_data, vector_data + dimensions);
+		live_row_ids.push_back(node_row_ids[node]);
+	}
+
+	Clear();
+	for (idx_t i = 0; i < live_row_ids.size(); i++) {
+		InsertVector(live_vectors.data() + i * dimensions, live_row_ids[i]);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Insert, Delete and Drop
+//===--------------------------------------------------------------------===//
+
+ErrorData HNSWIndex::Append(IndexLock &l, DataChunk &chunk, Vector &row_ids) {
+	// Execute all column expressions before inserting the data chunk.
+	DataChunk expr_chunk;
+	expr_chunk.Initialize(Allocator::DefaultAllocator(), logical_types);
+	ExecuteExpressions(chunk, expr_chunk);
+	return Insert(l, expr_chunk, row_ids);
+}
+
+ErrorData HNSWIndex::Insert(IndexLock &l, DataChunk &chunk, Vector &row_ids) {
+	D_ASSERT(row_ids.GetType().InternalType() == ROW_TYPE);
+	auto count = chunk.size();
+	auto &arrays = chunk.data[0];
+
+	UnifiedVectorFormat array_format;
+	arrays.ToUnifiedFormat(count, array_format);
+	auto &child = ArrayVector::GetEntry(arrays);
+	auto child_data = FlatVector::GetData<float>(child);
+	auto &child_validity = FlatVector::Validity(child);
+
+	UnifiedVectorFormat row_id_format;
+	row_ids.ToUnifiedFormat(count, row_id_format);
+	auto row_id_data = UnifiedVectorFormat::GetData<row_t>(row_id_format);
+
+	for (idx_t i = 0; i < count; i++) {
+		// NULL arrays and arrays with NULL elements have no distance, so we do not index them.
+		auto array_idx = array_format.sel->get_index(i);
+		if (!array_format.validity.RowIsValid(array_idx)) {
+			continue;
+		}
+		auto offset = array_idx * dimensions;
+		if (!child_validity.CheckAllValid(offset + dimensions, offset)) {
+			continue;
+		}
+		auto row_id = row_id_data[row_id_format.sel->get_index(i)];
+		InsertVector(child_data + offset, row_id);
+	}
+	return ErrorData();
+}
+
+void HNSWIndex::Delete(IndexLock &state, DataChunk &entries, Vector &row_ids) {
+	auto count = entries.size();
+	UnifiedVectorFormat row_id_format;
+	row_ids.ToUnifiedFormat(count, row_id_format);
+	auto row_id_data = UnifiedVectorFormat::GetData<row_t>(row_id_format);
+
+	// Deleted nodes stay in the graph to keep it navigable, but are no longer returned by searches.
+	for (idx_t i = 0; i < count; i++) {
+		auto entry = node_map.find(row_id_data[row_id_format.sel->get_index(i)]);
+		if (entry == node_map.end()) {
+			continue;
+		}
+		deleted[entry->second] = 1;
+		deleted_count++;
+		node_map.erase(entry);
+		dirty = true;
+	}
+}
+
+void HNSWIndex::CommitDrop(IndexLock &index_lock) {
+	Clear();
+	allocator->Reset();
+	root.Clear();
+}
+
+bool HNSWIndex::MergeIndexes(IndexLock &state, BoundIndex &other_index) {
+	auto &other = other_index.Cast<HNSWIndex>();
+	for (uint32_t node = 0; node < other.node_row_ids.size(); node++) {
+		if (!other.deleted[node]) {
+			InsertVector(other.GetVector(node), other.node_row_ids[node]);
+		}
+	}
+	return true;
+}
+
+void HNSWIndex::Vacuum(IndexLock &state) {
+	// Rebuild the graph once more than half of its nodes are tombstones.
+	if (deleted_count * 2 <= node_row_ids.size()) {
+		return;
+	}
+	Rebuild();
+}
+
+//===--------------------------------------------------------------------===//
+// Storage and Memory
+//===--------------------------------------------------------------------===//
+
+void HNSWIndex::Serialize() {
+	allocator->Reset();
+	HNSWSegmentWriter writer(*allocator);
+
+	auto node_count = node_row_ids.size();
+	writer.Write<idx_t>(dimensions);
+	writer.Write<idx_t>(parameters.m);
+	writer.Write<idx_t>(node_count);
+	writer.Write<uint32_t>(entry_point);
+	writer.Write<idx_t>(max_level);
+
+	writer.WriteVector(vectors);
+	writer.WriteVector(node_row_ids);
+	writer.WriteVector(levels);
+	writer.WriteVector(deleted);
+	writer.WriteVector(base_links);
+	for (auto &links : upper_links) {
+		writer.WriteVector(links);
+	}
+	root = writer.root;
+}
+
+void HNSWIndex::Deserialize(IndexPointer root_pointer) {
+	HNSWSegmentReader reader(*allocator, root_pointer);
+	root = root_pointer;
+
+	auto stored_dimensions = reader.Read<idx_t>();
+	auto stored_m = reader.Read<idx_t>();
+	if (stored_dimensions != dimensions || stored_m != parameters.m) {
+		throw SerializationException("Serialized HNSW index \"%s\" does not match its definition", name);
+	}
+	auto node_count = reader.Read<idx_t>();
+	entry_point = reader.Read<uint32_t>();
+	max_level = reader.Read<idx_t>();
+
+	reader.ReadVector(vectors, node_count * dimensions);
+	reader.ReadVector(node_row_ids, node_count);
+	reader.ReadVector(levels, node_count);
+	reader.ReadVector(deleted, node_count);
+	reader.ReadVector(base_links, node_count * (MaxLinks(0) + 1));
+	upper_links.resize(node_count);
+	for (idx_t node = 0; node < node_count; node++) {
+		reader.ReadVector(upper_links[node], levels[node] * (MaxLinks(1) + 1));
+	}
+
+	visited.resize(node_count, 0);
+	for (uint32_t node = 0; node < node_count; node++) {
+		if (deleted[node]) {
+			deleted_count++;
+			continue;
+		}
+		node_map[node_row_ids[node]] = node;
+	}
+}
+
+IndexStorageInfo HNSWIndex::GetStorageInfo(const case_insensitive_map_t<Value> &options, const bool to_wal) {
+	// The graph is serialized as a whole, so we only rewrite it if it changed.
+	if (dirty) {
+		Serialize();
+		dirty = false;
+	}
+
+	IndexStorageInfo info(name);
+	info.root = root.Get();
+	info.options = options;
+
+	if (!to_wal) {
+		// Store the data on disk as partial blocks and set the block ids.
+		auto &block_manager = table_io_manager.GetIndexBlockManager();
+		PartialBlockManager partial_block_manager(block_manager, PartialBlockType::FULL_CHECKPOINT);
+		allocator->SerializeBuffers(partial_block_manager);
+		partial_block_manager.FlushPartialBlocks();
+	} else {
+		// Set the correct allocation sizes and get the map containing all buffers.
+		info.buffers.push_back(allocator->InitSerializationToWAL());
+	}
+
+	info.allocator_infos.push_back(allocator->GetInfo());
+	return info;
+}
+
+idx_t HNSWIndex::GetInMemorySize(IndexLock &index_lock) {
+	idx_t in_memory_size = allocator->GetInMemorySize();
+	in_memory_size += vectors.capacity() * sizeof(float);
+	in_memory_size += node_row_ids.capacity() * sizeof(row_t);
+	in_memory_size += levels.capacity() + deleted.capacity();
+	in_memory_size += (base_links.capacity() + visited.capacity()) * sizeof(uint32_t);
+	for (auto &links : upper_links) {
+		in_memory_size += links.capacity() * sizeof(uint32_t);
+	}
+	in_memory_size += node_map.size() * (sizeof(row_t) + sizeof(uint32_t));
+	return in_memory_size;
+}
+
+//===--------------------------------------------------------------------===//
+// Verification
+//===--------------------------------------------------------------------===//
+
+string HNSWIndex::VerifyAndToString(IndexLock &state, const bool only_verify) {
+	auto node_count = node_row_ids.size();
+	for (uint32_t node = 0; node < node_count; node++) {
+		for (idx_t level = 0; level <= levels[node]; level++) {
+			auto links = GetLinks(node, level);
+			if (links[0] > MaxLinks(level)) {
+				throw InternalException("HNSW node %llu exceeds its link capacity on layer %llu", node, level);
+			}
+			for (idx_t i = 1; i <= links[0]; i++) {
+				if (links[i] >= node_count || levels[links[i]] < level) {
+					throw InternalException("HNSW node %llu has an invalid link on layer %llu", node, level);
+				}
+			}
+		}
+	}
+	if (node_count == 0) {
+		return "[empty]";
+	}
+	return StringUtil::Format("HNSW: %llu nodes (%llu deleted), %llu layers, metric %s", node_count, deleted_count,
+	                          max_level + 1, HNSWOptions::MetricToString(parameters.metric));
+}
+
+void HNSWIndex::VerifyAllocations(IndexLock &state) {
+	// The allocator only holds the serialized graph, which is rebuilt on every serialization.
+}
+
+string HNSWIndex::GetConstraintViolationMessage(VerifyExistenceType verify_type, idx_t failed_index,
+                                                DataChunk &input) {
+	throw InternalException("HNSW indexes do not enforce constraints");
+}
+
+} // namespace duckdb
@@ -0,0 +1,52 @@
+#include "duckdb/execution/index/hnsw/hnsw_index.hpp"
+#include "duckdb/execution/operator/projection/physical_projection.hpp"
+#include "duckdb/execution/operator/schema/physical_create_hnsw_index.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/operator/logical_create_index.hpp"
+
+namespace duckdb {
+
+unique_ptr<PhysicalOperator> HNSWIndex::CreatePlan(PlanIndexInput &input) {
+	auto &op = input.op;
+	auto &info = *op.info;
+
+	// Validate the index definition before scanning the table.
+	if (info.constraint_type != IndexConstraintType::NONE) {
+		throw BinderException("HNSW indexes do not support UNIQUE or PRIMARY KEY constraints");
+	}
+	if (op.unbound_expressions.size() != 1) {
+		throw BinderException("HNSW indexes can only be created over a single column");
+	}
+	auto &key_type = op.unbound_expressions[0]->return_type;
+	if (key_type.id() != LogicalTypeId::ARRAY || ArrayType::GetChildType(key_type).id() != LogicalTypeId::FLOAT) {
+		throw BinderException("HNSW indexes can only be created over FLOAT[n] columns, not %s", key_type.ToString());
+	}
+	if (op.unbound_expressions[0]->GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
+		throw BinderException("HNSW indexes can only be created over a column, not an expression");
+	}
+	HNSWOptions::Parse(info.options);
+
+	// PROJECTION on the indexed column and the row ID.
+	// The index skips NULL keys itself, so there is no NOT NULL filter, and there is no ORDER BY,
+	// as the graph is built by incremental insertion.
+	vector<LogicalType> new_column_types;
+	vector<unique_ptr<Expression>> select_list;
+	for (idx_t i = 0; i < op.expressions.size(); i++) {
+		new_column_types.push_back(op.expressions[i]->return_type);
+		select_list.push_back(std::move(op.expressions[i]));
+	}
+	new_column_types.emplace_back(LogicalType::ROW_TYPE);
+	select_list.push_back(make_uniq<BoundReferenceExpression>(LogicalType::ROW_TYPE, info.scan_types.size() - 1));
+
+	auto projection = make_uniq<PhysicalProjection>(new_column_types, std::move(select_list), op.estimated_cardinality);
+	projection->children.push_back(std::move(input.table_scan));
+
+	// CREATE INDEX operator.
+	auto physical_create_index =
+	    make_uniq<PhysicalCreateHNSWIndex>(op, op.table, info.column_ids, std::move(op.info),
+	                                       std::move(op.unbound_expressions), op.estimated_cardinality);
+	physical_create_index->children.push_back(std::move(projection));
+	return std::move(physical_create_index);
+}
+
+} // namespace duckdb
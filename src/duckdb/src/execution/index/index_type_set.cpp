@@ -1,6 +1,7 @@
 #include "duckdb/execution/index/index_type.hpp"
 #include "duckdb/execution/index/index_type_set.hpp"
 #include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/execution/index/hnsw/hnsw_index.hpp"
 
 namespace duckdb {
 
@@ -13,6 +14,14 @@ IndexTypeSet::IndexTypeSet() {
 	art_index_type.create_plan = ART::CreatePlan;
 
 	RegisterIndexType(art_index_type);
+
+	// Register the HNSW index type for approximate nearest-neighbor search
+	IndexType hnsw_index_type;
+	hnsw_index_type.name = HNSWIndex::TYPE_NAME;
+	hnsw_index_type.create_instance = HNSWIndex::Create;
+	hnsw_index_type.create_plan = HNSWIndex::CreatePlan;
+
+	RegisterIndexType(hnsw_index_type);
 }
 
 optional_ptr<IndexType> IndexTypeSet::FindByName(const string &name) {
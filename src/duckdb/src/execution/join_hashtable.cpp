@@ -1449,6 +1449,13 @@ void JoinHashTable::Unpartition() {
 	data_collection = sink_collection->GetUnpartitioned();
 }
 
+void JoinHashTable::InitializeSinkCollection(idx_t radix_bits_p) {
+	D_ASSERT(sink_collection->Count() == 0);
+	radix_bits = radix_bits_p;
+	sink_collection =
+	    make_uniq<RadixPartitionedTupleData>(buffer_manager, layout, radix_bits, layout.ColumnCount() - 1);
+}
+
 void JoinHashTable::SetRepartitionRadixBits(const idx_t max_ht_size, const idx_t max_partition_size,
                                             const idx_t max_partition_count) {
 	D_ASSERT(max_partition_size + PointerTableSize(max_partition_count) > max_ht_size);
@@ -11,13 +11,18 @@ AggregateObject::AggregateObject(AggregateFunction function, FunctionData *bind_
     : function(std::move(function)),
       bind_data_wrapper(bind_data ? make_shared_ptr<FunctionDataWrapper>(bind_data->Copy()) : nullptr),
       child_count(child_count), payload_size(payload_size), aggr_type(aggr_type), return_type(return_type),
-      filter(filter) {
+      filter(filter), spill_offset(payload_size) {
 }
 
 AggregateObject::AggregateObject(BoundAggregateExpression *aggr)
     : AggregateObject(aggr->function, aggr->bind_info.get(), aggr->children.size(),
                       AlignValue(aggr->function.state_size(aggr->function)), aggr->aggr_type,
                       aggr->return_type.InternalType(), aggr->filter.get()) {
+	if (function.state_serialize && function.state_deserialize) {
+		// Reserve room for the spill slot behind the state
+		spillable = true;
+		payload_size += AlignValue(sizeof(AggregateSpillSlot));
+	}
 }
 
 AggregateObject::AggregateObject(const BoundWindowExpression &window)
@@ -921,6 +921,17 @@ InsertionOrderPreservingMap<string> PhysicalHashAggregate::ParamsToString() cons
 		}
 	}
 	result["Aggregates"] = aggregate_info;
+	if (sink_state) {
+		// the aggregate states spilled when going out-of-core - these are only known once the sink has finished
+		auto &gstate = sink_state->Cast<HashAggregateGlobalSinkState>();
+		idx_t spilled_count = 0;
+		for (idx_t i = 0; i < groupings.size(); i++) {
+			spilled_count += RadixPartitionedHashTable::SpilledStateCount(*gstate.grouping_states[i].table_state);
+		}
+		if (spilled_count > 0) {
+			result["Spilled States"] = to_string(spilled_count);
+		}
+	}
 	SetEstimatedCardinality(result, estimated_cardinality);
 	return result;
 }
@@ -1,15 +1,41 @@
 #include "duckdb/execution/operator/aggregate/physical_partitioned_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/ungrouped_aggregate_state.hpp"
+#include "duckdb/execution/aggregate_hashtable.hpp"
+#include "duckdb/common/row_operations/row_operations.hpp"
+#include "duckdb/common/types/row/tuple_data_iterator.hpp"
 #include "duckdb/common/types/value_map.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/storage/temporary_memory_manager.hpp"
 
 namespace duckdb {
 
 PhysicalPartitionedAggregate::PhysicalPartitionedAggregate(ClientContext &context, vector<LogicalType> types,
                                                            vector<unique_ptr<Expression>> aggregates_p,
                                                            vector<unique_ptr<Expression>> groups_p,
-                                                           vector<column_t> partitions_p, idx_t estimated_cardinality)
+                                                           vector<column_t> partitions_p,
+                                                           vector<idx_t> partition_groups_p,
+                                                           idx_t estimated_cardinality)
     : PhysicalOperator(PhysicalOperatorType::PARTITIONED_AGGREGATE, std::move(types), estimated_cardinality),
-      partitions(std::move(partitions_p)), groups(std::move(groups_p)), aggregates(std::move(aggregates_p)) {
+      partitions(std::move(partitions_p)), partition_groups(std::move(partition_groups_p)),
+      groups(std::move(groups_p)), aggregates(std::move(aggregates_p)) {
+	D_ASSERT(partitions.size() == partition_groups.size());
+	if (SingleGroupPartitions()) {
+		return;
+	}
+	for (auto &group : groups) {
+		D_ASSERT(group->GetExpressionType() == ExpressionType::BOUND_REF);
+		group_types.push_back(group->return_type);
+	}
+	for (auto &aggregate : aggregates) {
+		auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+		D_ASSERT(!aggr.filter);
+		for (auto &child : aggr.children) {
+			D_ASSERT(child->GetExpressionType() == ExpressionType::BOUND_REF);
+			payload_types.push_back(child->return_type);
+		}
+		bindings.push_back(&aggr);
+	}
 }
 
 OperatorPartitionInfo PhysicalPartitionedAggregate::RequiredPartitionInfo() const {
@@ -23,6 +49,12 @@ public:
 	PartitionedAggregateLocalSinkState(const PhysicalPartitionedAggregate &op, const vector<LogicalType> &child_types,
 	                                   ExecutionContext &context)
 	    : execute_state(context.client, op.aggregates, child_types) {
+		if (!op.SingleGroupPartitions()) {
+			group_chunk.InitializeEmpty(op.group_types);
+			if (!op.payload_types.empty()) {
+				payload_chunk.InitializeEmpty(op.payload_types);
+			}
+		}
 	}
 
 	//! The current partition
@@ -31,20 +63,48 @@ public:
 	unique_ptr<LocalUngroupedAggregateState> state;
 	//! The ungrouped aggregate execute state
 	UngroupedAggregateExecuteState execute_state;
+	//! The local hash table for the current partition (if the partitions are a subset of the groups)
+	unique_ptr<GroupedAggregateHashTable> ht;
+	//! The group and payload chunks referencing the input of the hash table
+	DataChunk group_chunk;
+	DataChunk payload_chunk;
+};
+
+//! The aggregated rows of a single partition, these are combined and scanned by a single thread in the source
+//! Until then, they are unpinned, so that the buffer manager can spill them
+struct PartitionedAggregateData {
+	vector<unique_ptr<PartitionedTupleData>> data;
+	//! The total size of the data
+	idx_t size = 0;
 };
 
 class PartitionedAggregateGlobalSinkState : public GlobalSinkState {
 public:
 	PartitionedAggregateGlobalSinkState(const PhysicalPartitionedAggregate &op, ClientContext &context)
-	    : op(op), aggregate_result(BufferAllocator::Get(context), op.types) {
+	    : op(op), temporary_memory_state(TemporaryMemoryManager::Get(context).Register(context)),
+	      number_of_threads(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads())),
+	      aggregate_result(BufferAllocator::Get(context), op.types), finalize_done(0) {
 	}
+	~PartitionedAggregateGlobalSinkState() override;
 
 	mutex lock;
 	const PhysicalPartitionedAggregate &op;
+	//! Bounds the size of the thread-local hash tables, and reserves the memory of the partitions being scanned
+	unique_ptr<TemporaryMemoryState> temporary_memory_state;
+	const idx_t number_of_threads;
 	//! The per-partition aggregate states
 	value_map_t<unique_ptr<GlobalUngroupedAggregateState>> aggregate_states;
+	//! The per-partition aggregated data (if the partitions are a subset of the groups)
+	value_map_t<unique_ptr<PartitionedAggregateData>> partition_data;
+	//! The data in partition order, set in Finalize
+	vector<reference<PartitionedAggregateData>> partition_list;
+	//! Allocators (and spilled payloads) used by the aggregate states in the data, kept alive until the end
+	vector<shared_ptr<ArenaAllocator>> stored_allocators;
+	vector<shared_ptr<SpilledAggregateStates>> spilled_states;
 	//! Final aggregate result
 	ColumnDataCollection aggregate_result;
+	//! The number of partitions that have been combined in the source
+	atomic<idx_t> finalize_done;
 
 	GlobalUngroupedAggregateState &GetOrCreatePartition(ClientContext &context, const Value &partition) {
 		lock_guard<mutex> l(lock);
@@ -60,7 +120,53 @@ public:
 		return result;
 	}
 
+	//! Whether the local hash table outgrew its share of the reservation (after trying to increase the reservation)
+	bool ExceedsThreadLimit(ClientContext &context, idx_t ht_size) {
+		if (ht_size <= temporary_memory_state->GetReservation() / number_of_threads) {
+			return false;
+		}
+		lock_guard<mutex> l(lock);
+		if (ht_size > temporary_memory_state->GetReservation() / number_of_threads) {
+			auto remaining_size = MaxValue(number_of_threads * ht_size, temporary_memory_state->GetRemainingSize());
+			temporary_memory_state->SetRemainingSizeAndUpdateReservation(context, 2 * remaining_size);
+		}
+		return ht_size > temporary_memory_state->GetReservation() / number_of_threads;
+	}
+
+	//! Move the rows of the local hash table into the data of its partition, and start over with an empty table
+	void FlushHashTable(PartitionedAggregateLocalSinkState &lstate) {
+		auto &ht = *lstate.ht;
+		auto data = ht.AcquirePartitionedData();
+		// the states are not updated until they are combined in the source: spill the payloads of their states
+		ht.SpillStates(*data);
+		ht.Abandon();
+		if (data->Count() == 0) {
+			return;
+		}
+		lock_guard<mutex> l(lock);
+		auto &entry = partition_data[lstate.current_partition];
+		if (!entry) {
+			entry = make_uniq<PartitionedAggregateData>();
+		}
+		entry->size += data->SizeInBytes();
+		entry->data.push_back(std::move(data));
+	}
+
 	void Combine(ClientContext &context, PartitionedAggregateLocalSinkState &lstate) {
+		if (lstate.ht) {
+			// move the data of this partition into the global state - it is combined in the source
+			FlushHashTable(lstate);
+			lock_guard<mutex> l(lock);
+			stored_allocators.push_back(lstate.ht->GetAggregateAllocator());
+			if (lstate.ht->GetSpillableAllocator()) {
+				stored_allocators.push_back(lstate.ht->GetSpillableAllocator());
+			}
+			if (lstate.ht->GetSpilledStates()) {
+				spilled_states.push_back(lstate.ht->GetSpilledStates());
+			}
+			lstate.ht.reset();
+			return;
+		}
 		if (!lstate.state) {
 			// no aggregate state
 			return;
@@ -72,6 +178,35 @@ public:
 	}
 };
 
+PartitionedAggregateGlobalSinkState::~PartitionedAggregateGlobalSinkState() {
+	// LCOV_EXCL_START
+	// call the destructors of the states that were never combined (e.g., because the query was interrupted)
+	if (op.SingleGroupPartitions() || stored_allocators.empty()) {
+		return;
+	}
+	RowOperationsState row_state(*stored_allocators.back());
+	for (auto &entry : partition_data) {
+		for (auto &data : entry.second->data) {
+			if (!data) {
+				continue;
+			}
+			for (auto &collection : data->GetPartitions()) {
+				if (collection->Count() == 0 || !collection->GetLayout().HasDestructor()) {
+					continue;
+				}
+				auto layout = collection->GetLayout().Copy();
+				TupleDataChunkIterator iterator(*collection, TupleDataPinProperties::DESTROY_AFTER_DONE, false);
+				auto &row_locations = iterator.GetChunkState().row_locations;
+				do {
+					RowOperations::DestroyStates(row_state, layout, row_locations, iterator.GetCurrentChunkCount());
+				} while (iterator.Next());
+				collection->Reset();
+			}
+		}
+	}
+	// LCOV_EXCL_STOP
+}
+
 unique_ptr<GlobalSinkState> PhysicalPartitionedAggregate::GetGlobalSinkState(ClientContext &context) const {
 	return make_uniq<PartitionedAggregateGlobalSinkState>(*this, context);
 }
@@ -92,18 +227,46 @@ SinkResultType PhysicalPartitionedAggregate::Sink(ExecutionContext &context, Dat
                                                   OperatorSinkInput &input) const {
 	auto &gstate = input.global_state.Cast<PartitionedAggregateGlobalSinkState>();
 	auto &lstate = input.local_state.Cast<PartitionedAggregateLocalSinkState>();
-	if (!lstate.state) {
+	if (!lstate.state && !lstate.ht) {
 		// the local state is not yet initialized for this partition
 		// initialize the partition
 		child_list_t<Value> partition_values;
-		for (idx_t partition_idx = 0; partition_idx < groups.size(); partition_idx++) {
+		for (idx_t partition_idx = 0; partition_idx < partitions.size(); partition_idx++) {
 			auto column_name = to_string(partition_idx);
 			auto &partition = input.local_state.partition_info.partition_data[partition_idx];
 			D_ASSERT(Value::NotDistinctFrom(partition.min_val, partition.max_val));
 			partition_values.emplace_back(make_pair(std::move(column_name), partition.min_val));
 		}
 		lstate.current_partition = Value::STRUCT(std::move(partition_values));
-
+	}
+	if (!SingleGroupPartitions()) {
+		// aggregate the chunk into the hash table of this partition
+		if (!lstate.ht) {
+			lstate.ht = make_uniq<GroupedAggregateHashTable>(context.client, BufferAllocator::Get(context.client),
+			                                                 group_types, payload_types, bindings);
+		}
+		for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+			auto &ref = groups[group_idx]->Cast<BoundReferenceExpression>();
+			lstate.group_chunk.data[group_idx].Reference(chunk.data[ref.index]);
+		}
+		lstate.group_chunk.SetCardinality(chunk);
+		idx_t payload_idx = 0;
+		for (auto &aggregate : aggregates) {
+			auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+			for (auto &child : aggr.children) {
+				auto &ref = child->Cast<BoundReferenceExpression>();
+				lstate.payload_chunk.data[payload_idx++].Reference(chunk.data[ref.index]);
+			}
+		}
+		lstate.payload_chunk.SetCardinality(chunk);
+		lstate.ht->AddChunk(lstate.group_chunk, lstate.payload_chunk, AggregateType::NON_DISTINCT);
+		if (gstate.ExceedsThreadLimit(context.client, lstate.ht->GetPartitionedData().SizeInBytes())) {
+			// a large batch: move what we have aggregated so far out of memory, the source combines it again
+			gstate.FlushHashTable(lstate);
+		}
+		return SinkResultType::NEED_MORE_INPUT;
+	}
+	if (!lstate.state) {
 		// initialize the state
 		auto &global_aggregate_state = gstate.GetOrCreatePartition(context.client, lstate.current_partition);
 		lstate.state = make_uniq<LocalUngroupedAggregateState>(global_aggregate_state);
@@ -145,6 +308,19 @@ SinkCombineResultType PhysicalPartitionedAggregate::Combine(ExecutionContext &co
 SinkFinalizeType PhysicalPartitionedAggregate::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                                         OperatorSinkFinalizeInput &input) const {
 	auto &gstate = input.global_state.Cast<PartitionedAggregateGlobalSinkState>();
+	if (!SingleGroupPartitions()) {
+		// every partition is combined and scanned independently by the source
+		// every thread needs the memory for the partition it is combining
+		idx_t max_partition_size = 0;
+		for (auto &entry : gstate.partition_data) {
+			gstate.partition_list.push_back(*entry.second);
+			max_partition_size = MaxValue(max_partition_size, entry.second->size);
+		}
+		const auto max_threads = MinValue(gstate.number_of_threads, gstate.partition_list.size());
+		gstate.temporary_memory_state->SetMinimumReservation(max_partition_size);
+		gstate.temporary_memory_state->SetRemainingSizeAndUpdateReservation(context, max_threads * max_partition_size);
+		return SinkFinalizeType::READY;
+	}
 	ColumnDataAppendState append_state;
 	gstate.aggregate_result.InitializeAppend(append_state);
 	// finalize each of the partitions and append to a ColumnDataCollection
@@ -171,15 +347,47 @@ SinkFinalizeType PhysicalPartitionedAggregate::Finalize(Pipeline &pipeline, Even
 //===--------------------------------------------------------------------===//
 class PartitionedAggregateGlobalSourceState : public GlobalSourceState {
 public:
-	explicit PartitionedAggregateGlobalSourceState(PartitionedAggregateGlobalSinkState &gstate) {
+	explicit PartitionedAggregateGlobalSourceState(PartitionedAggregateGlobalSinkState &gstate)
+	    : next_partition(0) {
 		gstate.aggregate_result.InitializeScan(scan_state);
+		partition_count = gstate.partition_list.size();
 	}
 
 	ColumnDataScanState scan_state;
+	//! The next partition to combine and scan (if the partitions are a subset of the groups)
+	atomic<idx_t> next_partition;
+	idx_t partition_count;
 
 	idx_t MaxThreads() override {
-		return 1;
+		return MaxValue<idx_t>(partition_count, 1);
+	}
+};
+
+class PartitionedAggregateLocalSourceState : public LocalSourceState {
+public:
+	PartitionedAggregateLocalSourceState(const PhysicalPartitionedAggregate &op, ClientContext &context)
+	    : aggregate_allocator(BufferAllocator::Get(context)) {
+		if (op.SingleGroupPartitions()) {
+			return;
+		}
+		auto scan_chunk_types = op.group_types;
+		for (auto &binding : op.bindings) {
+			scan_chunk_types.push_back(binding->return_type);
+		}
+		scan_chunk.Initialize(context, scan_chunk_types);
+		for (idx_t group_idx = 0; group_idx < op.group_types.size(); group_idx++) {
+			column_ids.push_back(group_idx);
+		}
 	}
+
+	//! The hash table in which the data of the partition that is currently being scanned is combined
+	unique_ptr<GroupedAggregateHashTable> ht;
+	unique_ptr<PartitionedTupleData> data;
+	TupleDataLayout layout;
+	TupleDataScanState scan_state;
+	vector<column_t> column_ids;
+	DataChunk scan_chunk;
+	ArenaAllocator aggregate_allocator;
 };
 
 unique_ptr<GlobalSourceState> PhysicalPartitionedAggregate::GetGlobalSourceState(ClientContext &context) const {
@@ -187,12 +395,69 @@ unique_ptr<GlobalSourceState> PhysicalPartitionedAggregate::GetGlobalSourceState
 	return make_uniq<PartitionedAggregateGlobalSourceState>(gstate);
 }
 
+unique_ptr<LocalSourceState> PhysicalPartitionedAggregate::GetLocalSourceState(ExecutionContext &context,
+                                                                               GlobalSourceState &gstate) const {
+	return make_uniq<PartitionedAggregateLocalSourceState>(*this, context.client);
+}
+
 SourceResultType PhysicalPartitionedAggregate::GetData(ExecutionContext &context, DataChunk &chunk,
                                                        OperatorSourceInput &input) const {
 	auto &gstate = sink_state->Cast<PartitionedAggregateGlobalSinkState>();
 	auto &gsource = input.global_state.Cast<PartitionedAggregateGlobalSourceState>();
-	gstate.aggregate_result.Scan(gsource.scan_state, chunk);
-	return chunk.size() == 0 ? SourceResultType::FINISHED : SourceResultType::HAVE_MORE_OUTPUT;
+	if (SingleGroupPartitions()) {
+		gstate.aggregate_result.Scan(gsource.scan_state, chunk);
+		return chunk.size() == 0 ? SourceResultType::FINISHED : SourceResultType::HAVE_MORE_OUTPUT;
+	}
+	auto &lsource = input.local_state.Cast<PartitionedAggregateLocalSourceState>();
+	while (true) {
+		if (!lsource.data) {
+			// claim the next partition and combine its hash tables
+			auto partition_idx = gsource.next_partition++;
+			if (partition_idx >= gsource.partition_count) {
+				return SourceResultType::FINISHED;
+			}
+			auto &partition = gstate.partition_list[partition_idx].get();
+			lsource.ht = make_uniq<GroupedAggregateHashTable>(context.client, BufferAllocator::Get(context.client),
+			                                                  group_types, payload_types, bindings);
+			for (auto &data : partition.data) {
+				for (auto &data_collection : data->GetPartitions()) {
+					lsource.ht->Combine(*data_collection);
+				}
+				data.reset();
+			}
+			partition.data.clear();
+			if (++gstate.finalize_done == gsource.partition_count) {
+				// all partitions are combined
+				gstate.temporary_memory_state->SetZero();
+			}
+			lsource.layout = lsource.ht->GetLayout().Copy();
+			lsource.data = lsource.ht->AcquirePartitionedData();
+			auto &collection = *lsource.data->GetPartitions()[0];
+			collection.InitializeScan(lsource.scan_state, lsource.column_ids,
+			                          TupleDataPinProperties::DESTROY_AFTER_DONE);
+		}
+		auto &collection = *lsource.data->GetPartitions()[0];
+		if (!collection.Scan(lsource.scan_state, lsource.scan_chunk)) {
+			// this partition is done - release its memory before moving on to the next one
+			lsource.data.reset();
+			lsource.ht.reset();
+			continue;
+		}
+		auto &layout = lsource.layout;
+		RowOperationsState row_state(lsource.aggregate_allocator);
+		const auto group_cols = layout.ColumnCount() - 1;
+		RowOperations::FinalizeStates(row_state, layout, lsource.scan_state.chunk_state.row_locations,
+		                              lsource.scan_chunk, group_cols);
+		if (layout.HasDestructor()) {
+			RowOperations::DestroyStates(row_state, layout, lsource.scan_state.chunk_state.row_locations,
+			                             lsource.scan_chunk.size());
+		}
+		for (idx_t col_idx = 0; col_idx < chunk.ColumnCount(); col_idx++) {
+			chunk.data[col_idx].Reference(lsource.scan_chunk.data[col_idx]);
+		}
+		chunk.SetCardinality(lsource.scan_chunk);
+		return SourceResultType::HAVE_MORE_OUTPUT;
+	}
 }
 
 //===--------------------------------------------------------------------===//
@@ -200,6 +465,14 @@ SourceResultType PhysicalPartitionedAggregate::GetData(ExecutionContext &context
 //===--------------------------------------------------------------------===//
 InsertionOrderPreservingMap<string> PhysicalPartitionedAggregate::ParamsToString() const {
 	InsertionOrderPreservingMap<string> result;
+	string partitions_info;
+	for (idx_t i = 0; i < partition_groups.size(); i++) {
+		if (i > 0) {
+			partitions_info += "\n";
+		}
+		partitions_info += groups[partition_groups[i]]->GetName();
+	}
+	result["Partitions"] = partitions_info;
 	string groups_info;
 	for (idx_t i = 0; i < groups.size(); i++) {
 		if (i > 0) {
@@ -23,13 +23,59 @@ public:
 	std::atomic<int64_t> row_number;
 };
 
+static bool ComputeRowsOffset(ClientContext &context, const unique_ptr<Expression> &expr, idx_t &offset) {
+	if (!expr || expr->HasParameter() || !expr->IsFoldable()) {
+		return false;
+	}
+	auto offset_value = ExpressionExecutor::EvaluateScalar(context, *expr);
+	Value bigint_value;
+	if (offset_value.IsNull() || !offset_value.DefaultTryCastAs(LogicalType::BIGINT, bigint_value, nullptr, false)) {
+		return false;
+	}
+	const auto value = bigint_value.GetValue<int64_t>();
+	if (value < 0) {
+		return false;
+	}
+	offset = NumericCast<idx_t>(value);
+	//	The frame must fit into a single vector
+	return offset < STANDARD_VECTOR_SIZE;
+}
+
 class StreamingWindowState : public OperatorState {
 public:
 	struct AggregateState {
+		//! Compute the offsets of a bounded ROWS frame (N PRECEDING to CURRENT ROW or M PRECEDING)
+		static bool ComputeFrame(ClientContext &context, const BoundWindowExpression &wexpr, idx_t &frame_begin,
+		                         idx_t &frame_end) {
+			if (wexpr.start != WindowBoundary::EXPR_PRECEDING_ROWS ||
+			    !ComputeRowsOffset(context, wexpr.start_expr, frame_begin)) {
+				return false;
+			}
+			switch (wexpr.end) {
+			case WindowBoundary::CURRENT_ROW_ROWS:
+				frame_end = 0;
+				break;
+			case WindowBoundary::EXPR_PRECEDING_ROWS:
+				if (!ComputeRowsOffset(context, wexpr.end_expr, frame_end)) {
+					return false;
+				}
+				break;
+			default:
+				return false;
+			}
+			//	The ring buffer only holds fixed size arguments
+			for (const auto &child : wexpr.children) {
+				if (!TypeIsConstantSize(child->return_type.InternalType())) {
+					return false;
+				}
+			}
+			return true;
+		}
+
 		AggregateState(ClientContext &client, BoundWindowExpression &wexpr, Allocator &allocator)
 		    : wexpr(wexpr), arena_allocator(Allocator::DefaultAllocator()), executor(client), filter_executor(client),
-		      statev(LogicalType::POINTER, data_ptr_cast(&state_ptr)), hashes(LogicalType::HASH),
-		      addresses(LogicalType::POINTER) {
+		      statev(LogicalType::POINTER, data_ptr_cast(&state_ptr)), statec(LogicalType::POINTER),
+		      hashes(LogicalType::HASH), addresses(LogicalType::POINTER) {
 			D_ASSERT(wexpr.GetExpressionType() == ExpressionType::WINDOW_AGGREGATE);
 			auto &aggregate = *wexpr.aggregate;
 			bind_data = wexpr.bind_info.get();
@@ -54,6 +100,20 @@ public:
 				distinct_args.Initialize(allocator, arg_types);
 				distinct_sel.Initialize();
 			}
+			if (ComputeFrame(client, wexpr, frame_begin, frame_end)) {
+				moving = true;
+				ring_capacity = frame_begin + STANDARD_VECTOR_SIZE;
+				if (!arg_types.empty()) {
+					ring.Initialize(allocator, arg_types, ring_capacity);
+					frame_args.InitializeEmpty(arg_types);
+				}
+				ring_filter.Initialize(ring_capacity);
+				frame_sel.Initialize();
+				statec.Reference(Value::POINTER(CastPointerToValue(state.data())));
+				if (wexpr.filter_expr) {
+					filter_sel.Initialize();
+				}
+			}
 		}
 
 		~AggregateState() {
@@ -64,7 +124,11 @@ public:
 			}
 		}
 
-		void Execute(ExecutionContext &context, DataChunk &input, Vector &result);
+		void Execute(ExecutionContext &context, DataChunk &input, const ValidityMask &partition_mask,
+		             idx_t partition_offset, Vector &result);
+		void ExecuteMoving(DataChunk &input, const ValidityMask &partition_mask, idx_t partition_offset,
+		                   Vector &result);
+		void ResetState();
 
 		//! The aggregate expression
 		BoundWindowExpression &wexpr;
@@ -80,6 +144,8 @@ public:
 		data_ptr_t state_ptr = nullptr;
 		//! The state vector for the single state
 		Vector statev;
+		//! A constant vector pointing to the single state (for updating it with a whole frame)
+		Vector statec;
 		//! The aggregate binding data (if any)
 		FunctionData *bind_data = nullptr;
 		//! The aggregate state destructor (if any)
@@ -105,6 +171,25 @@ public:
 		SelectionVector distinct_sel;
 		//! Pointers to groups in the hash table.
 		Vector addresses;
+
+		//! Whether the frame is a bounded number of preceding rows
+		bool moving = false;
+		//! The number of rows the frame begins before the current row
+		idx_t frame_begin = 0;
+		//! The number of rows the (inclusive) frame end is before the current row
+		idx_t frame_end = 0;
+		//! Ring buffer of the arguments of the last rows (large enough for the frame and a new chunk)
+		DataChunk ring;
+		//! The number of rows the ring buffer can hold
+		idx_t ring_capacity = 0;
+		//! The ring buffer position of the next row
+		idx_t ring_head = 0;
+		//! The FILTER results of the rows in the ring buffer
+		ValidityMask ring_filter;
+		//! The ring buffer rows of the current frame
+		SelectionVector frame_sel;
+		//! The arguments of the current frame (a slice of the ring buffer)
+		DataChunk frame_args;
 	};
 
 	struct LeadLagState {
@@ -256,7 +341,8 @@ public:
 		Vector temp;
 	};
 
-	explicit StreamingWindowState(ClientContext &client) : initialized(false), allocator(Allocator::Get(client)) {
+	explicit StreamingWindowState(ClientContext &client)
+	    : initialized(false), allocator(Allocator::Get(client)), partition_executor(client) {
 	}
 
 	~StreamingWindowState() override {
@@ -311,9 +397,70 @@ public:
 			delayed.Initialize(context, input.GetTypes(), lead_count + STANDARD_VECTOR_SIZE);
 			shifted.Initialize(context, input.GetTypes(), lead_count + STANDARD_VECTOR_SIZE);
 		}
+
+		//	The functions share their partitions, which the input is sorted on
+		auto &wexpr = expressions[0]->Cast<BoundWindowExpression>();
+		if (!wexpr.partitions.empty()) {
+			vector<LogicalType> partition_types;
+			for (auto &partition : wexpr.partitions) {
+				partition_types.emplace_back(partition->return_type);
+				partition_executor.AddExpression(*partition);
+			}
+			partition_chunk.Initialize(allocator, partition_types);
+			partition_sel.Initialize();
+		}
+		partition_mask.Initialize(STANDARD_VECTOR_SIZE);
 		initialized = true;
 	}
 
+	//! Mark the rows that begin a new partition
+	void ComputePartitions(DataChunk &input) {
+		const auto count = input.size();
+		partition_mask.SetAllInvalid(count);
+		if (!partition_chunk.ColumnCount() || !count) {
+			return;
+		}
+
+		partition_chunk.Reset();
+		partition_executor.Execute(input, partition_chunk);
+
+		//	The first row continues the partition of the last row of the previous chunk
+		bool first = prev_partition.empty();
+		for (idx_t col_idx = 0; !first && col_idx < partition_chunk.ColumnCount(); ++col_idx) {
+			first = !Value::NotDistinctFrom(partition_chunk.GetValue(col_idx, 0), prev_partition[col_idx]);
+		}
+		if (first) {
+			partition_mask.SetValid(0);
+		}
+
+		//	The other rows are compared to their predecessor
+		if (count > 1) {
+			for (auto &keys : partition_chunk.data) {
+				Vector curr(keys, 1, count);
+				const auto distinct = VectorOperations::DistinctFrom(curr, keys, nullptr, count - 1, &partition_sel,
+				                                                     nullptr);
+				for (idx_t i = 0; i < distinct; ++i) {
+					partition_mask.SetValid(partition_sel.get_index(i) + 1);
+				}
+			}
+		}
+
+		prev_partition.clear();
+		for (idx_t col_idx = 0; col_idx < partition_chunk.ColumnCount(); ++col_idx) {
+			prev_partition.emplace_back(partition_chunk.GetValue(col_idx, count - 1));
+		}
+	}
+
+	//! The row number in its partition of the first row of the next chunk
+	void AdvancePartitions(idx_t count) {
+		for (idx_t i = 0; i < count; ++i) {
+			if (partition_mask.RowIsValid(i)) {
+				partition_offset = 0;
+			}
+			++partition_offset;
+		}
+	}
+
 	static inline void Reset(DataChunk &chunk) {
 		//	Reset trashes the capacity...
 		const auto capacity = chunk.GetCapacity();
@@ -337,31 +484,81 @@ public:
 	DataChunk delayed;
 	//! A buffer for shifting delayed input
 	DataChunk shifted;
+	//! Executor for the partition keys (if any)
+	ExpressionExecutor partition_executor;
+	//! The partition keys of the current chunk
+	DataChunk partition_chunk;
+	//! The partition keys of the last row of the previous chunk
+	vector<Value> prev_partition;
+	//! The rows of the current chunk that begin a new partition
+	ValidityMask partition_mask;
+	//! The rows of the current chunk whose keys differ from the previous row
+	SelectionVector partition_sel;
+	//! The number of rows of the current partition before the current chunk
+	idx_t partition_offset = 0;
 };
 
-bool PhysicalStreamingWindow::IsStreamingFunction(ClientContext &context, unique_ptr<Expression> &expr) {
+//! Whether the input is sorted on the partitions (in any order) followed by the orders of the function
+static bool IsSortedInput(const BoundWindowExpression &wexpr, const vector<BoundOrderByNode> &input_orders) {
+	const auto partition_count = wexpr.partitions.size();
+	if (input_orders.size() < partition_count + wexpr.orders.size()) {
+		return false;
+	}
+	expression_set_t partitions;
+	for (const auto &partition : wexpr.partitions) {
+		partitions.insert(*partition);
+	}
+	for (idx_t i = 0; i < partition_count; ++i) {
+		if (!partitions.count(*input_orders[i].expression)) {
+			return false;
+		}
+	}
+	for (idx_t i = 0; i < wexpr.orders.size(); ++i) {
+		if (!wexpr.orders[i].Equals(input_orders[partition_count + i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool PhysicalStreamingWindow::IsStreamingFunction(ClientContext &context, unique_ptr<Expression> &expr,
+                                                  const vector<BoundOrderByNode> &input_orders) {
 	auto &wexpr = expr->Cast<BoundWindowExpression>();
-	if (!wexpr.partitions.empty() || !wexpr.orders.empty() || wexpr.ignore_nulls || !wexpr.arg_orders.empty() ||
-	    wexpr.exclude_clause != WindowExcludeMode::NO_OTHER) {
+	if (wexpr.ignore_nulls || !wexpr.arg_orders.empty() || wexpr.exclude_clause != WindowExcludeMode::NO_OTHER) {
+		return false;
+	}
+	//	Partitions and orders are only possible if the input arrives in that order
+	const auto sorted = !wexpr.partitions.empty() || !wexpr.orders.empty();
+	if (sorted && !IsSortedInput(wexpr, input_orders)) {
 		return false;
 	}
 	switch (wexpr.GetExpressionType()) {
 	// TODO: add more expression types here?
-	case ExpressionType::WINDOW_AGGREGATE:
+	case ExpressionType::WINDOW_AGGREGATE: {
 		// We can stream aggregates if they are "running totals"
-		return wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING && wexpr.end == WindowBoundary::CURRENT_ROW_ROWS;
+		if (wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING && wexpr.end == WindowBoundary::CURRENT_ROW_ROWS) {
+			// (the distinct values are not reset between partitions)
+			return !wexpr.distinct || wexpr.partitions.empty();
+		}
+		// ... or if they only look back a bounded number of rows
+		idx_t frame_begin;
+		idx_t frame_end;
+		return !wexpr.distinct && StreamingWindowState::AggregateState::ComputeFrame(context, wexpr, frame_begin,
+		                                                                              frame_end);
+	}
+	case ExpressionType::WINDOW_ROW_NUMBER:
+		return true;
 	case ExpressionType::WINDOW_FIRST_VALUE:
 	case ExpressionType::WINDOW_PERCENT_RANK:
 	case ExpressionType::WINDOW_RANK:
 	case ExpressionType::WINDOW_RANK_DENSE:
-	case ExpressionType::WINDOW_ROW_NUMBER:
-		return true;
+		return !sorted;
 	case ExpressionType::WINDOW_LAG:
 	case ExpressionType::WINDOW_LEAD: {
 		// We can stream LEAD/LAG if the arguments are constant and the delta is less than a block behind
 		Value dflt;
 		int64_t offset;
-		return StreamingWindowState::LeadLagState::ComputeDefault(context, wexpr, dflt) &&
+		return !sorted && StreamingWindowState::LeadLagState::ComputeDefault(context, wexpr, dflt) &&
 		       StreamingWindowState::LeadLagState::ComputeOffset(context, wexpr, offset);
 	}
 	default:
@@ -377,7 +574,93 @@ unique_ptr<OperatorState> PhysicalStreamingWindow::GetOperatorState(ExecutionCon
 	return make_uniq<StreamingWindowState>(context.client);
 }
 
-void StreamingWindowState::AggregateState::Execute(ExecutionContext &context, DataChunk &input, Vector &result) {
+void StreamingWindowState::AggregateState::ResetState() {
+	auto &aggregate = *wexpr.aggregate;
+	AggregateInputData aggr_input_data(bind_data, arena_allocator);
+	state_ptr = state.data();
+	if (dtor) {
+		dtor(statev, aggr_input_data, 1);
+	}
+	aggregate.initialize(aggregate, state.data());
+}
+
+void StreamingWindowState::AggregateState::ExecuteMoving(DataChunk &input, const ValidityMask &partition_mask,
+                                                         idx_t partition_offset, Vector &result) {
+	const idx_t count = input.size();
+	auto &aggregate = *wexpr.aggregate;
+
+	//	Append the arguments to the ring buffer
+	if (!arg_types.empty()) {
+		arg_chunk.Reset();
+		executor.Execute(input, arg_chunk);
+		const auto head_count = MinValue<idx_t>(count, ring_capacity - ring_head);
+		for (idx_t col_idx = 0; col_idx < arg_chunk.ColumnCount(); ++col_idx) {
+			auto &source = arg_chunk.data[col_idx];
+			auto &target = ring.data[col_idx];
+			VectorOperations::Copy(source, target, head_count, 0, ring_head);
+			VectorOperations::Copy(source, target, count, head_count, 0);
+		}
+	}
+
+	//	Record which of the rows pass the FILTER
+	if (wexpr.filter_expr) {
+		const auto filtered = filter_executor.SelectExpression(input, filter_sel);
+		for (idx_t i = 0; i < count; ++i) {
+			ring_filter.SetInvalid((ring_head + i) % ring_capacity);
+		}
+		for (idx_t f = 0; f < filtered; ++f) {
+			ring_filter.SetValid((ring_head + filter_sel.get_index(f)) % ring_capacity);
+		}
+	}
+
+	//	Aggregate the frame of each row from the ring buffer
+	auto counts = wexpr.children.empty() ? FlatVector::GetData<int64_t>(result) : nullptr;
+	AggregateInputData aggr_input_data(wexpr.bind_info.get(), arena_allocator);
+	auto pos = partition_offset;
+	for (idx_t i = 0; i < count; ++i, ++pos) {
+		if (partition_mask.RowIsValid(i)) {
+			pos = 0;
+		}
+		idx_t frame_count = 0;
+		if (pos >= frame_end) {
+			//	Frame positions are relative to the partition, which never begins before the ring buffer
+			const auto row_idx = ring_head + i + ring_capacity;
+			const auto begin = pos - MinValue(pos, frame_begin);
+			const auto end = pos - frame_end + 1;
+			for (auto frame_pos = begin; frame_pos < end; ++frame_pos) {
+				const auto ring_idx = (row_idx - (pos - frame_pos)) % ring_capacity;
+				if (ring_filter.RowIsValid(ring_idx)) {
+					frame_sel.set_index(frame_count++, ring_idx);
+				}
+			}
+		}
+
+		// Check for COUNT(*)
+		if (counts) {
+			counts[i] = NumericCast<int64_t>(frame_count);
+			continue;
+		}
+
+		if (frame_count) {
+			frame_args.Slice(ring, frame_sel, frame_count);
+			aggregate.update(frame_args.data.data(), aggr_input_data, frame_args.ColumnCount(), statec, frame_count);
+		}
+		aggregate.finalize(statev, aggr_input_data, result, 1, i);
+		ResetState();
+	}
+
+	ring_head = (ring_head + count) % ring_capacity;
+	arena_allocator.Reset();
+}
+
+void StreamingWindowState::AggregateState::Execute(ExecutionContext &context, DataChunk &input,
+                                                   const ValidityMask &partition_mask, idx_t partition_offset,
+                                                   Vector &result) {
+	if (moving) {
+		ExecuteMoving(input, partition_mask, partition_offset, result);
+		return;
+	}
+
 	//	Establish the aggregation environment
 	const idx_t count = input.size();
 	auto &aggregate = *wexpr.aggregate;
@@ -405,6 +688,9 @@ void StreamingWindowState::AggregateState::Execute(ExecutionContext &context, Da
 		auto data = FlatVector::GetData<int64_t>(result);
 		auto &unfiltered = aggr_state.unfiltered;
 		for (idx_t i = 0; i < count; ++i) {
+			if (partition_mask.RowIsValid(i)) {
+				unfiltered = 0;
+			}
 			unfiltered += int64_t(filter_mask.RowIsValid(i));
 			data[i] = unfiltered;
 		}
@@ -469,6 +755,9 @@ void StreamingWindowState::AggregateState::Execute(ExecutionContext &context, Da
 	AggregateInputData aggr_input_data(wexpr.bind_info.get(), aggr_state.arena_allocator);
 	for (idx_t i = 0; i < count; ++i) {
 		sel.set_index(0, i);
+		if (partition_mask.RowIsValid(i)) {
+			ResetState();
+		}
 		for (const auto struct_idx : structs) {
 			arg_cursor.data[struct_idx].Slice(arg_chunk.data[struct_idx], sel, 1);
 		}
@@ -487,13 +776,16 @@ void PhysicalStreamingWindow::ExecuteFunctions(ExecutionContext &context, DataCh
 	// Compute window functions
 	const idx_t count = output.size();
 	const column_t input_width = children[0]->GetTypes().size();
+	state.ComputePartitions(output);
+	const auto &partition_mask = state.partition_mask;
+	const auto partition_offset = state.partition_offset;
 	for (column_t expr_idx = 0; expr_idx < select_list.size(); expr_idx++) {
 		column_t col_idx = input_width + expr_idx;
 		auto &expr = *select_list[expr_idx];
 		auto &result = output.data[col_idx];
 		switch (expr.GetExpressionType()) {
 		case ExpressionType::WINDOW_AGGREGATE:
-			state.aggregate_states[expr_idx]->Execute(context, output, result);
+			state.aggregate_states[expr_idx]->Execute(context, output, partition_mask, partition_offset, result);
 			break;
 		case ExpressionType::WINDOW_FIRST_VALUE:
 		case ExpressionType::WINDOW_PERCENT_RANK:
@@ -505,8 +797,19 @@ void PhysicalStreamingWindow::ExecuteFunctions(ExecutionContext &context, DataCh
 		}
 		case ExpressionType::WINDOW_ROW_NUMBER: {
 			// Set row numbers
-			int64_t start_row = gstate.row_number;
 			auto rdata = FlatVector::GetData<int64_t>(output.data[col_idx]);
+			if (state.partition_chunk.ColumnCount()) {
+				// Restart the numbering at each partition
+				auto row_number = NumericCast<int64_t>(partition_offset);
+				for (idx_t i = 0; i < count; i++) {
+					if (partition_mask.RowIsValid(i)) {
+						row_number = 0;
+					}
+					rdata[i] = ++row_number;
+				}
+				break;
+			}
+			int64_t start_row = gstate.row_number;
 			for (idx_t i = 0; i < count; i++) {
 				rdata[i] = NumericCast<int64_t>(start_row + NumericCast<int64_t>(i));
 			}
@@ -521,6 +824,7 @@ void PhysicalStreamingWindow::ExecuteFunctions(ExecutionContext &context, DataCh
 		}
 	}
 	gstate.row_number += NumericCast<int64_t>(count);
+	state.AdvancePartitions(count);
 }
 
 void PhysicalStreamingWindow::ExecuteInput(ExecutionContext &context, DataChunk &delayed, DataChunk &input,
@@ -32,6 +32,14 @@ public:
 
 	ExecutorGlobalStates &Initialize(WindowGlobalSinkState &gstate);
 
+	//! The partition boundary mask of a window function (refined partitions are an order prefix)
+	ValidityMask &GetPartitionMask(const BoundWindowExpression &wexpr) {
+		if (wexpr.partitions.size() > partition_count) {
+			return order_masks[wexpr.partitions.size()];
+		}
+		return partition_mask;
+	}
+
 	// Scan all of the blocks during the build phase
 	unique_ptr<RowDataCollectionScanner> GetBuildScanner(idx_t block_idx) const {
 		if (!rows) {
@@ -86,6 +94,8 @@ public:
 	ValidityMask partition_mask;
 	//! The order boundary mask
 	OrderMasks order_masks;
+	//! The number of partition columns of the hash partitioning
+	idx_t partition_count = 0;
 	//! The fully materialised data collection
 	unique_ptr<WindowCollection> collection;
 	//! External paging
@@ -133,14 +143,17 @@ public:
 	Executors executors;
 	//! The shared expressions library
 	WindowSharedExpressions shared;
+	//! The executor whose global state each executor uses
+	vector<idx_t> state_owners;
 };
 
 class WindowPartitionGlobalSinkState : public PartitionGlobalSinkState {
 public:
 	using WindowHashGroupPtr = unique_ptr<WindowHashGroup>;
 
-	WindowPartitionGlobalSinkState(WindowGlobalSinkState &gsink, const BoundWindowExpression &wexpr)
-	    : PartitionGlobalSinkState(gsink.context, wexpr.partitions, wexpr.orders, gsink.op.children[0]->types,
+	WindowPartitionGlobalSinkState(WindowGlobalSinkState &gsink, const BoundWindowExpression &wexpr,
+	                               const vector<BoundOrderByNode> &orders)
+	    : PartitionGlobalSinkState(gsink.context, wexpr.partitions, orders, gsink.op.children[0]->types,
 	                               wexpr.partitions_stats, gsink.op.estimated_cardinality),
 	      gsink(gsink) {
 	}
@@ -184,9 +197,10 @@ public:
 PhysicalWindow::PhysicalWindow(vector<LogicalType> types, vector<unique_ptr<Expression>> select_list_p,
                                idx_t estimated_cardinality, PhysicalOperatorType type)
     : PhysicalOperator(type, std::move(types), estimated_cardinality), select_list(std::move(select_list_p)),
-      order_idx(0), is_order_dependent(false) {
+      order_idx(0), partition_idx(0), is_order_dependent(false) {
 
 	idx_t max_orders = 0;
+	idx_t min_partitions = NumericLimits<idx_t>::Maximum();
 	for (idx_t i = 0; i < select_list.size(); ++i) {
 		auto &expr = select_list[i];
 		D_ASSERT(expr->GetExpressionClass() == ExpressionClass::BOUND_WINDOW);
@@ -195,9 +209,15 @@ PhysicalWindow::PhysicalWindow(vector<LogicalType> types, vector<unique_ptr<Expr
 			is_order_dependent = true;
 		}
 
-		if (bound_window.orders.size() > max_orders) {
+		//	Refined partitions are sorted before the orders
+		const auto orders = bound_window.partitions.size() + bound_window.orders.size();
+		if (orders > max_orders) {
 			order_idx = i;
-			max_orders = bound_window.orders.size();
+			max_orders = orders;
+		}
+		if (bound_window.partitions.size() < min_partitions) {
+			partition_idx = i;
+			min_partitions = bound_window.partitions.size();
 		}
 	}
 }
@@ -239,6 +259,7 @@ WindowGlobalSinkState::WindowGlobalSinkState(const PhysicalWindow &op, ClientCon
 
 	D_ASSERT(op.select_list[op.order_idx]->GetExpressionClass() == ExpressionClass::BOUND_WINDOW);
 	auto &wexpr = op.select_list[op.order_idx]->Cast<BoundWindowExpression>();
+	auto &pexpr = op.select_list[op.partition_idx]->Cast<BoundWindowExpression>();
 
 	const auto mode = DBConfig::GetConfig(context).options.window_mode;
 	for (idx_t expr_idx = 0; expr_idx < op.select_list.size(); ++expr_idx) {
@@ -248,7 +269,36 @@ WindowGlobalSinkState::WindowGlobalSinkState(const PhysicalWindow &op, ClientCon
 		executors.emplace_back(std::move(wexec));
 	}
 
-	global_partition = make_uniq<WindowPartitionGlobalSinkState>(*this, wexpr);
+	//	Share the global states of executors that build the same data
+	for (idx_t expr_idx = 0; expr_idx < executors.size(); ++expr_idx) {
+		state_owners.emplace_back(expr_idx);
+		auto &wexec = *executors[expr_idx];
+		for (idx_t owner_idx = 0; owner_idx < expr_idx; ++owner_idx) {
+			if (state_owners[owner_idx] == owner_idx && wexec.CanShareGlobalState(*executors[owner_idx])) {
+				state_owners[expr_idx] = owner_idx;
+				break;
+			}
+		}
+	}
+
+	//	Refine the coarsest partitions by sorting on the remaining partitions of the finest ones
+	vector<BoundOrderByNode> orders;
+	if (pexpr.partitions.size() < wexpr.partitions.size()) {
+		expression_set_t coarse;
+		for (const auto &partition : pexpr.partitions) {
+			coarse.insert(*partition);
+		}
+		for (const auto &partition : wexpr.partitions) {
+			if (!coarse.count(*partition)) {
+				orders.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_FIRST, partition->Copy());
+			}
+		}
+	}
+	for (const auto &order : wexpr.orders) {
+		orders.emplace_back(order.Copy());
+	}
+
+	global_partition = make_uniq<WindowPartitionGlobalSinkState>(*this, pexpr, orders);
 }
 
 //===--------------------------------------------------------------------===//
@@ -520,15 +570,23 @@ WindowHashGroup::WindowHashGroup(WindowGlobalSinkState &gstate, const idx_t hash
 	partition_mask.Initialize(count);
 	partition_mask.SetAllInvalid(count);
 
+	//	Refined partitions use the order mask of their prefix as their partition mask
+	partition_count = gpart.partitions.size();
 	const auto &executors = gstate.executors;
 	for (auto &wexec : executors) {
 		auto &wexpr = wexec->wexpr;
-		auto &order_mask = order_masks[wexpr.partitions.size() + wexpr.orders.size()];
-		if (order_mask.IsMaskSet()) {
-			continue;
+		vector<idx_t> prefixes(1, wexpr.partitions.size() + wexpr.orders.size());
+		if (wexpr.partitions.size() > partition_count) {
+			prefixes.emplace_back(wexpr.partitions.size());
+		}
+		for (const auto prefix : prefixes) {
+			auto &order_mask = order_masks[prefix];
+			if (order_mask.IsMaskSet()) {
+				continue;
+			}
+			order_mask.Initialize(count);
+			order_mask.SetAllInvalid(count);
 		}
-		order_mask.Initialize(count);
-		order_mask.SetAllInvalid(count);
 	}
 
 	// Scan the sorted data into new Collections
@@ -627,10 +685,18 @@ WindowHashGroup::ExecutorGlobalStates &WindowHashGroup::Initialize(WindowGlobalS
 	}
 
 	// These can be large so we defer building them until we are ready.
-	for (auto &wexec : executors) {
+	for (idx_t expr_idx = 0; expr_idx < executors.size(); ++expr_idx) {
+		auto &wexec = executors[expr_idx];
 		auto &wexpr = wexec->wexpr;
 		auto &order_mask = order_masks[wexpr.partitions.size() + wexpr.orders.size()];
-		gestates.emplace_back(wexec->GetGlobalState(count, partition_mask, order_mask));
+		auto &wexpr_mask = GetPartitionMask(wexpr);
+		const auto owner_idx = gsink.state_owners[expr_idx];
+		if (owner_idx == expr_idx) {
+			gestates.emplace_back(wexec->GetGlobalState(count, wexpr_mask, order_mask));
+		} else {
+			auto &owner = *gestates[owner_idx];
+			gestates.emplace_back(wexec->GetSharedGlobalState(count, wexpr_mask, order_mask, owner));
+		}
 	}
 
 	return gestates;
@@ -9,6 +9,7 @@
 #include "duckdb/function/function_binder.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/query_profiler.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/optimizer/filter_combiner.hpp"
 #include "duckdb/parallel/base_pipeline_event.hpp"
 #include "duckdb/parallel/executor_task.hpp"
@@ -17,6 +18,7 @@
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/in_filter.hpp"
@@ -131,79 +133,36 @@ unique_ptr<JoinFilterGlobalState> JoinFilterPushdownInfo::GetGlobalState(ClientC
 	return result;
 }
 
-class HashJoinGlobalSinkState : public GlobalSinkState {
-public:
-	HashJoinGlobalSinkState(const PhysicalHashJoin &op_p, ClientContext &context_p)
-	    : context(context_p), op(op_p),
-	      num_threads(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads())),
-	      temporary_memory_state(TemporaryMemoryManager::Get(context).Register(context)), finalized(false),
-	      active_local_states(0), total_size(0), max_partition_size(0), max_partition_count(0),
-	      probe_side_requirement(0), scanned_data(false) {
-		hash_table = op.InitializeHashTable(context);
-
-		// For perfect hash join
-		perfect_join_executor = make_uniq<PerfectHashJoinExecutor>(op, *hash_table);
-		bool use_perfect_hash = false;
-		if (op.conditions.size() == 1 && !op.join_stats.empty() && op.join_stats[1] &&
-		    TypeIsIntegral(op.join_stats[1]->GetType().InternalType()) && NumericStats::HasMinMax(*op.join_stats[1])) {
-			use_perfect_hash = perfect_join_executor->CanDoPerfectHashJoin(op, NumericStats::Min(*op.join_stats[1]),
-			                                                               NumericStats::Max(*op.join_stats[1]));
-		}
-		// For external hash join
-		external = ClientConfig::GetConfig(context).GetSetting<DebugForceExternalSetting>(context);
-		// Set probe types
-		probe_types = op.children[0]->types;
-		probe_types.emplace_back(LogicalType::HASH);
-
-		if (op.filter_pushdown) {
-			if (op.filter_pushdown->probe_info.empty() && use_perfect_hash) {
-				// Only computing min/max to check for perfect HJ, but we already can
-				skip_filter_pushdown = true;
-			}
-			global_filter_state = op.filter_pushdown->GetGlobalState(context, op);
+HashJoinGlobalSinkState::HashJoinGlobalSinkState(const PhysicalHashJoin &op_p, ClientContext &context_p)
+    : context(context_p), op(op_p),
+      num_threads(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads())),
+      temporary_memory_state(TemporaryMemoryManager::Get(context).Register(context)), finalized(false),
+      active_local_states(0), total_size(0), max_partition_size(0), max_partition_count(0),
+      probe_side_requirement(0), scanned_data(false) {
+	hash_table = op.InitializeHashTable(context);
+
+	// For perfect hash join
+	perfect_join_executor = make_uniq<PerfectHashJoinExecutor>(op, *hash_table);
+	bool use_perfect_hash = false;
+	if (op.conditions.size() == 1 && !op.join_stats.empty() && op.join_stats[1] &&
+	    TypeIsIntegral(op.join_stats[1]->GetType().InternalType()) && NumericStats::HasMinMax(*op.join_stats[1])) {
+		use_perfect_hash = perfect_join_executor->CanDoPerfectHashJoin(op, NumericStats::Min(*op.join_stats[1]),
+		                                                               NumericStats::Max(*op.join_stats[1]));
+	}
+	// For external hash join
+	external = ClientConfig::GetConfig(context).GetSetting<DebugForceExternalSetting>(context);
+	// Set probe types
+	probe_types = op.children[0]->types;
+	probe_types.emplace_back(LogicalType::HASH);
+
+	if (op.filter_pushdown) {
+		if (op.filter_pushdown->probe_info.empty() && use_perfect_hash) {
+			// Only computing min/max to check for perfect HJ, but we already can
+			skip_filter_pushdown = true;
 		}
+		global_filter_state = op.filter_pushdown->GetGlobalState(context, op);
 	}
-
-	void ScheduleFinalize(Pipeline &pipeline, Event &event);
-	void InitializeProbeSpill();
-
-public:
-	ClientContext &context;
-	const PhysicalHashJoin &op;
-
-	const idx_t num_threads;
-	//! Temporary memory state for managing this operator's memory usage
-	unique_ptr<TemporaryMemoryState> temporary_memory_state;
-
-	//! Global HT used by the join
-	unique_ptr<JoinHashTable> hash_table;
-	//! The perfect hash join executor (if any)
-	unique_ptr<PerfectHashJoinExecutor> perfect_join_executor;
-	//! Whether or not the hash table has been finalized
-	bool finalized;
-	//! The number of active local states
-	atomic<idx_t> active_local_states;
-
-	//! Whether we are doing an external + some sizes
-	bool external;
-	idx_t total_size;
-	idx_t max_partition_size;
-	idx_t max_partition_count;
-	idx_t probe_side_requirement;
-
-	//! Hash tables built by each thread
-	vector<unique_ptr<JoinHashTable>> local_hash_tables;
-
-	//! Excess probe data gathered during Sink
-	vector<LogicalType> probe_types;
-	unique_ptr<JoinHashTable::ProbeSpill> probe_spill;
-
-	//! Whether or not we have started scanning data using GetData
-	atomic<bool> scanned_data;
-
-	bool skip_filter_pushdown = false;
-	unique_ptr<JoinFilterGlobalState> global_filter_state;
-};
+}
 
 unique_ptr<JoinFilterLocalState> JoinFilterPushdownInfo::GetLocalState(JoinFilterGlobalState &gstate) const {
 	auto result = make_uniq<JoinFilterLocalState>();
@@ -416,6 +375,28 @@ void PhysicalHashJoin::PrepareFinalize(ClientContext &context, GlobalSinkState &
 	bool all_constant;
 	gstate.temporary_memory_state->SetMaterializationPenalty(GetTupleWidth(children[0]->types, all_constant));
 	gstate.temporary_memory_state->SetRemainingSize(gstate.total_size);
+
+	if (!cardinality_feedback_key.empty()) {
+		RecordCardinalityFeedback(context, gstate);
+	}
+}
+
+void PhysicalHashJoin::RecordCardinalityFeedback(ClientContext &context, GlobalSinkState &global_state) const {
+	auto &gstate = global_state.Cast<HashJoinGlobalSinkState>();
+	auto feedback = CardinalityFeedback::Get(context);
+	if (!feedback) {
+		return;
+	}
+	idx_t build_count = gstate.hash_table->Count();
+	for (auto &local_ht : gstate.local_hash_tables) {
+		build_count += local_ht->Count();
+	}
+	const auto threshold = ClientConfig::GetConfig(context).cardinality_feedback_threshold;
+	if (!CardinalityFeedback::Diverges(children[1]->estimated_cardinality, build_count, threshold)) {
+		return;
+	}
+	// the estimate was off - remember the actual cardinality, prepared statements will be re-planned using it
+	feedback->Record(cardinality_feedback_table, cardinality_feedback_key, build_count, threshold);
 }
 
 class HashJoinTableInitTask : public ExecutorTask {
@@ -659,12 +640,9 @@ public:
 	}
 };
 
-void JoinFilterPushdownInfo::PushInFilter(const JoinFilterPushdownFilter &info, JoinHashTable &ht,
-                                          const PhysicalOperator &op, idx_t filter_idx, idx_t filter_col_idx) const {
-	// generate a "OR" filter (i.e. x=1 OR x=535 OR x=997)
-	// first scan the entire vector at the probe side
+static unique_ptr<Vector> GatherBuildKeys(JoinHashTable &ht, idx_t build_idx, idx_t &key_count) {
+	// scan the entire hash table
 	// FIXME: this code is duplicated from PerfectHashJoinExecutor::FullScanHashTable
-	auto build_idx = join_condition[filter_idx];
 	auto &data_collection = ht.GetDataCollection();
 
 	Vector tuples_addresses(LogicalType::POINTER, ht.Count()); // allocate space for all the tuples
@@ -673,12 +651,22 @@ void JoinFilterPushdownInfo::PushInFilter(const JoinFilterPushdownFilter &info,
 	                              TupleDataPinProperties::KEEP_EVERYTHING_PINNED);
 
 	// Go through all the blocks and fill the keys addresses
-	idx_t key_count = ht.FillWithHTOffsets(join_ht_state, tuples_addresses);
+	key_count = ht.FillWithHTOffsets(join_ht_state, tuples_addresses);
 
 	// Scan the build keys in the hash table
-	Vector build_vector(ht.layout.GetTypes()[build_idx], key_count);
+	auto build_vector = make_uniq<Vector>(ht.layout.GetTypes()[build_idx], key_count);
 	data_collection.Gather(tuples_addresses, *FlatVector::IncrementalSelectionVector(), key_count, build_idx,
-	                       build_vector, *FlatVector::IncrementalSelectionVector(), nullptr);
+	                       *build_vector, *FlatVector::IncrementalSelectionVector(), nullptr);
+	return build_vector;
+}
+
+void JoinFilterPushdownInfo::PushInFilter(const JoinFilterPushdownFilter &info, JoinHashTable &ht,
+                                          const PhysicalOperator &op, idx_t filter_idx, idx_t filter_col_idx) const {
+	// generate a "OR" filter (i.e. x=1 OR x=535 OR x=997)
+	// first scan the entire vector at the probe side
+	idx_t key_count;
+	auto build_vector_ptr = GatherBuildKeys(ht, join_condition[filter_idx], key_count);
+	auto &build_vector = *build_vector_ptr;
 
 	// generate the OR-clause - note that we only need to consider unique values here (so we use a seT)
 	value_set_t unique_ht_values;
@@ -704,6 +692,19 @@ void JoinFilterPushdownInfo::PushInFilter(const JoinFilterPushdownFilter &info,
 	return;
 }
 
+shared_ptr<BloomFilterData> JoinFilterPushdownInfo::CreateBloomFilter(JoinHashTable &ht, idx_t filter_idx) const {
+	idx_t key_count;
+	auto build_vector = GatherBuildKeys(ht, join_condition[filter_idx], key_count);
+
+	// insert the hashes of the keys into the bloom filter
+	// NULL keys never match - but inserting them is harmless as the bloom filter rejects NULL values itself
+	auto result = make_shared_ptr<BloomFilterData>(key_count);
+	Vector hashes(LogicalType::HASH, key_count);
+	VectorOperations::Hash(*build_vector, hashes, key_count);
+	result->Insert(hashes, key_count);
+	return result;
+}
+
 unique_ptr<DataChunk> JoinFilterPushdownInfo::Finalize(ClientContext &context, JoinHashTable &ht,
                                                        JoinFilterGlobalState &gstate,
                                                        const PhysicalOperator &op) const {
@@ -724,6 +725,8 @@ unique_ptr<DataChunk> JoinFilterPushdownInfo::Finalize(ClientContext &context, J
 	auto dynamic_or_filter_threshold = ClientConfig::GetSetting<DynamicOrFilterThresholdSetting>(context);
 	// create a filter for each of the aggregates
 	for (idx_t filter_idx = 0; filter_idx < join_condition.size(); filter_idx++) {
+		// the bloom filter over the build keys is shared by all probe sides
+		shared_ptr<BloomFilterData> bloom_filter;
 		for (auto &info : probe_info) {
 			auto filter_col_idx = info.columns[filter_idx].probe_column_index.column_index;
 			auto min_idx = filter_idx * 2;
@@ -741,6 +744,14 @@ unique_ptr<DataChunk> JoinFilterPushdownInfo::Finalize(ClientContext &context, J
 			if (ht.Count() > 1 && ht.Count() <= dynamic_or_filter_threshold) {
 				PushInFilter(info, ht, op, filter_idx, filter_col_idx);
 			}
+			// if the keys are not a single value we push a bloom filter, which removes the tuples that cannot
+			// find a match in the hash table during the scan (unlike the "OR" filter which is zonemap-only)
+			if (ht.Count() > 1 && ht.Count() <= MAX_BLOOM_FILTER_COUNT && !Value::NotDistinctFrom(min_val, max_val)) {
+				if (!bloom_filter) {
+					bloom_filter = CreateBloomFilter(ht, filter_idx);
+				}
+				info.dynamic_filters->PushFilter(op, filter_col_idx, make_uniq<BloomFilter>(bloom_filter));
+			}
 
 			if (Value::NotDistinctFrom(min_val, max_val)) {
 				// min = max - generate an equality filter
@@ -0,0 +1,518 @@
+#include "duckdb/execution/operator/join/physical_partitioned_hash_join.hpp"
+
+#include "duckdb/common/types/value_map.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/parallel/base_pipeline_event.hpp"
+#include "duckdb/parallel/executor_task.hpp"
+#include "duckdb/parallel/pipeline.hpp"
+#include "duckdb/parallel/thread_context.hpp"
+#include "duckdb/storage/temporary_memory_manager.hpp"
+
+namespace duckdb {
+
+PhysicalPartitionedHashJoin::PhysicalPartitionedHashJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> left,
+                                                         unique_ptr<PhysicalOperator> right,
+                                                         vector<JoinCondition> cond,
+                                                         const vector<idx_t> &left_projection_map,
+                                                         const vector<idx_t> &right_projection_map,
+                                                         idx_t partition_condition, idx_t estimated_cardinality)
+    : PhysicalHashJoin(op, std::move(left), std::move(right), std::move(cond), JoinType::INNER, left_projection_map,
+                       right_projection_map, {}, estimated_cardinality, nullptr),
+      partition_condition(partition_condition) {
+	D_ASSERT(partition_condition < conditions.size());
+	D_ASSERT(conditions[partition_condition].comparison == ExpressionType::COMPARE_EQUAL);
+}
+
+//===--------------------------------------------------------------------===//
+// Partition Split
+//===--------------------------------------------------------------------===//
+//! Splits the rows of a chunk by the value of the partition key
+struct PartitionKeySplit {
+	//! The partition of every slice
+	vector<idx_t> partitions;
+	//! The rows of every slice (unused if the whole chunk is a single slice)
+	vector<SelectionVector> selections;
+	//! The row count of every slice
+	vector<idx_t> counts;
+	//! The number of slices
+	idx_t slice_count = 0;
+	//! Whether the whole chunk belongs to a single partition
+	bool single_slice = false;
+
+	//! Split the rows by the partition key, "get_partition" returns the partition of a (non-NULL) value, or an invalid
+	//! index if the rows with this value should be skipped. Rows with a NULL key never match and are skipped.
+	template <class GET_PARTITION>
+	void Split(Vector &key, idx_t count, GET_PARTITION &&get_partition) {
+		slice_count = 0;
+		single_slice = false;
+		if (count == 0) {
+			return;
+		}
+		if (key.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+			// the common case: the key is a (hive) partition column, which is constant for the entire chunk
+			if (ConstantVector::IsNull(key)) {
+				return;
+			}
+			auto partition = get_partition(key.GetValue(0));
+			if (!partition.IsValid()) {
+				return;
+			}
+			AddSlice(partition.GetIndex());
+			counts[0] = count;
+			single_slice = true;
+			return;
+		}
+		// the key is not constant - slice the chunk per row
+		// this only happens if the partitioned source emits a non-constant partition column, so we keep it simple
+		unordered_map<idx_t, idx_t> slice_map;
+		optional_idx last_partition;
+		idx_t last_slice = 0;
+		Value last_value;
+		for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+			auto value = key.GetValue(row_idx);
+			if (value.IsNull()) {
+				continue;
+			}
+			if (!last_partition.IsValid() || !Value::NotDistinctFrom(value, last_value)) {
+				last_partition = get_partition(value);
+				last_value = std::move(value);
+				if (!last_partition.IsValid()) {
+					continue;
+				}
+				auto entry = slice_map.find(last_partition.GetIndex());
+				if (entry == slice_map.end()) {
+					last_slice = AddSlice(last_partition.GetIndex());
+					slice_map.emplace(last_partition.GetIndex(), last_slice);
+				} else {
+					last_slice = entry->second;
+				}
+			}
+			selections[last_slice].set_index(counts[last_slice]++, row_idx);
+		}
+	}
+
+	//! Reference or slice the input for the given slice into the result
+	void Slice(idx_t slice_idx, DataChunk &input, DataChunk &result) const {
+		if (single_slice) {
+			result.Reference(input);
+			return;
+		}
+		result.Slice(input, selections[slice_idx], counts[slice_idx]);
+		result.SetCardinality(counts[slice_idx]);
+	}
+
+private:
+	idx_t AddSlice(idx_t partition) {
+		auto slice_idx = slice_count++;
+		if (slice_idx == partitions.size()) {
+			partitions.emplace_back();
+			selections.emplace_back(STANDARD_VECTOR_SIZE);
+			counts.emplace_back();
+		}
+		partitions[slice_idx] = partition;
+		counts[slice_idx] = 0;
+		return slice_idx;
+	}
+};
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+//! The partitioned join is a PhysicalHashJoin that has not merged its partitions yet: if the hash tables of all
+//! partitions do not fit in the memory reservation, they are moved into the (spilling) hash join instead
+class PartitionedHashJoinGlobalSinkState : public HashJoinGlobalSinkState {
+public:
+	PartitionedHashJoinGlobalSinkState(const PhysicalPartitionedHashJoin &op, ClientContext &context)
+	    : HashJoinGlobalSinkState(op, context), partitioned(true), partitioned_size(0) {
+	}
+
+	mutex partition_lock;
+	//! Whether the join is executed per partition, or has fallen back to the (external) PhysicalHashJoin
+	bool partitioned;
+	//! The size of the hash tables (and pointer tables) of all partitions
+	idx_t partitioned_size;
+	//! The value of the partition key of every partition
+	value_map_t<idx_t> partition_map;
+	//! The thread-local hash tables of every partition
+	vector<vector<unique_ptr<JoinHashTable>>> partition_local_hash_tables;
+	//! The finalized hash table of every partition
+	vector<unique_ptr<JoinHashTable>> hash_tables;
+
+	idx_t GetOrCreatePartition(const Value &value) {
+		lock_guard<mutex> guard(partition_lock);
+		auto entry = partition_map.find(value);
+		if (entry != partition_map.end()) {
+			return entry->second;
+		}
+		auto partition_idx = partition_local_hash_tables.size();
+		partition_local_hash_tables.emplace_back();
+		partition_map.insert(make_pair(value, partition_idx));
+		return partition_idx;
+	}
+
+	optional_idx GetPartition(const Value &value) const {
+		auto entry = partition_map.find(value);
+		if (entry == partition_map.end()) {
+			return optional_idx();
+		}
+		return entry->second;
+	}
+};
+
+class PartitionedHashJoinLocalSinkState : public LocalSinkState {
+public:
+	PartitionedHashJoinLocalSinkState(const PhysicalPartitionedHashJoin &op, ClientContext &context)
+	    : join_key_executor(context) {
+		auto &allocator = BufferAllocator::Get(context);
+		for (auto &cond : op.conditions) {
+			join_key_executor.AddExpression(*cond.right);
+		}
+		join_keys.Initialize(allocator, op.condition_types);
+		sliced_keys.InitializeEmpty(op.condition_types);
+		if (!op.payload_columns.col_types.empty()) {
+			payload_chunk.Initialize(allocator, op.payload_columns.col_types);
+			sliced_payload.InitializeEmpty(op.payload_columns.col_types);
+		}
+	}
+
+	ExpressionExecutor join_key_executor;
+	DataChunk join_keys;
+	DataChunk payload_chunk;
+	DataChunk sliced_keys;
+	DataChunk sliced_payload;
+	PartitionKeySplit split;
+
+	//! The local slot of every partition that this thread has seen
+	value_map_t<idx_t> slot_map;
+	//! The thread-local hash table (and its append state) of every slot
+	vector<unique_ptr<JoinHashTable>> hash_tables;
+	vector<unique_ptr<PartitionedTupleDataAppendState>> append_states;
+	vector<Value> slot_values;
+};
+
+unique_ptr<GlobalSinkState> PhysicalPartitionedHashJoin::GetGlobalSinkState(ClientContext &context) const {
+	return make_uniq<PartitionedHashJoinGlobalSinkState>(*this, context);
+}
+
+unique_ptr<LocalSinkState> PhysicalPartitionedHashJoin::GetLocalSinkState(ExecutionContext &context) const {
+	return make_uniq<PartitionedHashJoinLocalSinkState>(*this, context.client);
+}
+
+SinkResultType PhysicalPartitionedHashJoin::Sink(ExecutionContext &context, DataChunk &chunk,
+                                                 OperatorSinkInput &input) const {
+	auto &lstate = input.local_state.Cast<PartitionedHashJoinLocalSinkState>();
+
+	// resolve the join keys for the right chunk
+	lstate.join_keys.Reset();
+	lstate.join_key_executor.Execute(chunk, lstate.join_keys);
+	if (payload_columns.col_types.empty()) { // there are only keys: place an empty chunk in the payload
+		lstate.payload_chunk.SetCardinality(chunk.size());
+	} else { // there are payload columns
+		lstate.payload_chunk.ReferenceColumns(chunk, payload_columns.col_idxs);
+	}
+
+	// split the chunk by partition, and build the thread-local HT of every partition
+	lstate.split.Split(lstate.join_keys.data[partition_condition], chunk.size(), [&](const Value &value) {
+		auto entry = lstate.slot_map.find(value);
+		if (entry != lstate.slot_map.end()) {
+			return optional_idx(entry->second);
+		}
+		auto slot_idx = lstate.hash_tables.size();
+		lstate.hash_tables.push_back(InitializeHashTable(context.client));
+		// the partitions are never spilled, so we do not radix-partition within them: every thread and partition
+		// then holds on to a single partially filled block, rather than one per radix partition
+		lstate.hash_tables.back()->InitializeSinkCollection(0);
+		lstate.append_states.push_back(make_uniq<PartitionedTupleDataAppendState>());
+		lstate.hash_tables.back()->GetSinkCollection().InitializeAppendState(*lstate.append_states.back());
+		lstate.slot_values.push_back(value);
+		lstate.slot_map.insert(make_pair(value, slot_idx));
+		return optional_idx(slot_idx);
+	});
+	for (idx_t slice_idx = 0; slice_idx < lstate.split.slice_count; slice_idx++) {
+		auto slot_idx = lstate.split.partitions[slice_idx];
+		lstate.split.Slice(slice_idx, lstate.join_keys, lstate.sliced_keys);
+		if (payload_columns.col_types.empty()) {
+			lstate.sliced_payload.SetCardinality(lstate.sliced_keys.size());
+		} else {
+			lstate.split.Slice(slice_idx, lstate.payload_chunk, lstate.sliced_payload);
+		}
+		lstate.hash_tables[slot_idx]->Build(*lstate.append_states[slot_idx], lstate.sliced_keys,
+		                                    lstate.sliced_payload);
+	}
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+SinkCombineResultType PhysicalPartitionedHashJoin::Combine(ExecutionContext &context,
+                                                           OperatorSinkCombineInput &input) const {
+	auto &gstate = input.global_state.Cast<PartitionedHashJoinGlobalSinkState>();
+	auto &lstate = input.local_state.Cast<PartitionedHashJoinLocalSinkState>();
+	for (idx_t slot_idx = 0; slot_idx < lstate.hash_tables.size(); slot_idx++) {
+		auto &hash_table = lstate.hash_tables[slot_idx];
+		hash_table->GetSinkCollection().FlushAppendState(*lstate.append_states[slot_idx]);
+		auto partition_idx = gstate.GetOrCreatePartition(lstate.slot_values[slot_idx]);
+		lock_guard<mutex> guard(gstate.partition_lock);
+		gstate.partition_local_hash_tables[partition_idx].push_back(std::move(hash_table));
+	}
+	lstate.hash_tables.clear();
+
+	auto &client_profiler = QueryProfiler::Get(context.client);
+	context.thread.profiler.Flush(*this);
+	client_profiler.Flush(context.thread.profiler);
+	return SinkCombineResultType::FINISHED;
+}
+
+void PhysicalPartitionedHashJoin::PrepareFinalize(ClientContext &context, GlobalSinkState &global_state) const {
+	auto &gstate = global_state.Cast<PartitionedHashJoinGlobalSinkState>();
+	// the partitions are not spilled: the hash tables (and pointer tables) of all partitions are needed at once
+	// we only insist on the largest partition though - if less than all of them is granted, we fall back in Finalize
+	gstate.partitioned_size = 0;
+	idx_t max_partition_size = 0;
+	for (auto &local_hash_tables : gstate.partition_local_hash_tables) {
+		idx_t partition_size = 0;
+		idx_t partition_count = 0;
+		for (auto &local_ht : local_hash_tables) {
+			auto &sink_collection = local_ht->GetSinkCollection();
+			partition_size += sink_collection.SizeInBytes();
+			partition_count += sink_collection.Count();
+		}
+		partition_size += JoinHashTable::PointerTableSize(partition_count);
+		gstate.partitioned_size += partition_size;
+		max_partition_size = MaxValue(max_partition_size, partition_size);
+	}
+	gstate.temporary_memory_state->SetRemainingSize(gstate.partitioned_size);
+	gstate.temporary_memory_state->SetMinimumReservation(max_partition_size);
+}
+
+//===--------------------------------------------------------------------===//
+// Finalize
+//===--------------------------------------------------------------------===//
+class PartitionedHashJoinFinalizeTask : public ExecutorTask {
+public:
+	PartitionedHashJoinFinalizeTask(shared_ptr<Event> event_p, ClientContext &context,
+	                                PartitionedHashJoinGlobalSinkState &sink_p, idx_t partition_idx_p,
+	                                const PhysicalOperator &op_p)
+	    : ExecutorTask(context, std::move(event_p), op_p), sink(sink_p), partition_idx(partition_idx_p) {
+	}
+
+	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
+		// merge the thread-local tables of this partition, and build its pointer table
+		auto &local_hash_tables = sink.partition_local_hash_tables[partition_idx];
+		auto &ht = *local_hash_tables[0];
+		for (idx_t table_idx = 1; table_idx < local_hash_tables.size(); table_idx++) {
+			ht.Merge(*local_hash_tables[table_idx]);
+		}
+		ht.Unpartition();
+		if (ht.Count() > 0) {
+			ht.AllocatePointerTable();
+			ht.InitializePointerTable(0, ht.capacity);
+			ht.Finalize(0, ht.GetDataCollection().ChunkCount(), false);
+		}
+		ht.finalized = true;
+		sink.hash_tables[partition_idx] = std::move(local_hash_tables[0]);
+		local_hash_tables.clear();
+
+		event->FinishTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	PartitionedHashJoinGlobalSinkState &sink;
+	idx_t partition_idx;
+};
+
+class PartitionedHashJoinFinalizeEvent : public BasePipelineEvent {
+public:
+	PartitionedHashJoinFinalizeEvent(Pipeline &pipeline_p, PartitionedHashJoinGlobalSinkState &sink,
+	                                 const PhysicalOperator &op)
+	    : BasePipelineEvent(pipeline_p), sink(sink), op(op) {
+	}
+
+	PartitionedHashJoinGlobalSinkState &sink;
+	const PhysicalOperator &op;
+
+public:
+	void Schedule() override {
+		auto &context = pipeline->GetClientContext();
+		vector<shared_ptr<Task>> finalize_tasks;
+		for (idx_t partition_idx = 0; partition_idx < sink.partition_local_hash_tables.size(); partition_idx++) {
+			finalize_tasks.push_back(
+			    make_uniq<PartitionedHashJoinFinalizeTask>(shared_from_this(), context, sink, partition_idx, op));
+		}
+		SetTasks(std::move(finalize_tasks));
+	}
+
+	void FinishEvent() override {
+		sink.finalized = true;
+	}
+};
+
+SinkFinalizeType PhysicalPartitionedHashJoin::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                                       OperatorSinkFinalizeInput &input) const {
+	auto &sink = input.global_state.Cast<PartitionedHashJoinGlobalSinkState>();
+	// claim the memory of all partitions, so that concurrent operators make room for it
+	sink.temporary_memory_state->UpdateReservation(context);
+	if (sink.external || sink.temporary_memory_state->GetReservation() < sink.partitioned_size) {
+		// not all partitions fit (or we are forced to go external): fall back to the regular hash join, which spills
+		// the data is moved rather than rebuilt, the partitions only have to be radix-partitioned by the join hash
+		sink.partitioned = false;
+		for (auto &local_hash_tables : sink.partition_local_hash_tables) {
+			auto ht = InitializeHashTable(context);
+			for (auto &local_ht : local_hash_tables) {
+				local_ht->Repartition(*ht);
+			}
+			sink.local_hash_tables.push_back(std::move(ht));
+		}
+		sink.partition_local_hash_tables.clear();
+		sink.partition_map.clear();
+		PhysicalHashJoin::PrepareFinalize(context, sink);
+		return PhysicalHashJoin::Finalize(pipeline, event, context, input);
+	}
+	sink.perfect_join_executor.reset();
+	if (sink.partition_local_hash_tables.empty()) {
+		// the build side is empty: an inner join produces no output
+		sink.finalized = true;
+		return SinkFinalizeType::NO_OUTPUT_POSSIBLE;
+	}
+	sink.hash_tables.resize(sink.partition_local_hash_tables.size());
+	auto new_event = make_shared_ptr<PartitionedHashJoinFinalizeEvent>(pipeline, sink, *this);
+	event.InsertEvent(std::move(new_event));
+	return SinkFinalizeType::READY;
+}
+
+//===--------------------------------------------------------------------===//
+// Operator
+//===--------------------------------------------------------------------===//
+class PartitionedHashJoinOperatorState : public CachingOperatorState {
+public:
+	explicit PartitionedHashJoinOperatorState(ClientContext &context) : probe_executor(context) {
+	}
+
+	DataChunk lhs_join_keys;
+	DataChunk lhs_output;
+	TupleDataChunkState join_key_state;
+	ExpressionExecutor probe_executor;
+	JoinHashTable::ProbeState probe_state;
+
+	//! The scan structure of every partition (created on first use)
+	vector<unique_ptr<JoinHashTable::ScanStructure>> scan_structures;
+	//! The current input chunk, split by partition
+	PartitionKeySplit split;
+	idx_t slice_idx = 0;
+	bool probing = false;
+	DataChunk sliced_keys;
+	DataChunk sliced_output;
+
+public:
+	void Finalize(const PhysicalOperator &op, ExecutionContext &context) override {
+		context.thread.profiler.Flush(op);
+	}
+};
+
+unique_ptr<OperatorState> PhysicalPartitionedHashJoin::GetOperatorState(ExecutionContext &context) const {
+	auto &sink = sink_state->Cast<PartitionedHashJoinGlobalSinkState>();
+	if (!sink.partitioned) {
+		return PhysicalHashJoin::GetOperatorState(context);
+	}
+	auto &allocator = BufferAllocator::Get(context.client);
+	auto state = make_uniq<PartitionedHashJoinOperatorState>(context.client);
+	state->lhs_join_keys.Initialize(allocator, condition_types);
+	state->sliced_keys.InitializeEmpty(condition_types);
+	if (!lhs_output_columns.col_types.empty()) {
+		state->lhs_output.Initialize(allocator, lhs_output_columns.col_types);
+		state->sliced_output.InitializeEmpty(lhs_output_columns.col_types);
+	}
+	for (auto &cond : conditions) {
+		state->probe_executor.AddExpression(*cond.left);
+	}
+	TupleDataCollection::InitializeChunkState(state->join_key_state, condition_types);
+	state->scan_structures.resize(sink.hash_tables.size());
+	return std::move(state);
+}
+
+OperatorResultType PhysicalPartitionedHashJoin::ExecuteInternal(ExecutionContext &context, DataChunk &input,
+                                                                DataChunk &chunk, GlobalOperatorState &gstate,
+                                                                OperatorState &state_p) const {
+	auto &sink = sink_state->Cast<PartitionedHashJoinGlobalSinkState>();
+	if (!sink.partitioned) {
+		return PhysicalHashJoin::ExecuteInternal(context, input, chunk, gstate, state_p);
+	}
+	auto &state = state_p.Cast<PartitionedHashJoinOperatorState>();
+	D_ASSERT(sink.finalized);
+
+	if (!state.probing) {
+		// resolve the join keys for the left chunk, and split it by partition
+		state.lhs_join_keys.Reset();
+		state.probe_executor.Execute(input, state.lhs_join_keys);
+		state.lhs_output.ReferenceColumns(input, lhs_output_columns.col_idxs);
+		state.split.Split(state.lhs_join_keys.data[partition_condition], input.size(), [&](const Value &value) {
+			auto partition = sink.GetPartition(value);
+			if (partition.IsValid() && sink.hash_tables[partition.GetIndex()]->Count() == 0) {
+				// no build-side rows in this partition - nothing can match
+				return optional_idx();
+			}
+			return partition;
+		});
+		state.slice_idx = 0;
+		state.probing = true;
+	}
+
+	// probe the HT of every partition that occurs in the input chunk
+	while (state.slice_idx < state.split.slice_count) {
+		auto partition_idx = state.split.partitions[state.slice_idx];
+		auto &ht = *sink.hash_tables[partition_idx];
+		auto &scan_structure = state.scan_structures[partition_idx];
+		if (!scan_structure) {
+			scan_structure = make_uniq<JoinHashTable::ScanStructure>(ht, state.join_key_state);
+		}
+		if (scan_structure->is_null) {
+			state.split.Slice(state.slice_idx, state.lhs_join_keys, state.sliced_keys);
+			if (lhs_output_columns.col_types.empty()) {
+				state.sliced_output.SetCardinality(state.sliced_keys.size());
+			} else {
+				state.split.Slice(state.slice_idx, state.lhs_output, state.sliced_output);
+			}
+			ht.Probe(*scan_structure, state.sliced_keys, state.join_key_state, state.probe_state);
+		}
+		scan_structure->Next(state.sliced_keys, state.sliced_output, chunk);
+		if (scan_structure->PointersExhausted() && chunk.size() == 0) {
+			scan_structure->is_null = true;
+			state.slice_idx++;
+			continue;
+		}
+		return OperatorResultType::HAVE_MORE_OUTPUT;
+	}
+	state.probing = false;
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+//===--------------------------------------------------------------------===//
+// Source
+//===--------------------------------------------------------------------===//
+SourceResultType PhysicalPartitionedHashJoin::GetData(ExecutionContext &context, DataChunk &chunk,
+                                                      OperatorSourceInput &input) const {
+	auto &sink = sink_state->Cast<PartitionedHashJoinGlobalSinkState>();
+	if (!sink.partitioned) {
+		// the external hash join probes the spilled partitions here
+		return PhysicalHashJoin::GetData(context, chunk, input);
+	}
+	// the probe is done: release the hash tables of all partitions
+	auto guard = sink.Lock();
+	if (!sink.hash_tables.empty()) {
+		sink.hash_tables.clear();
+		sink.temporary_memory_state->SetZero();
+	}
+	return SourceResultType::FINISHED;
+}
+
+//===--------------------------------------------------------------------===//
+// ParamsToString
+//===--------------------------------------------------------------------===//
+InsertionOrderPreservingMap<string> PhysicalPartitionedHashJoin::ParamsToString() const {
+	auto result = PhysicalHashJoin::ParamsToString();
+	auto &condition = conditions[partition_condition];
+	result["Partitioned By"] = condition.left->GetName() + " = " + condition.right->GetName();
+	return result;
+}
+
+} // namespace duckdb
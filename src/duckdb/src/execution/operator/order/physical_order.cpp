@@ -44,6 +44,7 @@ public:
 		auto &allocator = Allocator::Get(context);
 		keys.Initialize(allocator, key_types);
 		payload.Initialize(allocator, op.types);
+		local_sort_state.detect_sorted_runs = op.sorted_runs;
 	}
 
 public:
@@ -285,6 +286,9 @@ InsertionOrderPreservingMap<string> PhysicalOrder::ParamsToString() const {
 		orders_info += orders[i].type == OrderType::DESCENDING ? "DESC" : "ASC";
 	}
 	result["__order_by__"] = orders_info;
+	if (sorted_runs) {
+		result["Sorted Runs"] = "true";
+	}
 	return result;
 }
 
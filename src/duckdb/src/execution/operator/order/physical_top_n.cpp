@@ -4,14 +4,31 @@
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/function/create_sort_key.hpp"
 #include "duckdb/storage/data_table.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/planner/filter/dynamic_filter.hpp"
 
 namespace duckdb {
 
+static void ReplaceColumnReference(unique_ptr<Expression> &expr) {
+	if (expr->GetExpressionClass() == ExpressionClass::BOUND_REF) {
+		expr = make_uniq<BoundReferenceExpression>(expr->return_type, 0ULL);
+		return;
+	}
+	ExpressionIterator::EnumerateChildren(*expr, [&](unique_ptr<Expression> &child) { ReplaceColumnReference(child); });
+}
+
 PhysicalTopN::PhysicalTopN(vector<LogicalType> types, vector<BoundOrderByNode> orders, idx_t limit, idx_t offset,
-                           shared_ptr<DynamicFilterData> dynamic_filter_p, idx_t estimated_cardinality)
+                           shared_ptr<DynamicFilterData> dynamic_filter_p,
+                           unique_ptr<DynamicFilterColumnRange> dynamic_filter_range_p, idx_t estimated_cardinality)
     : PhysicalOperator(PhysicalOperatorType::TOP_N, std::move(types), estimated_cardinality), orders(std::move(orders)),
-      limit(limit), offset(offset), dynamic_filter(std::move(dynamic_filter_p)) {
+      limit(limit), offset(offset), dynamic_filter(std::move(dynamic_filter_p)),
+      dynamic_filter_range(std::move(dynamic_filter_range_p)) {
+	if (dynamic_filter_range) {
+		// the ORDER BY expression only references the filtered column - rewrite it to read the column from index 0
+		dynamic_filter_expression = this->orders[0].expression->Copy();
+		ReplaceColumnReference(dynamic_filter_expression);
+	}
 }
 
 PhysicalTopN::~PhysicalTopN() {
@@ -40,10 +57,50 @@ struct TopNScanState {
 	SelectionVector sel;
 };
 
+static int64_t GetColumnValue(const Value &value) {
+	switch (value.type().InternalType()) {
+	case PhysicalType::INT8:
+		return value.GetValueUnsafe<int8_t>();
+	case PhysicalType::INT16:
+		return value.GetValueUnsafe<int16_t>();
+	case PhysicalType::INT32:
+		return value.GetValueUnsafe<int32_t>();
+	case PhysicalType::INT64:
+		return value.GetValueUnsafe<int64_t>();
+	default:
+		throw InternalException("Unsupported type for Top-N dynamic filter column range");
+	}
+}
+
+static void SetColumnValue(Vector &vector, int64_t value) {
+	switch (vector.GetType().InternalType()) {
+	case PhysicalType::INT8:
+		FlatVector::GetData<int8_t>(vector)[0] = static_cast<int8_t>(value);
+		break;
+	case PhysicalType::INT16:
+		FlatVector::GetData<int16_t>(vector)[0] = static_cast<int16_t>(value);
+		break;
+	case PhysicalType::INT32:
+		FlatVector::GetData<int32_t>(vector)[0] = static_cast<int32_t>(value);
+		break;
+	case PhysicalType::INT64:
+		FlatVector::GetData<int64_t>(vector)[0] = value;
+		break;
+	default:
+		throw InternalException("Unsupported type for Top-N dynamic filter column range");
+	}
+}
+
 struct TopNBoundaryValue {
-	explicit TopNBoundaryValue(const PhysicalTopN &op)
+	TopNBoundaryValue(ClientContext &context, const PhysicalTopN &op)
 	    : op(op), boundary_vector(op.orders[0].expression->return_type),
 	      boundary_modifiers(op.orders[0].type, op.orders[0].null_order) {
+		if (op.dynamic_filter_range) {
+			auto &allocator = Allocator::Get(context);
+			executor = make_uniq<ExpressionExecutor>(context, *op.dynamic_filter_expression);
+			column_chunk.Initialize(allocator, {op.dynamic_filter_range->min.type()}, 1);
+			expression_chunk.Initialize(allocator, {op.dynamic_filter_expression->return_type}, 1);
+		}
 	}
 
 	const PhysicalTopN &op;
@@ -52,23 +109,140 @@ struct TopNBoundaryValue {
 	bool is_set = false;
 	Vector boundary_vector;
 	OrderModifiers boundary_modifiers;
+	//! Evaluates the ORDER BY expression over the filtered column (if the filter is on a column range)
+	unique_ptr<ExpressionExecutor> executor;
+	DataChunk column_chunk;
+	DataChunk expression_chunk;
+	//! Serializes deriving and pushing the dynamic filter value, separately from the boundary lock
+	mutex filter_lock;
+	//! The version of the latest boundary value, and of the boundary value that was pushed into the filter
+	idx_t boundary_version = 0;
+	idx_t filter_version = 0;
 
 	string GetBoundaryValue() {
 		lock_guard<mutex> l(lock);
 		return boundary_value;
 	}
 
+	Value EvaluateExpression(int64_t column_value) {
+		column_chunk.Reset();
+		SetColumnValue(column_chunk.data[0], column_value);
+		column_chunk.SetCardinality(1);
+		expression_chunk.Reset();
+		executor->ExecuteExpression(column_chunk, expression_chunk.data[0]);
+		return expression_chunk.data[0].GetValue(0);
+	}
+
+	//! Maps a boundary value of the (monotonic) ORDER BY expression to a bound on the filtered column, returns NULL if
+	//! no bound can be derived. The column range comes from the statistics at optimization time, which can be stale
+	//! (e.g. a prepared statement that is re-executed after inserts), so a search that saturates at the edge of the
+	//! range does not produce a bound: values outside of the range might still qualify.
+	Value GetColumnBound(const Value &boundary) {
+		auto &range = *op.dynamic_filter_range;
+		const bool ascending = op.orders[0].type == OrderType::ASCENDING;
+		// the column values for which the expression can still make it into the Top-N are a prefix of the column range
+		// if the expression is ordered in the same direction as the column, and a suffix otherwise
+		const bool prefix = ascending != range.decreasing;
+		bool valid = true;
+		auto can_qualify = [&](int64_t column_value) {
+			auto result = EvaluateExpression(column_value);
+			if (result.IsNull()) {
+				valid = false;
+				return true;
+			}
+			return ascending ? result <= boundary : result >= boundary;
+		};
+		auto lower = GetColumnValue(range.min);
+		auto upper = GetColumnValue(range.max);
+		try {
+			if (prefix) {
+				// find the largest column value that can qualify
+				if (!can_qualify(lower)) {
+					return Value();
+				}
+				while (lower < upper && valid) {
+					auto diff = static_cast<uint64_t>(upper) - static_cast<uint64_t>(lower);
+					auto mid = static_cast<int64_t>(static_cast<uint64_t>(lower) + diff / 2 + (diff & 1));
+					if (can_qualify(mid)) {
+						lower = mid;
+					} else {
+						upper = mid - 1;
+					}
+				}
+			} else {
+				// find the smallest column value that can qualify
+				if (!can_qualify(upper)) {
+					return Value();
+				}
+				while (lower < upper && valid) {
+					auto diff = static_cast<uint64_t>(upper) - static_cast<uint64_t>(lower);
+					auto mid = static_cast<int64_t>(static_cast<uint64_t>(lower) + diff / 2);
+					if (can_qualify(mid)) {
+						upper = mid;
+					} else {
+						lower = mid + 1;
+					}
+				}
+			}
+		} catch (std::exception &) {
+			// evaluating the expression failed (e.g. an overflow) - skip this boundary value
+			return Value();
+		}
+		if (!valid) {
+			return Value();
+		}
+		if (lower == (prefix ? GetColumnValue(range.max) : GetColumnValue(range.min))) {
+			// every column value in the range can qualify
+			return Value();
+		}
+		column_chunk.Reset();
+		SetColumnValue(column_chunk.data[0], lower);
+		return column_chunk.data[0].GetValue(0);
+	}
+
 	void UpdateValue(string_t boundary_val) {
-		unique_lock<mutex> l(lock);
-		if (!is_set || boundary_val < string_t(boundary_value)) {
+		Value new_dynamic_value;
+		idx_t version;
+		{
+			lock_guard<mutex> l(lock);
+			if (is_set && !(boundary_val < string_t(boundary_value))) {
+				return;
+			}
 			boundary_value = boundary_val.GetString();
 			is_set = true;
-			if (op.dynamic_filter) {
-				CreateSortKeyHelpers::DecodeSortKey(boundary_val, boundary_vector, 0, boundary_modifiers);
-				auto new_dynamic_value = boundary_vector.GetValue(0);
-				l.unlock();
-				op.dynamic_filter->SetValue(std::move(new_dynamic_value));
+			if (!op.dynamic_filter) {
+				return;
 			}
+			CreateSortKeyHelpers::DecodeSortKey(boundary_val, boundary_vector, 0, boundary_modifiers);
+			new_dynamic_value = boundary_vector.GetValue(0);
+			version = ++boundary_version;
+		}
+		if (new_dynamic_value.IsNull() || IsNaN(new_dynamic_value)) {
+			// NULL (NULLS FIRST) or NaN boundaries cannot tighten the filter
+			return;
+		}
+		// deriving a column bound evaluates the ORDER BY expression repeatedly, so we do not hold the boundary lock
+		lock_guard<mutex> l(filter_lock);
+		if (version < filter_version) {
+			// a tighter boundary value has already been pushed
+			return;
+		}
+		if (op.dynamic_filter_range) {
+			new_dynamic_value = GetColumnBound(new_dynamic_value);
+		}
+		filter_version = version;
+		op.dynamic_filter->SetValue(std::move(new_dynamic_value));
+	}
+
+private:
+	static bool IsNaN(const Value &value) {
+		switch (value.type().id()) {
+		case LogicalTypeId::FLOAT:
+			return Value::IsNan(value.GetValueUnsafe<float>());
+		case LogicalTypeId::DOUBLE:
+			return Value::IsNan(value.GetValueUnsafe<double>());
+		default:
+			return false;
 		}
 	}
 };
@@ -468,7 +642,7 @@ void TopNHeap::Scan(TopNScanState &state, DataChunk &chunk) {
 class TopNGlobalState : public GlobalSinkState {
 public:
 	TopNGlobalState(ClientContext &context, const PhysicalTopN &op)
-	    : heap(context, op.types, op.orders, op.limit, op.offset), boundary_value(op) {
+	    : heap(context, op.types, op.orders, op.limit, op.offset), boundary_value(context, op) {
 	}
 
 	mutex lock;
@@ -176,6 +176,29 @@ void AddProjectionNames(const ColumnIndex &index, const string &name, const Logi
 	}
 }
 
+string PhysicalTableScan::FiltersToString(const TableFilterSet &filters) const {
+	string filters_info;
+	bool first_item = true;
+	for (auto &f : filters.filters) {
+		auto &column_index = f.first;
+		auto &filter = f.second;
+		if (column_index < names.size()) {
+			if (!first_item) {
+				filters_info += "\n";
+			}
+			first_item = false;
+
+			const auto col_id = column_ids[column_index].GetPrimaryIndex();
+			if (col_id == COLUMN_IDENTIFIER_ROW_ID) {
+				filters_info += filter->ToString("rowid");
+			} else {
+				filters_info += filter->ToString(names[col_id]);
+			}
+		}
+	}
+	return filters_info;
+}
+
 InsertionOrderPreservingMap<string> PhysicalTableScan::ParamsToString() const {
 	InsertionOrderPreservingMap<string> result;
 	if (function.to_string) {
@@ -202,26 +225,14 @@ InsertionOrderPreservingMap<string> PhysicalTableScan::ParamsToString() const {
 		result["Projections"] = projections;
 	}
 	if (function.filter_pushdown && table_filters) {
-		string filters_info;
-		bool first_item = true;
-		for (auto &f : table_filters->filters) {
-			auto &column_index = f.first;
-			auto &filter = f.second;
-			if (column_index < names.size()) {
-				if (!first_item) {
-					filters_info += "\n";
-				}
-				first_item = false;
-
-				const auto col_id = column_ids[column_index].GetPrimaryIndex();
-				if (col_id == COLUMN_IDENTIFIER_ROW_ID) {
-					filters_info += filter->ToString("rowid");
-				} else {
-					filters_info += filter->ToString(names[col_id]);
-				}
-			}
+		result["Filters"] = FiltersToString(*table_filters);
+	}
+	if (function.filter_pushdown && dynamic_filters && dynamic_filters->HasFilters()) {
+		// filters pushed at runtime (e.g. by hash joins) - these are only known once execution has started
+		auto runtime_filters = dynamic_filters->GetFinalTableFilters(*this, nullptr);
+		if (runtime_filters) {
+			result["Dynamic Filters"] = FiltersToString(*runtime_filters);
 		}
-		result["Filters"] = filters_info;
 	}
 	if (extra_info.sample_options) {
 		result["Sample Method"] = "System: " + extra_info.sample_options->sample_size.ToString() + "%";
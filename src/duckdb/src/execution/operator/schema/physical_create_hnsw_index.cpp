@@ -0,0 +1,125 @@
+#include "duckdb/execution/operator/schema/physical_create_hnsw_index.hpp"
+
+#include "duckdb/catalog/catalog_entry/duck_index_entry.hpp"
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/common/exception/transaction_exception.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/storage/table/append_state.hpp"
+#include "duckdb/storage/table_io_manager.hpp"
+
+namespace duckdb {
+
+PhysicalCreateHNSWIndex::PhysicalCreateHNSWIndex(LogicalOperator &op, TableCatalogEntry &table_p,
+                                                 const vector<column_t> &column_ids, unique_ptr<CreateIndexInfo> info,
+                                                 vector<unique_ptr<Expression>> unbound_expressions,
+                                                 idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::CREATE_INDEX, op.types, estimated_cardinality),
+      table(table_p.Cast<DuckTableEntry>()), info(std::move(info)), unbound_expressions(std::move(unbound_expressions)) {
+
+	// Convert the logical column ids to physical column ids.
+	for (auto &column_id : column_ids) {
+		storage_ids.push_back(table.GetColumns().LogicalToPhysical(LogicalIndex(column_id)).index);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+
+class CreateHNSWIndexGlobalSinkState : public GlobalSinkState {
+public:
+	unique_ptr<BoundIndex> global_index;
+};
+
+class CreateHNSWIndexLocalSinkState : public LocalSinkState {
+public:
+	DataChunk key_chunk;
+	vector<column_t> key_column_ids;
+};
+
+unique_ptr<GlobalSinkState> PhysicalCreateHNSWIndex::GetGlobalSinkState(ClientContext &context) const {
+	// Create the global sink state and add the global index.
+	auto state = make_uniq<CreateHNSWIndexGlobalSinkState>();
+	auto &storage = table.GetStorage();
+	state->global_index =
+	    make_uniq<HNSWIndex>(info->index_name, info->constraint_type, storage_ids, TableIOManager::Get(storage),
+	                         unbound_expressions, storage.db, info->options);
+	return std::move(state);
+}
+
+unique_ptr<LocalSinkState> PhysicalCreateHNSWIndex::GetLocalSinkState(ExecutionContext &context) const {
+	auto state = make_uniq<CreateHNSWIndexLocalSinkState>();
+	vector<LogicalType> key_types;
+	for (idx_t i = 0; i < unbound_expressions.size(); i++) {
+		key_types.push_back(unbound_expressions[i]->return_type);
+		state->key_column_ids.push_back(i);
+	}
+	state->key_chunk.InitializeEmpty(key_types);
+	return std::move(state);
+}
+
+SinkResultType PhysicalCreateHNSWIndex::Sink(ExecutionContext &context, DataChunk &chunk,
+                                             OperatorSinkInput &input) const {
+	D_ASSERT(chunk.ColumnCount() >= 2);
+	auto &g_state = input.global_state.Cast<CreateHNSWIndexGlobalSinkState>();
+	auto &l_state = input.local_state.Cast<CreateHNSWIndexLocalSinkState>();
+	l_state.key_chunk.ReferenceColumns(chunk, l_state.key_column_ids);
+
+	// Graph insertions depend on all previously inserted nodes, so the threads take turns on the global index.
+	// The table scan and the projection of the keys still run in parallel.
+	auto &index = *g_state.global_index;
+	IndexLock lock;
+	index.InitializeLock(lock);
+	auto error = index.Insert(lock, l_state.key_chunk, chunk.data[chunk.ColumnCount() - 1]);
+	if (error.HasError()) {
+		error.Throw();
+	}
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+SinkFinalizeType PhysicalCreateHNSWIndex::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                                   OperatorSinkFinalizeInput &input) const {
+
+	// Here, we set the resulting global index as the newly created index of the table.
+	auto &state = input.global_state.Cast<CreateHNSWIndexGlobalSinkState>();
+	D_ASSERT(!state.global_index->VerifyAndToString(true).empty());
+
+	auto &storage = table.GetStorage();
+	if (!storage.IsRoot()) {
+		throw TransactionException("cannot add an index to a table that has been altered");
+	}
+
+	auto &schema = table.schema;
+	info->column_ids = storage_ids;
+
+	// Ensure that the index does not yet exist in the catalog.
+	auto entry = schema.GetEntry(schema.GetCatalogTransaction(context), CatalogType::INDEX_ENTRY, info->index_name);
+	if (entry) {
+		if (info->on_conflict != OnCreateConflict::IGNORE_ON_CONFLICT) {
+			throw CatalogException("Index with name \"%s\" already exists!", info->index_name);
+		}
+		// IF NOT EXISTS on existing index. We are done.
+		return SinkFinalizeType::READY;
+	}
+
+	auto index_entry = schema.CreateIndex(schema.GetCatalogTransaction(context), *info, table).get();
+	D_ASSERT(index_entry);
+	auto &index = index_entry->Cast<DuckIndexEntry>();
+	index.initial_index_size = state.global_index->GetInMemorySize();
+
+	// Add the index to the storage.
+	storage.AddIndex(std::move(state.global_index));
+	return SinkFinalizeType::READY;
+}
+
+//===--------------------------------------------------------------------===//
+// Source
+//===--------------------------------------------------------------------===//
+
+SourceResultType PhysicalCreateHNSWIndex::GetData(ExecutionContext &context, DataChunk &chunk,
+                                                  OperatorSourceInput &input) const {
+	return SourceResultType::FINISHED;
+}
+
+} // namespace duckdb
@@ -30,30 +30,14 @@ hugeint_t GetRangeHugeint(const BaseStatistics &nstats) {
 	return Hugeint::Convert(NumericStats::GetMax<T>(nstats)) - Hugeint::Convert(NumericStats::GetMin<T>(nstats));
 }
 
-static bool CanUsePartitionedAggregate(ClientContext &context, LogicalAggregate &op, PhysicalOperator &child,
-                                       vector<column_t> &partition_columns) {
-	if (op.grouping_sets.size() > 1 || !op.grouping_functions.empty()) {
+bool PhysicalPlanGenerator::HasSingleValuePartitions(ClientContext &context, PhysicalOperator &plan,
+                                                     vector<column_t> &columns) {
+	if (columns.empty()) {
 		return false;
 	}
-	for (auto &expression : op.expressions) {
-		auto &aggregate = expression->Cast<BoundAggregateExpression>();
-		if (aggregate.IsDistinct()) {
-			// distinct aggregates are not supported in partitioned hash aggregates
-			return false;
-		}
-	}
-	// check if the source is partitioned by the aggregate columns
-	// figure out the columns we are grouping by
-	for (auto &group_expr : op.groups) {
-		// only support bound reference here
-		if (group_expr->GetExpressionType() != ExpressionType::BOUND_REF) {
-			return false;
-		}
-		auto &ref = group_expr->Cast<BoundReferenceExpression>();
-		partition_columns.push_back(ref.index);
-	}
-	// traverse the children of the aggregate to find the source operator
-	reference<PhysicalOperator> child_ref(child);
+	// traverse the plan to find the source operator
+	reference<PhysicalOperator> child_ref(plan);
+	vector<column_t> partition_columns = columns;
 	while (child_ref.get().type != PhysicalOperatorType::TABLE_SCAN) {
 		auto &child_op = child_ref.get();
 		switch (child_op.type) {
@@ -101,7 +85,7 @@ static bool CanUsePartitionedAggregate(ClientContext &context, LogicalAggregate
 		col_idx = table_scan.column_ids[col_idx].GetPrimaryIndex();
 		base_columns.push_back(col_idx);
 	}
-	// check if the source operator is partitioned by the grouping columns
+	// check if the source operator is partitioned by the columns
 	TableFunctionPartitionInput input(table_scan.bind_data.get(), base_columns);
 	auto partition_info = table_scan.function.get_partition_info(context, input);
 	if (partition_info != TablePartitionInfo::SINGLE_VALUE_PARTITIONS) {
@@ -109,9 +93,71 @@ static bool CanUsePartitionedAggregate(ClientContext &context, LogicalAggregate
 		return false;
 	}
 	// we have single value partitions!
+	columns = std::move(base_columns);
 	return true;
 }
 
+static bool CanUsePartitionedAggregate(ClientContext &context, LogicalAggregate &op, PhysicalOperator &child,
+                                       bool can_use_simple_aggregation, vector<column_t> &partition_columns,
+                                       vector<idx_t> &partition_groups) {
+	if (op.grouping_sets.size() > 1 || !op.grouping_functions.empty()) {
+		return false;
+	}
+	for (auto &expression : op.expressions) {
+		auto &aggregate = expression->Cast<BoundAggregateExpression>();
+		if (aggregate.IsDistinct()) {
+			// distinct aggregates are not supported in partitioned hash aggregates
+			return false;
+		}
+	}
+	// check if the source is partitioned by the aggregate columns
+	// figure out the columns we are grouping by
+	vector<column_t> group_columns;
+	bool all_bound_refs = true;
+	for (auto &group_expr : op.groups) {
+		// only support bound reference here
+		if (group_expr->GetExpressionType() != ExpressionType::BOUND_REF) {
+			all_bound_refs = false;
+			continue;
+		}
+		auto &ref = group_expr->Cast<BoundReferenceExpression>();
+		group_columns.push_back(ref.index);
+	}
+	if (all_bound_refs && can_use_simple_aggregation) {
+		partition_columns = group_columns;
+		if (PhysicalPlanGenerator::HasSingleValuePartitions(context, child, partition_columns)) {
+			// the source is partitioned by all grouping columns: every partition produces a single group
+			for (idx_t group_idx = 0; group_idx < op.groups.size(); group_idx++) {
+				partition_groups.push_back(group_idx);
+			}
+			return true;
+		}
+	}
+	// otherwise check if the source is partitioned by a subset of the grouping columns
+	// in that case every partition is aggregated in its own (small) hash table
+	for (auto &expression : op.expressions) {
+		auto &aggregate = expression->Cast<BoundAggregateExpression>();
+		if (aggregate.filter) {
+			// filtered aggregates are not supported in the partition-wise hash table
+			return false;
+		}
+	}
+	partition_columns.clear();
+	for (idx_t group_idx = 0; group_idx < op.groups.size(); group_idx++) {
+		auto &group_expr = op.groups[group_idx];
+		if (group_expr->GetExpressionType() != ExpressionType::BOUND_REF) {
+			continue;
+		}
+		vector<column_t> column {group_expr->Cast<BoundReferenceExpression>().index};
+		if (!PhysicalPlanGenerator::HasSingleValuePartitions(context, child, column)) {
+			continue;
+		}
+		partition_columns.push_back(column[0]);
+		partition_groups.push_back(group_idx);
+	}
+	return !partition_columns.empty();
+}
+
 static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate &op, vector<idx_t> &bits_per_group) {
 	if (op.grouping_sets.size() > 1 || !op.grouping_functions.empty()) {
 		return false;
@@ -264,11 +310,13 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate
 		// groups! create a GROUP BY aggregator
 		// use a partitioned or perfect hash aggregate if possible
 		vector<column_t> partition_columns;
+		vector<idx_t> partition_groups;
 		vector<idx_t> required_bits;
-		if (can_use_simple_aggregation && CanUsePartitionedAggregate(context, op, *plan, partition_columns)) {
+		if (CanUsePartitionedAggregate(context, op, *plan, can_use_simple_aggregation, partition_columns,
+		                               partition_groups)) {
 			groupby = make_uniq_base<PhysicalOperator, PhysicalPartitionedAggregate>(
 			    context, op.types, std::move(op.expressions), std::move(op.groups), std::move(partition_columns),
-			    op.estimated_cardinality);
+			    std::move(partition_groups), op.estimated_cardinality);
 		} else if (CanUsePerfectHashAggregate(context, op, required_bits)) {
 			groupby = make_uniq_base<PhysicalOperator, PhysicalPerfectHashAggregate>(
 			    context, op.types, std::move(op.expressions), std::move(op.groups), std::move(op.group_stats),
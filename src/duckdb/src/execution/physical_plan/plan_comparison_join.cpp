@@ -5,14 +5,17 @@
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
 #include "duckdb/execution/operator/join/physical_iejoin.hpp"
 #include "duckdb/execution/operator/join/physical_nested_loop_join.hpp"
+#include "duckdb/execution/operator/join/physical_partitioned_hash_join.hpp"
 #include "duckdb/execution/operator/join/physical_piecewise_merge_join.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/function/table/table_scan.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
 
 namespace duckdb {
@@ -25,6 +28,49 @@ static void RewriteJoinCondition(Expression &expr, idx_t offset) {
 	ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) { RewriteJoinCondition(child, offset); });
 }
 
+//! Find an equality condition on which both sides of an inner join are partitioned (e.g. a hive partition column), so
+//! that the join can be executed partition by partition
+static optional_idx GetPartitionCondition(ClientContext &context, LogicalComparisonJoin &op, PhysicalOperator &left,
+                                          PhysicalOperator &right) {
+	if (op.join_type != JoinType::INNER) {
+		return optional_idx();
+	}
+	// the hash tables of all partitions are kept in memory, as the partitions are not spilled. if they turn out not to
+	// fit, the join falls back to the spilling hash join at runtime, but that costs an extra pass over the build side
+	// so only do this if the entire build side comfortably fits, including the hash (or chain pointer) and the pointer
+	// table of every row
+	idx_t build_row_width = sizeof(hash_t) + 2 * sizeof(data_ptr_t);
+	for (auto &type : right.GetTypes()) {
+		build_row_width += GetTypeIdSize(type.InternalType());
+	}
+	auto &buffer_manager = BufferManager::GetBufferManager(context);
+	if (right.estimated_cardinality * build_row_width > buffer_manager.GetQueryMaxMemory() / 2) {
+		return optional_idx();
+	}
+	for (idx_t cond_idx = 0; cond_idx < op.conditions.size(); cond_idx++) {
+		auto &cond = op.conditions[cond_idx];
+		if (cond.comparison != ExpressionType::COMPARE_EQUAL) {
+			continue;
+		}
+		if (cond.left->GetExpressionType() != ExpressionType::BOUND_REF ||
+		    cond.right->GetExpressionType() != ExpressionType::BOUND_REF) {
+			continue;
+		}
+		auto &type = cond.left->return_type;
+		if (type.IsNested() || type.id() == LogicalTypeId::FLOAT || type.id() == LogicalTypeId::DOUBLE) {
+			// partitions are looked up by value - avoid types for which equality is not bitwise
+			continue;
+		}
+		vector<column_t> left_columns {cond.left->Cast<BoundReferenceExpression>().index};
+		vector<column_t> right_columns {cond.right->Cast<BoundReferenceExpression>().index};
+		if (PhysicalPlanGenerator::HasSingleValuePartitions(context, left, left_columns) &&
+		    PhysicalPlanGenerator::HasSingleValuePartitions(context, right, right_columns)) {
+			return cond_idx;
+		}
+	}
+	return optional_idx();
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalComparisonJoin &op) {
 	// now visit the children
 	D_ASSERT(op.children.size() == 2);
@@ -63,12 +109,26 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 	const auto prefer_range_joins = client_config.prefer_range_joins && can_iejoin;
 
 	unique_ptr<PhysicalOperator> plan;
-	if (has_equality && !prefer_range_joins) {
+	auto partition_condition = has_equality && !prefer_range_joins
+	                               ? GetPartitionCondition(context, op, *left, *right)
+	                               : optional_idx();
+	if (partition_condition.IsValid()) {
+		// both sides are partitioned by a join key: build and probe a separate hash table per partition
+		plan = make_uniq<PhysicalPartitionedHashJoin>(op, std::move(left), std::move(right), std::move(op.conditions),
+		                                              op.left_projection_map, op.right_projection_map,
+		                                              partition_condition.GetIndex(), op.estimated_cardinality);
+	} else if (has_equality && !prefer_range_joins) {
 		// Equality join with small number of keys : possible perfect join optimization
 		plan = make_uniq<PhysicalHashJoin>(
 		    op, std::move(left), std::move(right), std::move(op.conditions), op.join_type, op.left_projection_map,
 		    op.right_projection_map, std::move(op.mark_types), op.estimated_cardinality, std::move(op.filter_pushdown));
-		plan->Cast<PhysicalHashJoin>().join_stats = std::move(op.join_stats);
+		auto &hash_join = plan->Cast<PhysicalHashJoin>();
+		hash_join.join_stats = std::move(op.join_stats);
+		if (CardinalityFeedback::Get(context)) {
+			// report the actual build side cardinality so future plans of this relation can use it
+			hash_join.cardinality_feedback_key =
+			    CardinalityFeedback::GetRelationKey(*op.children[1], hash_join.cardinality_feedback_table);
+		}
 	} else {
 		D_ASSERT(op.left_projection_map.empty());
 		if (left->estimated_cardinality <= client_config.nested_loop_join_threshold ||
@@ -1,12 +1,78 @@
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
 #include "duckdb/execution/operator/order/physical_order.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/operator/logical_filter.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/storage/data_table.hpp"
 
 namespace duckdb {
 
+//! Whether the column (by its index in the output of the operator) is read from a table that is sorted on it within
+//! every row group
+static bool HasSortedRowGroups(LogicalOperator &op, idx_t column_idx) {
+	reference<LogicalOperator> child(op);
+	while (true) {
+		switch (child.get().type) {
+		case LogicalOperatorType::LOGICAL_FILTER: {
+			// filters preserve the order of their input
+			auto &filter = child.get().Cast<LogicalFilter>();
+			if (filter.HasProjectionMap()) {
+				column_idx = filter.projection_map[column_idx];
+			}
+			break;
+		}
+		case LogicalOperatorType::LOGICAL_PROJECTION: {
+			auto &expr = *child.get().expressions[column_idx];
+			if (expr.GetExpressionClass() != ExpressionClass::BOUND_REF) {
+				return false;
+			}
+			column_idx = expr.Cast<BoundReferenceExpression>().index;
+			break;
+		}
+		case LogicalOperatorType::LOGICAL_GET: {
+			auto &get = child.get().Cast<LogicalGet>();
+			auto table = get.GetTable();
+			if (!table || !table->IsDuckTable() || !get.children.empty()) {
+				return false;
+			}
+			if (!get.projection_ids.empty()) {
+				column_idx = get.projection_ids[column_idx];
+			}
+			auto &column_index = get.GetColumnIds()[column_idx];
+			if (column_index.IsRowIdColumn() || column_index.HasChildren()) {
+				return false;
+			}
+			auto &column = table->GetColumn(LogicalIndex(column_index.GetPrimaryIndex()));
+			if (column.Generated()) {
+				return false;
+			}
+			auto &storage = table->Cast<DuckTableEntry>().GetStorage();
+			return storage.HasSortedRowGroups(StorageIndex(column.StorageOid()));
+		}
+		default:
+			return false;
+		}
+		child = *child.get().children[0];
+	}
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalOrder &op) {
 	D_ASSERT(op.children.size() == 1);
 
+	// if the rows are read from row groups that are each sorted on the first key, the sort merges these runs
+	// this has to be checked before planning the child, which moves out the expressions of the logical operators
+	bool sorted_runs = false;
+	if (!op.orders.empty()) {
+		auto &first_order = op.orders[0];
+		if (first_order.type == OrderType::ASCENDING &&
+		    first_order.expression->GetExpressionClass() == ExpressionClass::BOUND_REF) {
+			auto &column_ref = first_order.expression->Cast<BoundReferenceExpression>();
+			sorted_runs = HasSortedRowGroups(*op.children[0], column_ref.index);
+		}
+	}
+
 	auto plan = CreatePlan(*op.children[0]);
 	if (!op.orders.empty()) {
 		vector<idx_t> projection_map;
@@ -19,6 +85,7 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalOrder &op)
 		}
 		auto order = make_uniq<PhysicalOrder>(op.types, std::move(op.orders), std::move(projection_map),
 		                                      op.estimated_cardinality);
+		order->sorted_runs = sorted_runs;
 		order->children.push_back(std::move(plan));
 		plan = std::move(order);
 	}
@@ -1,5 +1,6 @@
 #include "duckdb/execution/operator/aggregate/physical_streaming_window.hpp"
 #include "duckdb/execution/operator/aggregate/physical_window.hpp"
+#include "duckdb/execution/operator/order/physical_order.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/main/client_context.hpp"
@@ -7,10 +8,77 @@
 #include "duckdb/planner/expression/bound_window_expression.hpp"
 #include "duckdb/planner/operator/logical_window.hpp"
 
+#include <algorithm>
 #include <numeric>
 
 namespace duckdb {
 
+//! Aggregates over their entire partition do not depend on the row order within it,
+//! so they can share the sort of a finer partitioning (which only reorders rows within their partitions).
+static bool IsPartitionAggregate(const BoundWindowExpression &wexpr) {
+	if (wexpr.GetExpressionType() != ExpressionType::WINDOW_AGGREGATE || !wexpr.orders.empty()) {
+		return false;
+	}
+	if (wexpr.exclude_clause != WindowExcludeMode::NO_OTHER || wexpr.start != WindowBoundary::UNBOUNDED_PRECEDING) {
+		return false;
+	}
+	switch (wexpr.end) {
+	case WindowBoundary::CURRENT_ROW_RANGE:
+	case WindowBoundary::UNBOUNDED_FOLLOWING:
+		return true;
+	default:
+		return false;
+	}
+}
+
+//! The ordering of the rows produced by a plan (in terms of its output columns), if it is known
+static vector<BoundOrderByNode> GetInputOrders(PhysicalOperator &plan) {
+	vector<BoundOrderByNode> child_orders;
+	vector<idx_t> projections;
+	switch (plan.type) {
+	case PhysicalOperatorType::ORDER_BY: {
+		auto &order = plan.Cast<PhysicalOrder>();
+		for (const auto &child_order : order.orders) {
+			child_orders.emplace_back(child_order.Copy());
+		}
+		projections = order.projections;
+		break;
+	}
+	case PhysicalOperatorType::FILTER:
+		return GetInputOrders(*plan.children[0]);
+	case PhysicalOperatorType::PROJECTION: {
+		child_orders = GetInputOrders(*plan.children[0]);
+		for (const auto &expr : plan.Cast<PhysicalProjection>().select_list) {
+			if (expr->GetExpressionClass() == ExpressionClass::BOUND_REF) {
+				projections.push_back(expr->Cast<BoundReferenceExpression>().index);
+			} else {
+				projections.push_back(DConstants::INVALID_INDEX);
+			}
+		}
+		break;
+	}
+	default:
+		break;
+	}
+
+	//	Map the longest prefix of the orders to the output columns
+	vector<BoundOrderByNode> result;
+	for (auto &order : child_orders) {
+		if (order.expression->GetExpressionClass() != ExpressionClass::BOUND_REF) {
+			break;
+		}
+		const auto child_idx = order.expression->Cast<BoundReferenceExpression>().index;
+		const auto entry = std::find(projections.begin(), projections.end(), child_idx);
+		if (entry == projections.end()) {
+			break;
+		}
+		const auto col_idx = NumericCast<idx_t>(entry - projections.begin());
+		order.expression = make_uniq<BoundReferenceExpression>(order.expression->return_type, col_idx);
+		result.emplace_back(std::move(order));
+	}
+	return result;
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalWindow &op) {
 	D_ASSERT(op.children.size() == 1);
 
@@ -30,16 +98,34 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalWindow &op
 
 	// Identify streaming windows
 	const bool enable_optimizer = ClientConfig::GetConfig(context).enable_optimizer;
+	auto input_orders = enable_optimizer ? GetInputOrders(*plan) : vector<BoundOrderByNode>();
 	vector<idx_t> blocking_windows;
 	vector<idx_t> streaming_windows;
 	for (idx_t expr_idx = 0; expr_idx < op.expressions.size(); expr_idx++) {
-		if (enable_optimizer && PhysicalStreamingWindow::IsStreamingFunction(context, op.expressions[expr_idx])) {
+		auto &expr = op.expressions[expr_idx];
+		if (enable_optimizer && PhysicalStreamingWindow::IsStreamingFunction(context, expr, input_orders)) {
 			streaming_windows.push_back(expr_idx);
 		} else {
 			blocking_windows.push_back(expr_idx);
 		}
 	}
 
+	// Streaming windows are evaluated above the blocking ones, which do not preserve the input order
+	if (!blocking_windows.empty() && !input_orders.empty()) {
+		input_orders.clear();
+		vector<idx_t> unsorted_windows;
+		for (const auto &expr_idx : streaming_windows) {
+			auto &expr = op.expressions[expr_idx];
+			if (PhysicalStreamingWindow::IsStreamingFunction(context, expr, input_orders)) {
+				unsorted_windows.push_back(expr_idx);
+			} else {
+				blocking_windows.push_back(expr_idx);
+			}
+		}
+		streaming_windows.swap(unsorted_windows);
+		std::sort(blocking_windows.begin(), blocking_windows.end());
+	}
+
 	// Process the window functions by sharing the partition/order definitions
 	unordered_map<idx_t, idx_t> projection_map;
 	vector<vector<idx_t>> window_expressions;
@@ -52,6 +138,8 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalWindow &op
 
 		// Find all functions that share the partitioning of the first remaining expression
 		auto over_idx = remaining[0];
+		// The partition-wide aggregates over a coarser partitioning (if any)
+		auto coarse_idx = DConstants::INVALID_INDEX;
 
 		vector<idx_t> matching;
 		vector<idx_t> unprocessed;
@@ -65,13 +153,6 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalWindow &op
 				continue;
 			}
 
-			// If it is in a different partition, skip it
-			const auto &over_expr = op.expressions[over_idx]->Cast<BoundWindowExpression>();
-			if (!over_expr.PartitionsAreEquivalent(wexpr)) {
-				unprocessed.emplace_back(expr_idx);
-				continue;
-			}
-
 			// CSE Elimination: Search for a previous match
 			bool cse = false;
 			for (idx_t i = 0; i < matching.size(); ++i) {
@@ -87,6 +168,51 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalWindow &op
 				continue;
 			}
 
+			// If it is in a different partition, check whether one partitioning refines the other
+			const auto &over_expr = op.expressions[over_idx]->Cast<BoundWindowExpression>();
+			if (!over_expr.PartitionsAreEquivalent(wexpr)) {
+				if (process_streaming || !enable_optimizer) {
+					unprocessed.emplace_back(expr_idx);
+					continue;
+				}
+
+				// A partition-wide aggregate over a coarser partitioning
+				if (IsPartitionAggregate(wexpr)) {
+					bool coarser;
+					if (coarse_idx == DConstants::INVALID_INDEX) {
+						coarser = wexpr.PartitionsAreRefinedBy(over_expr);
+					} else {
+						auto &coarse_expr = op.expressions[coarse_idx]->Cast<BoundWindowExpression>();
+						coarser = wexpr.PartitionsAreEquivalent(coarse_expr);
+					}
+					if (coarser) {
+						if (coarse_idx == DConstants::INVALID_INDEX) {
+							coarse_idx = expr_idx;
+						}
+						matching.emplace_back(expr_idx);
+						continue;
+					}
+				}
+
+				// A finer partitioning of the partition-wide aggregates matched so far
+				if (coarse_idx == DConstants::INVALID_INDEX && over_expr.PartitionsAreRefinedBy(wexpr)) {
+					bool refinable = true;
+					for (const auto &match_idx : matching) {
+						auto &match_expr = op.expressions[match_idx]->Cast<BoundWindowExpression>();
+						refinable = refinable && IsPartitionAggregate(match_expr);
+					}
+					if (refinable) {
+						coarse_idx = over_idx;
+						over_idx = expr_idx;
+						matching.emplace_back(expr_idx);
+						continue;
+					}
+				}
+
+				unprocessed.emplace_back(expr_idx);
+				continue;
+			}
+
 			// Is there a common sort prefix?
 			const auto prefix = over_expr.GetSharedOrders(wexpr);
 			if (prefix != MinValue<idx_t>(over_expr.orders.size(), wexpr.orders.size())) {
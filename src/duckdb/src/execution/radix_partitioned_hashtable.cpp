@@ -184,6 +184,8 @@ public:
 	//! Allocators used during the Sink/Finalize
 	vector<shared_ptr<ArenaAllocator>> stored_allocators;
 	idx_t stored_allocators_size;
+	//! States spilled during the Sink, which are reloaded when the partitions are combined
+	vector<shared_ptr<SpilledAggregateStates>> spilled_states;
 
 	//! Partitions that are finalized during GetData
 	vector<unique_ptr<AggregatePartition>> partitions;
@@ -385,7 +387,10 @@ void MaybeRepartition(ClientContext &context, RadixHTGlobalSinkState &gstate, Ra
 
 	// Check if we're approaching the memory limit
 	auto &temporary_memory_state = *gstate.temporary_memory_state;
-	const auto aggregate_allocator_size = ht.GetAggregateAllocator()->AllocationSize();
+	auto aggregate_allocator_size = ht.GetAggregateAllocator()->AllocationSize();
+	if (ht.GetSpillableAllocator()) {
+		aggregate_allocator_size += ht.GetSpillableAllocator()->AllocationSize();
+	}
 	const auto total_size =
 	    aggregate_allocator_size + ht.GetPartitionedData().SizeInBytes() + ht.Capacity() * sizeof(ht_entry_t);
 	idx_t thread_limit = temporary_memory_state.GetReservation() / gstate.number_of_threads;
@@ -416,7 +421,10 @@ void MaybeRepartition(ClientContext &context, RadixHTGlobalSinkState &gstate, Ra
 				    gstate.radix_ht.GetLayout().ColumnCount() - 1);
 			}
 			ht.SetRadixBits(gstate.config.GetRadixBits());
-			ht.AcquirePartitionedData()->Repartition(*lstate.abandoned_data);
+			auto partitioned_data = ht.AcquirePartitionedData();
+			// The abandoned states are not updated until they are combined: spill the payloads of their states
+			ht.SpillStates(*partitioned_data);
+			partitioned_data->Repartition(*lstate.abandoned_data);
 		}
 	}
 
@@ -534,6 +542,26 @@ void RadixPartitionedHashTable::Combine(ExecutionContext &context, GlobalSinkSta
 	}
 	gstate.stored_allocators.emplace_back(ht.GetAggregateAllocator());
 	gstate.stored_allocators_size += gstate.stored_allocators.back()->AllocationSize();
+	if (ht.GetSpillableAllocator()) {
+		gstate.stored_allocators.emplace_back(ht.GetSpillableAllocator());
+		gstate.stored_allocators_size += gstate.stored_allocators.back()->AllocationSize();
+	}
+	if (ht.GetSpilledStates()) {
+		gstate.spilled_states.emplace_back(ht.GetSpilledStates());
+	}
+}
+
+idx_t RadixPartitionedHashTable::SpilledStateCount(GlobalSinkState &sink_p) {
+	auto &sink = sink_p.Cast<RadixHTGlobalSinkState>();
+	if (!sink.finalized) {
+		// the spilled states are collected during the Combine
+		return 0;
+	}
+	idx_t count = 0;
+	for (auto &spilled_states : sink.spilled_states) {
+		count += spilled_states->Count();
+	}
+	return count;
 }
 
 void RadixPartitionedHashTable::Finalize(ClientContext &context, GlobalSinkState &gstate_p) const {
@@ -1,8 +1,40 @@
 #include "duckdb/function/aggregate_function.hpp"
 
+#include "duckdb/common/serializer/binary_deserializer.hpp"
+#include "duckdb/common/serializer/binary_serializer.hpp"
+#include "duckdb/common/serializer/memory_stream.hpp"
+
 namespace duckdb {
 
 AggregateFunctionInfo::~AggregateFunctionInfo() {
 }
 
+void AggregateFunction::SerializeStates(Vector &states, Vector &result, idx_t count,
+                                        const std::function<void(data_ptr_t, Serializer &)> &serialize_state) {
+	auto sdata = FlatVector::GetData<data_ptr_t>(states);
+	auto rdata = FlatVector::GetData<string_t>(result);
+	MemoryStream stream;
+	for (idx_t i = 0; i < count; i++) {
+		stream.Rewind();
+		BinarySerializer serializer(stream);
+		serializer.Begin();
+		serialize_state(sdata[i], serializer);
+		serializer.End();
+		rdata[i] = StringVector::AddStringOrBlob(result, const_char_ptr_cast(stream.GetData()), stream.GetPosition());
+	}
+}
+
+void AggregateFunction::DeserializeStates(Vector &serialized, Vector &states, idx_t count,
+                                          const std::function<void(data_ptr_t, Deserializer &)> &deserialize_state) {
+	auto sdata = FlatVector::GetData<string_t>(serialized);
+	auto tdata = FlatVector::GetData<data_ptr_t>(states);
+	for (idx_t i = 0; i < count; i++) {
+		MemoryStream stream(data_ptr_cast(sdata[i].GetDataWriteable()), sdata[i].GetSize());
+		BinaryDeserializer deserializer(stream);
+		deserializer.Begin();
+		deserialize_state(tdata[i], deserializer);
+		deserializer.End();
+	}
+}
+
 } // namespace duckdb
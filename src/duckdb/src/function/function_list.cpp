@@ -58,6 +58,7 @@ static const StaticFunctionDefinition function[] = {
 	DUCKDB_SCALAR_FUNCTION(InternalCompressStringUintegerFun),
 	DUCKDB_SCALAR_FUNCTION(InternalCompressStringUsmallintFun),
 	DUCKDB_SCALAR_FUNCTION(InternalCompressStringUtinyintFun),
+	DUCKDB_SCALAR_FUNCTION(InternalContainsAnyFun),
 	DUCKDB_SCALAR_FUNCTION_SET(InternalDecompressIntegralBigintFun),
 	DUCKDB_SCALAR_FUNCTION_SET(InternalDecompressIntegralHugeintFun),
 	DUCKDB_SCALAR_FUNCTION_SET(InternalDecompressIntegralIntegerFun),
@@ -1,5 +1,6 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/function/scalar/list_functions.hpp"
 #include "duckdb/function/scalar/map_functions.hpp"
 #include "duckdb/function/scalar/string_common.hpp"
@@ -67,37 +68,53 @@ static idx_t ContainsAligned(const unsigned char *haystack, idx_t haystack_size,
 	return DConstants::INVALID_INDEX;
 }
 
+//! Whether or not any of the eight bytes packed into "entry" is zero
+static inline bool HasZeroByte(uint64_t entry) {
+	return ((entry - 0x0101010101010101ULL) & ~entry & 0x8080808080808080ULL) != 0;
+}
+
+static inline bool MatchesAt(const unsigned char *haystack, const unsigned char *needle, idx_t needle_size,
+                             idx_t offset) {
+	return haystack[offset] == needle[0] && haystack[offset + needle_size - 1] == needle[needle_size - 1] &&
+	       memcmp(haystack + offset + 1, needle + 1, needle_size - 2) == 0;
+}
+
 idx_t ContainsGeneric(const unsigned char *haystack, idx_t haystack_size, const unsigned char *needle,
                       idx_t needle_size, idx_t base_offset) {
+	D_ASSERT(needle_size >= 2);
 	if (needle_size > haystack_size) {
 		// needle is bigger than haystack: haystack cannot contain needle
 		return DConstants::INVALID_INDEX;
 	}
-	// this implementation is inspired by Raphael Javaux's faststrstr (https://github.com/RaphaelJ/fast_strstr)
 	// generic contains; note that we can't use strstr because we don't have null-terminated strings anymore
-	// we keep track of a shifting window sum of all characters with window size equal to needle_size
-	// this shifting sum is used to avoid calling into memcmp;
-	// we only need to call into memcmp when the window sum is equal to the needle sum
-	// when that happens, the characters are potentially the same and we call into memcmp to check if they are
-	uint32_t sums_diff = 0;
-	for (idx_t i = 0; i < needle_size; i++) {
-		sums_diff += haystack[i];
-		sums_diff -= needle[i];
-	}
+	// we compare the first and the last character of the needle against eight candidate positions at a time
+	// by broadcasting both characters into a 64-bit word and XOR-ing them with the haystack at the candidate
+	// positions: a zero byte in (first XOR | last XOR) means both characters match at that position
+	// only for those candidates do we call into memcmp to compare the middle of the needle
+	const auto last_offset = needle_size - 1;
+	const auto candidate_count = haystack_size - needle_size + 1;
+	const auto first_pattern = 0x0101010101010101ULL * needle[0];
+	const auto last_pattern = 0x0101010101010101ULL * needle[last_offset];
 	idx_t offset = 0;
-	while (true) {
-		if (sums_diff == 0 && haystack[offset] == needle[0]) {
-			if (memcmp(haystack + offset, needle, needle_size) == 0) {
-				return base_offset + offset;
+	for (; offset + sizeof(uint64_t) <= candidate_count; offset += sizeof(uint64_t)) {
+		auto first_entry = Load<uint64_t>(haystack + offset) ^ first_pattern;
+		auto last_entry = Load<uint64_t>(haystack + offset + last_offset) ^ last_pattern;
+		if (!HasZeroByte(first_entry | last_entry)) {
+			continue;
+		}
+		// at least one of the candidates matches the first and last character: verify them in order
+		for (idx_t candidate = offset; candidate < offset + sizeof(uint64_t); candidate++) {
+			if (MatchesAt(haystack, needle, needle_size, candidate)) {
+				return base_offset + candidate;
 			}
 		}
-		if (offset >= haystack_size - needle_size) {
-			return DConstants::INVALID_INDEX;
+	}
+	for (; offset < candidate_count; offset++) {
+		if (MatchesAt(haystack, needle, needle_size, offset)) {
+			return base_offset + offset;
 		}
-		sums_diff -= haystack[offset];
-		sums_diff += haystack[offset + needle_size];
-		offset++;
 	}
+	return DConstants::INVALID_INDEX;
 }
 
 idx_t FindStrInStr(const unsigned char *haystack, idx_t haystack_size, const unsigned char *needle, idx_t needle_size) {
@@ -159,6 +176,122 @@ ScalarFunction GetStringContains() {
 	return string_fun;
 }
 
+struct ContainsAnyBindData : public FunctionData {
+	explicit ContainsAnyBindData(vector<string> needles_p) : needles(std::move(needles_p)) {
+		pair_filter.resize(PAIR_FILTER_SIZE / 64, 0);
+		needles_by_byte.resize(256);
+		for (idx_t needle_idx = 0; needle_idx < needles.size(); needle_idx++) {
+			auto &needle = needles[needle_idx];
+			min_needle_size = MinValue<idx_t>(min_needle_size, needle.size());
+			if (needle.empty()) {
+				continue;
+			}
+			auto data = const_uchar_ptr_cast(needle.c_str());
+			if (needle.size() == 1) {
+				single_bytes[data[0]] = true;
+				continue;
+			}
+			auto pair = PairIndex(data);
+			pair_filter[pair / 64] |= 1ULL << (pair % 64);
+			needles_by_byte[data[0]].push_back(needle_idx);
+		}
+	}
+
+	static constexpr idx_t PAIR_FILTER_SIZE = 65536;
+
+	//! The search strings, a row matches if it contains any of them
+	vector<string> needles;
+	//! The shortest needle; an empty needle matches every row
+	idx_t min_needle_size = NumericLimits<idx_t>::Maximum();
+	//! Bytes that occur as needles of size one
+	bool single_bytes[256] = {};
+	//! Bitmap over the first two bytes of the needles of size two or more
+	vector<uint64_t> pair_filter;
+	//! The needles of size two or more, indexed by their first byte
+	vector<vector<idx_t>> needles_by_byte;
+
+public:
+	static inline idx_t PairIndex(const unsigned char *data) {
+		return idx_t(data[0]) << 8 | idx_t(data[1]);
+	}
+
+	//! Scans the haystack once for all needles: every position is filtered on its first two bytes, and only the
+	//! needles that start with the byte at a surviving position are compared
+	bool Matches(const string_t &haystack_s) const {
+		auto haystack = const_uchar_ptr_cast(haystack_s.GetData());
+		auto haystack_size = haystack_s.GetSize();
+		if (min_needle_size == 0) {
+			return true;
+		}
+		if (min_needle_size > haystack_size) {
+			return false;
+		}
+		const auto candidate_count = haystack_size - min_needle_size + 1;
+		for (idx_t offset = 0; offset < candidate_count; offset++) {
+			auto first = haystack[offset];
+			if (single_bytes[first]) {
+				return true;
+			}
+			if (offset + 1 >= haystack_size) {
+				break;
+			}
+			auto pair = PairIndex(haystack + offset);
+			if (!(pair_filter[pair / 64] & (1ULL << (pair % 64)))) {
+				continue;
+			}
+			for (auto &needle_idx : needles_by_byte[first]) {
+				auto &needle = needles[needle_idx];
+				if (needle.size() <= haystack_size - offset &&
+				    memcmp(haystack + offset, needle.c_str(), needle.size()) == 0) {
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+	unique_ptr<FunctionData> Copy() const override {
+		return make_uniq<ContainsAnyBindData>(needles);
+	}
+
+	bool Equals(const FunctionData &other_p) const override {
+		auto &other = other_p.Cast<ContainsAnyBindData>();
+		return needles == other.needles;
+	}
+};
+
+static void ContainsAnyFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+	auto &info = func_expr.bind_info->Cast<ContainsAnyBindData>();
+	UnaryExecutor::Execute<string_t, bool>(args.data[0], result, args.size(),
+	                                       [&](string_t input) { return info.Matches(input); });
+}
+
+static unique_ptr<FunctionData> ContainsAnyBind(ClientContext &context, ScalarFunction &bound_function,
+                                                vector<unique_ptr<Expression>> &arguments) {
+	vector<string> needles;
+	for (idx_t i = 1; i < arguments.size(); i++) {
+		auto &argument = *arguments[i];
+		if (!argument.IsFoldable()) {
+			throw BinderException(argument, "%s requires constant search strings", bound_function.name);
+		}
+		auto needle = ExpressionExecutor::EvaluateScalar(context, argument);
+		if (needle.IsNull()) {
+			// a NULL search string never matches
+			continue;
+		}
+		needles.push_back(StringValue::Get(needle));
+	}
+	return make_uniq<ContainsAnyBindData>(std::move(needles));
+}
+
+ScalarFunction InternalContainsAnyFun::GetFunction() {
+	ScalarFunction function(InternalContainsAnyFun::Name, {LogicalType::VARCHAR}, LogicalType::BOOLEAN,
+	                        ContainsAnyFunction, ContainsAnyBind);
+	function.varargs = LogicalType::VARCHAR;
+	return function;
+}
+
 ScalarFunctionSet ContainsFun::GetFunctions() {
 	auto string_fun = GetStringContains();
 	auto list_fun = ListContainsFun::GetFunction();
@@ -6,6 +6,7 @@
 #include "duckdb/common/vector_operations/unary_executor.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/function/scalar/string_common.hpp"
 #include "duckdb/function/scalar/string_functions.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "utf8proc_wrapper.hpp"
@@ -43,7 +44,76 @@ unique_ptr<FunctionLocalState> RegexInitLocalState(ExpressionState &state, const
 	if (info.constant_pattern) {
 		return make_uniq<RegexLocalState>(info);
 	}
-	return nullptr;
+	return make_uniq<RegexCacheLocalState>(info, false);
+}
+
+//===--------------------------------------------------------------------===//
+// Pattern Cache
+//===--------------------------------------------------------------------===//
+PrefilteredRegex::PrefilteredRegex(const duckdb_re2::StringPiece &pattern_p, const duckdb_re2::RE2::Options &options,
+                                   bool build_prefilter) {
+	if (build_prefilter) {
+		filter = make_uniq<duckdb_re2::FilteredRE2>(static_cast<int>(MIN_ATOM_LENGTH));
+		int id;
+		if (filter->Add(pattern_p, options, &id) == RE2::NoError) {
+			filter->Compile(&atoms);
+			return;
+		}
+		filter.reset();
+	}
+	pattern = make_uniq<RE2>(pattern_p, options);
+}
+
+bool PrefilteredRegex::MayMatch(const string_t &input) {
+	if (atoms.empty()) {
+		return true;
+	}
+	// the atoms are lower-cased (with Unicode case folding): only ASCII inputs can be lower-cased cheaply
+	const auto size = input.GetSize();
+	const auto data = input.GetData();
+	lowered.resize(size);
+	for (idx_t i = 0; i < size; i++) {
+		if (data[i] & 0x80) {
+			return true;
+		}
+		lowered[i] = StringUtil::CharacterToLower(data[i]);
+	}
+	matched_atoms.clear();
+	const auto haystack = const_uchar_ptr_cast(lowered.data());
+	for (idx_t atom_idx = 0; atom_idx < atoms.size(); atom_idx++) {
+		auto &atom = atoms[atom_idx];
+		if (FindStrInStr(haystack, size, const_uchar_ptr_cast(atom.data()), atom.size()) !=
+		    DConstants::INVALID_INDEX) {
+			matched_atoms.push_back(UnsafeNumericCast<int>(atom_idx));
+		}
+	}
+	filter->AllPotentials(matched_atoms, &potentials);
+	return !potentials.empty();
+}
+
+RegexPatternCache::RegexPatternCache(const duckdb_re2::RE2::Options &options, bool build_prefilter)
+    : options(options), build_prefilter(build_prefilter) {
+}
+
+PrefilteredRegex &RegexPatternCache::GetPattern(const string_t &pattern) {
+	// consecutive rows commonly share their pattern
+	if (!patterns.empty() && string_t(patterns.front().first) == pattern) {
+		return *patterns.front().second;
+	}
+	auto pattern_str = pattern.GetString();
+	auto entry = lookup.find(pattern_str);
+	if (entry != lookup.end()) {
+		patterns.splice(patterns.begin(), patterns, entry->second);
+		return *patterns.front().second;
+	}
+	if (patterns.size() >= MAX_PATTERNS) {
+		lookup.erase(patterns.back().first);
+		patterns.pop_back();
+	}
+	auto regex = make_uniq<PrefilteredRegex>(CreateStringPiece(pattern), options, build_prefilter);
+	patterns.emplace_front(pattern_str, std::move(regex));
+	lookup[std::move(pattern_str)] = patterns.begin();
+	return *patterns.front().second;
 }
 
 //===--------------------------------------------------------------------===//
@@ -92,14 +162,24 @@ unique_ptr<FunctionData> RegexpMatchesBind(ClientContext &context, ScalarFunctio
 	return make_uniq<RegexpMatchesBindData>(options, std::move(constant_string), constant_pattern);
 }
 
+static unique_ptr<FunctionLocalState> RegexpMatchesInitLocalState(ExpressionState &state,
+                                                                  const BoundFunctionExpression &expr,
+                                                                  FunctionData *bind_data) {
+	auto &info = bind_data->Cast<RegexpBaseBindData>();
+	if (!info.constant_pattern) {
+		return make_uniq<RegexCacheLocalState>(info, true);
+	}
+	return make_uniq<RegexLocalState>(info, false, true);
+}
+
 struct RegexPartialMatch {
-	static inline bool Operation(const duckdb_re2::StringPiece &input, duckdb_re2::RE2 &re) {
+	static inline bool Operation(const duckdb_re2::StringPiece &input, const duckdb_re2::RE2 &re) {
 		return duckdb_re2::RE2::PartialMatch(input, re);
 	}
 };
 
 struct RegexFullMatch {
-	static inline bool Operation(const duckdb_re2::StringPiece &input, duckdb_re2::RE2 &re) {
+	static inline bool Operation(const duckdb_re2::StringPiece &input, const duckdb_re2::RE2 &re) {
 		return duckdb_re2::RE2::FullMatch(input, re);
 	}
 };
@@ -114,18 +194,25 @@ static void RegexpMatchesFunction(DataChunk &args, ExpressionState &state, Vecto
 
 	if (info.constant_pattern) {
 		auto &lstate = ExecuteFunctionState::GetFunctionState(state)->Cast<RegexLocalState>();
+		auto &compiled = lstate.compiled;
+		const bool prefilter = compiled.HasPrefilter();
 		UnaryExecutor::Execute<string_t, bool>(strings, result, args.size(), [&](string_t input) {
+			if (prefilter && !compiled.MayMatch(input)) {
+				return false;
+			}
 			return OP::Operation(CreateStringPiece(input), lstate.constant_pattern);
 		});
 	} else {
-		BinaryExecutor::Execute<string_t, string_t, bool>(strings, patterns, result, args.size(),
-		                                                  [&](string_t input, string_t pattern) {
-			                                                  RE2 re(CreateStringPiece(pattern), info.options);
-			                                                  if (!re.ok()) {
-				                                                  throw InvalidInputException(re.error());
-			                                                  }
-			                                                  return OP::Operation(CreateStringPiece(input), re);
-		                                                  });
+		auto &cache = ExecuteFunctionState::GetFunctionState(state)->Cast<RegexCacheLocalState>().cache;
+		BinaryExecutor::Execute<string_t, string_t, bool>(
+		    strings, patterns, result, args.size(), [&](string_t input, string_t pattern) {
+			    auto &regex = cache.GetPattern(pattern);
+			    auto &re = regex.GetPattern();
+			    if (!re.ok()) {
+				    throw InvalidInputException(re.error());
+			    }
+			    return regex.MayMatch(input) && OP::Operation(CreateStringPiece(input), re);
+		    });
 	}
 }
 
@@ -183,9 +270,10 @@ static void RegexReplaceFunction(DataChunk &args, ExpressionState &state, Vector
 			    return StringVector::AddString(result, sstring);
 		    });
 	} else {
+		auto &cache = ExecuteFunctionState::GetFunctionState(state)->Cast<RegexCacheLocalState>().cache;
 		TernaryExecutor::Execute<string_t, string_t, string_t, string_t>(
 		    strings, patterns, replaces, result, args.size(), [&](string_t input, string_t pattern, string_t replace) {
-			    RE2 re(CreateStringPiece(pattern), info.options);
+			    auto &re = cache.GetPattern(pattern).GetPattern();
 			    std::string sstring = input.GetString();
 			    if (info.global_replace) {
 				    RE2::GlobalReplace(&sstring, re, CreateStringPiece(replace));
@@ -230,11 +318,11 @@ static void RegexExtractFunction(DataChunk &args, ExpressionState &state, Vector
 			return Extract(input, result, lstate.constant_pattern, info.rewrite);
 		});
 	} else {
-		BinaryExecutor::Execute<string_t, string_t, string_t>(strings, patterns, result, args.size(),
-		                                                      [&](string_t input, string_t pattern) {
-			                                                      RE2 re(CreateStringPiece(pattern), info.options);
-			                                                      return Extract(input, result, re, info.rewrite);
-		                                                      });
+		auto &cache = ExecuteFunctionState::GetFunctionState(state)->Cast<RegexCacheLocalState>().cache;
+		BinaryExecutor::Execute<string_t, string_t, string_t>(
+		    strings, patterns, result, args.size(), [&](string_t input, string_t pattern) {
+			    return Extract(input, result, cache.GetPattern(pattern).GetPattern(), info.rewrite);
+		    });
 	}
 }
 
@@ -384,14 +472,14 @@ static unique_ptr<FunctionData> RegexExtractBind(ClientContext &context, ScalarF
 
 ScalarFunctionSet RegexpFun::GetFunctions() {
 	ScalarFunctionSet regexp_full_match("regexp_full_match");
-	regexp_full_match.AddFunction(
-	    ScalarFunction({LogicalType::VARCHAR, LogicalType::VARCHAR}, LogicalType::BOOLEAN,
-	                   RegexpMatchesFunction<RegexFullMatch>, RegexpMatchesBind, nullptr, nullptr, RegexInitLocalState,
-	                   LogicalType::INVALID, FunctionStability::CONSISTENT, FunctionNullHandling::SPECIAL_HANDLING));
-	regexp_full_match.AddFunction(
-	    ScalarFunction({LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR}, LogicalType::BOOLEAN,
-	                   RegexpMatchesFunction<RegexFullMatch>, RegexpMatchesBind, nullptr, nullptr, RegexInitLocalState,
-	                   LogicalType::INVALID, FunctionStability::CONSISTENT, FunctionNullHandling::SPECIAL_HANDLING));
+	regexp_full_match.AddFunction(ScalarFunction(
+	    {LogicalType::VARCHAR, LogicalType::VARCHAR}, LogicalType::BOOLEAN, RegexpMatchesFunction<RegexFullMatch>,
+	    RegexpMatchesBind, nullptr, nullptr, RegexpMatchesInitLocalState, LogicalType::INVALID,
+	    FunctionStability::CONSISTENT, FunctionNullHandling::SPECIAL_HANDLING));
+	regexp_full_match.AddFunction(ScalarFunction(
+	    {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR}, LogicalType::BOOLEAN,
+	    RegexpMatchesFunction<RegexFullMatch>, RegexpMatchesBind, nullptr, nullptr, RegexpMatchesInitLocalState,
+	    LogicalType::INVALID, FunctionStability::CONSISTENT, FunctionNullHandling::SPECIAL_HANDLING));
 	return (regexp_full_match);
 }
 
@@ -399,11 +487,11 @@ ScalarFunctionSet RegexpMatchesFun::GetFunctions() {
 	ScalarFunctionSet regexp_partial_match("regexp_matches");
 	regexp_partial_match.AddFunction(ScalarFunction(
 	    {LogicalType::VARCHAR, LogicalType::VARCHAR}, LogicalType::BOOLEAN, RegexpMatchesFunction<RegexPartialMatch>,
-	    RegexpMatchesBind, nullptr, nullptr, RegexInitLocalState, LogicalType::INVALID, FunctionStability::CONSISTENT,
-	    FunctionNullHandling::SPECIAL_HANDLING));
+	    RegexpMatchesBind, nullptr, nullptr, RegexpMatchesInitLocalState, LogicalType::INVALID,
+	    FunctionStability::CONSISTENT, FunctionNullHandling::SPECIAL_HANDLING));
 	regexp_partial_match.AddFunction(ScalarFunction(
 	    {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR}, LogicalType::BOOLEAN,
-	    RegexpMatchesFunction<RegexPartialMatch>, RegexpMatchesBind, nullptr, nullptr, RegexInitLocalState,
+	    RegexpMatchesFunction<RegexPartialMatch>, RegexpMatchesBind, nullptr, nullptr, RegexpMatchesInitLocalState,
 	    LogicalType::INVALID, FunctionStability::CONSISTENT, FunctionNullHandling::SPECIAL_HANDLING));
 	for (auto &func : regexp_partial_match.functions) {
 		BaseScalarFunction::SetReturnsError(func);
@@ -18,11 +18,11 @@ RegexpExtractAll::InitLocalState(ExpressionState &state, const BoundFunctionExpr
 	if (info.constant_pattern) {
 		return make_uniq<RegexLocalState>(info, true);
 	}
-	return nullptr;
+	return make_uniq<RegexCacheLocalState>(info, false);
 }
 
 // Forwards startpos automatically
-bool ExtractAll(duckdb_re2::StringPiece &input, duckdb_re2::RE2 &pattern, idx_t *startpos,
+bool ExtractAll(duckdb_re2::StringPiece &input, const duckdb_re2::RE2 &pattern, idx_t *startpos,
                 duckdb_re2::StringPiece *groups, int ngroups) {
 
 	D_ASSERT(pattern.ok());
@@ -45,8 +45,8 @@ bool ExtractAll(duckdb_re2::StringPiece &input, duckdb_re2::RE2 &pattern, idx_t
 	return true;
 }
 
-void ExtractSingleTuple(const string_t &string, duckdb_re2::RE2 &pattern, int32_t group, RegexStringPieceArgs &args,
-                        Vector &result, idx_t row) {
+void ExtractSingleTuple(const string_t &string, const duckdb_re2::RE2 &pattern, int32_t group,
+                        RegexStringPieceArgs &args, Vector &result, idx_t row) {
 	auto input = CreateStringPiece(string);
 
 	auto &child_vector = ListVector::GetEntry(result);
@@ -126,26 +126,6 @@ int32_t GetGroupIndex(DataChunk &args, idx_t row, int32_t &result) {
 	return true;
 }
 
-duckdb_re2::RE2 &GetPattern(const RegexpBaseBindData &info, ExpressionState &state,
-                            unique_ptr<duckdb_re2::RE2> &pattern_p) {
-	if (info.constant_pattern) {
-		auto &lstate = ExecuteFunctionState::GetFunctionState(state)->Cast<RegexLocalState>();
-		return lstate.constant_pattern;
-	}
-	D_ASSERT(pattern_p);
-	return *pattern_p;
-}
-
-RegexStringPieceArgs &GetGroupsBuffer(const RegexpBaseBindData &info, ExpressionState &state,
-                                      unique_ptr<RegexStringPieceArgs> &groups_p) {
-	if (info.constant_pattern) {
-		auto &lstate = ExecuteFunctionState::GetFunctionState(state)->Cast<RegexLocalState>();
-		return lstate.group_buffer;
-	}
-	D_ASSERT(groups_p);
-	return *groups_p;
-}
-
 void RegexpExtractAll::Execute(DataChunk &args, ExpressionState &state, Vector &result) {
 	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
 	const auto &info = func_expr.bind_info->Cast<RegexpBaseBindData>();
@@ -169,16 +149,23 @@ void RegexpExtractAll::Execute(DataChunk &args, ExpressionState &state, Vector &
 	// Avoid doing extra work if all the inputs are constant
 	idx_t tuple_count = args.AllConstant() ? 1 : args.size();
 
-	unique_ptr<RegexStringPieceArgs> non_const_args;
-	unique_ptr<duckdb_re2::RE2> stored_re;
+	// The pattern and the buffer for its groups, either the constant pattern or the cached one of the current row
+	const duckdb_re2::RE2 *re = nullptr;
+	RegexStringPieceArgs *groups = nullptr;
+	optional_ptr<RegexPatternCache> cache;
+	RegexStringPieceArgs non_const_args;
+	auto &lstate = *ExecuteFunctionState::GetFunctionState(state);
 	if (!info.constant_pattern) {
-		non_const_args = make_uniq<RegexStringPieceArgs>();
+		cache = &lstate.Cast<RegexCacheLocalState>().cache;
+		groups = &non_const_args;
 	} else {
 		// Verify that the constant pattern is valid
-		auto &re = GetPattern(info, state, stored_re);
-		auto group_count_p = re.NumberOfCapturingGroups();
+		auto &constant_state = lstate.Cast<RegexLocalState>();
+		re = &constant_state.constant_pattern;
+		groups = &constant_state.group_buffer;
+		auto group_count_p = re->NumberOfCapturingGroups();
 		if (group_count_p == -1) {
-			throw InvalidInputException("Pattern failed to parse, error: '%s'", re.error());
+			throw InvalidInputException("Pattern failed to parse, error: '%s'", re->error());
 		}
 	}
 
@@ -186,21 +173,20 @@ void RegexpExtractAll::Execute(DataChunk &args, ExpressionState &state, Vector &
 		bool pattern_valid = true;
 		if (!info.constant_pattern) {
 			// Check if the pattern is NULL or not,
-			// and compile the pattern if it's not constant
+			// and look up the compiled pattern if it's not constant
 			auto pattern_idx = pattern_data.sel->get_index(row);
 			if (!pattern_data.validity.RowIsValid(pattern_idx)) {
 				pattern_valid = false;
 			} else {
 				auto &pattern_p = UnifiedVectorFormat::GetData<string_t>(pattern_data)[pattern_idx];
-				auto pattern_strpiece = CreateStringPiece(pattern_p);
-				stored_re = make_uniq<duckdb_re2::RE2>(pattern_strpiece, info.options);
+				re = &cache->GetPattern(pattern_p).GetPattern();
 
 				// Increase the size of the args buffer if needed
-				auto group_count_p = stored_re->NumberOfCapturingGroups();
+				auto group_count_p = re->NumberOfCapturingGroups();
 				if (group_count_p == -1) {
-					throw InvalidInputException("Pattern failed to parse, error: '%s'", stored_re->error());
+					throw InvalidInputException("Pattern failed to parse, error: '%s'", re->error());
 				}
-				non_const_args->SetSize(UnsafeNumericCast<idx_t>(group_count_p));
+				non_const_args.SetSize(UnsafeNumericCast<idx_t>(group_count_p));
 			}
 		}
 
@@ -217,10 +203,8 @@ void RegexpExtractAll::Execute(DataChunk &args, ExpressionState &state, Vector &
 			continue;
 		}
 
-		auto &re = GetPattern(info, state, stored_re);
-		auto &groups = GetGroupsBuffer(info, state, non_const_args);
 		auto &string = UnifiedVectorFormat::GetData<string_t>(strings_data)[string_idx];
-		ExtractSingleTuple(string, re, group_index, groups, result, row);
+		ExtractSingleTuple(string, *re, group_index, *groups, result, row);
 	}
 
 	if (args.AllConstant()) {
@@ -44,7 +44,7 @@ struct ConstantRegexpStringSplit {
 	static idx_t Find(const char *input_data, idx_t input_size, const char *delim_data, idx_t delim_size,
 	                  idx_t &match_size, void *data) {
 		D_ASSERT(data);
-		auto regex = reinterpret_cast<duckdb_re2::RE2 *>(data);
+		auto regex = reinterpret_cast<const duckdb_re2::RE2 *>(data);
 		duckdb_re2::StringPiece match;
 		if (!regex->Match(duckdb_re2::StringPiece(input_data, input_size), 0, input_size, RE2::UNANCHORED, &match, 1)) {
 			return DConstants::INVALID_INDEX;
@@ -166,7 +166,8 @@ static void StringSplitRegexFunction(DataChunk &args, ExpressionState &state, Ve
 	if (info.constant_pattern) {
 		// fast path: pre-compiled regex
 		auto &lstate = ExecuteFunctionState::GetFunctionState(state)->Cast<RegexLocalState>();
-		StringSplitExecutor<ConstantRegexpStringSplit>(args, state, result, &lstate.constant_pattern);
+		auto pattern = const_cast<duckdb_re2::RE2 *>(&lstate.constant_pattern);
+		StringSplitExecutor<ConstantRegexpStringSplit>(args, state, result, pattern);
 	} else {
 		// slow path: have to re-compile regex for every row
 		StringSplitExecutor<RegexpStringSplit>(args, state, result);
@@ -0,0 +1,60 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/main/query_result_cache.hpp"
+
+namespace duckdb {
+
+struct DuckDBQueryResultCacheData : public GlobalTableFunctionState {
+	DuckDBQueryResultCacheData() : finished(false) {
+	}
+
+	bool finished;
+};
+
+static unique_ptr<FunctionData> DuckDBQueryResultCacheBind(ClientContext &context, TableFunctionBindInput &input,
+                                                           vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("entry_count");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("memory_usage_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("hit_count");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("miss_count");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBQueryResultCacheInit(ClientContext &context,
+                                                                TableFunctionInitInput &input) {
+	return make_uniq<DuckDBQueryResultCacheData>();
+}
+
+void DuckDBQueryResultCacheFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBQueryResultCacheData>();
+	if (data.finished) {
+		// finished returning values
+		return;
+	}
+	auto &cache = QueryResultCache::Get(context);
+	idx_t col = 0;
+	// entry_count, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(cache.GetEntryCount())));
+	// memory_usage_bytes, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(cache.GetMemoryUsage())));
+	// hit_count, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(cache.GetHitCount())));
+	// miss_count, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(cache.GetMissCount())));
+	output.SetCardinality(1);
+	data.finished = true;
+}
+
+void DuckDBQueryResultCacheFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_query_result_cache", {}, DuckDBQueryResultCacheFunction,
+	                              DuckDBQueryResultCacheBind, DuckDBQueryResultCacheInit));
+}
+
+} // namespace duckdb
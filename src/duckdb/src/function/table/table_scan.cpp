@@ -6,6 +6,7 @@
 #include "duckdb/common/serializer/deserializer.hpp"
 #include "duckdb/common/serializer/serializer.hpp"
 #include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/execution/index/hnsw/hnsw_index.hpp"
 #include "duckdb/function/function_set.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/client_config.hpp"
@@ -552,6 +553,57 @@ bool TryScanIndex(ART &art, const ColumnList &column_list, TableFunctionInitInpu
 	return true;
 }
 
+//! If too few of the nearest rows are visible, the HNSW search is repeated once for this many times more rows.
+static constexpr idx_t HNSW_OVER_FETCH_FACTOR = 4;
+
+unique_ptr<GlobalTableFunctionState> HNSWIndexScanInitGlobal(ClientContext &context, TableFunctionInitInput &input,
+                                                             DataTable &storage, const TableScanBindData &bind_data) {
+	auto &scan_info = *bind_data.hnsw_scan;
+
+	// The checkpoint lock ensures that we do not checkpoint while scanning this table.
+	auto &transaction = DuckTransaction::Get(context, storage.db);
+	auto checkpoint_lock = transaction.SharedLockTable(*storage.GetDataTableInfo());
+	auto &info = storage.GetDataTableInfo();
+
+	// The index holds no NULL vectors, and it still holds rows that are deleted but not yet cleaned up, or
+	// deleted by this transaction. The TopN above must see at least "limit" rows, so we keep only the visible
+	// rows, and search for more rows if that leaves too few of them.
+	unsafe_vector<row_t> row_ids;
+	for (idx_t search_count = scan_info.limit;; search_count *= HNSW_OVER_FETCH_FACTOR) {
+		bool index_found = false;
+		unsafe_vector<row_t> candidates;
+		info->GetIndexes().BindAndScan<HNSWIndex>(context, *info, [&](HNSWIndex &index) {
+			if (index.GetIndexName() != scan_info.index_name) {
+				return false;
+			}
+			index.Search(scan_info.query.data(), search_count, candidates);
+			index_found = true;
+			return true;
+		});
+		if (!index_found) {
+			// The index no longer exists, so we scan the whole table.
+			return DuckTableScanInitGlobal(context, input, storage, bind_data);
+		}
+
+		row_ids.clear();
+		for (auto row_id : candidates) {
+			if (storage.CanFetch(transaction, row_id)) {
+				row_ids.push_back(row_id);
+			}
+		}
+		if (row_ids.size() >= scan_info.limit) {
+			break;
+		}
+		if (candidates.size() < search_count || search_count > scan_info.limit) {
+			// The index holds too few rows (the others have NULL vectors or are transaction-local), or even the
+			// larger search found too few visible rows, so we scan the whole table.
+			return DuckTableScanInitGlobal(context, input, storage, bind_data);
+		}
+	}
+	// Fetch the nearest neighbors, and scan any transaction-local rows, which are not yet in the index.
+	return DuckIndexScanInitGlobal(context, input, storage, bind_data, row_ids);
+}
+
 unique_ptr<GlobalTableFunctionState> TableScanInitGlobal(ClientContext &context, TableFunctionInitInput &input) {
 	D_ASSERT(input.bind_data);
 
@@ -559,6 +611,10 @@ unique_ptr<GlobalTableFunctionState> TableScanInitGlobal(ClientContext &context,
 	auto &duck_table = bind_data.table.Cast<DuckTableEntry>();
 	auto &storage = duck_table.GetStorage();
 
+	if (bind_data.hnsw_scan) {
+		return HNSWIndexScanInitGlobal(context, input, storage, bind_data);
+	}
+
 	// Can't index scan without filters.
 	if (!input.filters) {
 		return DuckTableScanInitGlobal(context, input, storage, bind_data);
@@ -672,6 +728,12 @@ InsertionOrderPreservingMap<string> TableScanToString(TableFunctionToStringInput
 	InsertionOrderPreservingMap<string> result;
 	auto &bind_data = input.bind_data->Cast<TableScanBindData>();
 	result["Table"] = bind_data.table.name;
+	if (bind_data.hnsw_scan) {
+		result["Type"] = "HNSW Index Scan";
+		result["Index"] = bind_data.hnsw_scan->index_name;
+		result["Limit"] = to_string(bind_data.hnsw_scan->limit);
+		return result;
+	}
 	result["Type"] = bind_data.is_index_scan ? "Index Scan" : "Sequential Scan";
 	return result;
 }
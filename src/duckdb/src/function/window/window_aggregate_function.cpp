@@ -17,10 +17,11 @@ namespace duckdb {
 class WindowAggregateExecutorGlobalState : public WindowExecutorGlobalState {
 public:
 	WindowAggregateExecutorGlobalState(const WindowAggregateExecutor &executor, const idx_t payload_count,
-	                                   const ValidityMask &partition_mask, const ValidityMask &order_mask);
+	                                   const ValidityMask &partition_mask, const ValidityMask &order_mask,
+	                                   shared_ptr<WindowAggregatorState> shared_gsink = nullptr);
 
-	// aggregate global state
-	unique_ptr<WindowAggregatorState> gsink;
+	// aggregate global state (possibly shared with other executors)
+	shared_ptr<WindowAggregatorState> gsink;
 
 	// the filter reference expression.
 	const Expression *filter_ref;
@@ -83,10 +84,13 @@ WindowAggregateExecutor::WindowAggregateExecutor(BoundWindowExpression &wexpr, C
 WindowAggregateExecutorGlobalState::WindowAggregateExecutorGlobalState(const WindowAggregateExecutor &executor,
                                                                        const idx_t group_count,
                                                                        const ValidityMask &partition_mask,
-                                                                       const ValidityMask &order_mask)
+                                                                       const ValidityMask &order_mask,
+                                                                       shared_ptr<WindowAggregatorState> shared_gsink)
     : WindowExecutorGlobalState(executor, group_count, partition_mask, order_mask),
-      filter_ref(executor.filter_ref.get()) {
-	gsink = executor.aggregator->GetGlobalState(executor.context, group_count, partition_mask);
+      gsink(std::move(shared_gsink)), filter_ref(executor.filter_ref.get()) {
+	if (!gsink) {
+		gsink = executor.aggregator->GetGlobalState(executor.context, group_count, partition_mask);
+	}
 }
 
 unique_ptr<WindowExecutorGlobalState> WindowAggregateExecutor::GetGlobalState(const idx_t payload_count,
@@ -95,6 +99,46 @@ unique_ptr<WindowExecutorGlobalState> WindowAggregateExecutor::GetGlobalState(co
 	return make_uniq<WindowAggregateExecutorGlobalState>(*this, payload_count, partition_mask, order_mask);
 }
 
+//	Aggregates with the same state callbacks can evaluate over each other's data,
+//	e.g., var_samp(x) and stddev_pop(x) only differ in how they finalize their states
+static bool HasSameStates(const AggregateFunction &lhs, const AggregateFunction &rhs) {
+	return lhs.state_size == rhs.state_size && lhs.initialize == rhs.initialize && lhs.update == rhs.update &&
+	       lhs.simple_update == rhs.simple_update && lhs.combine == rhs.combine && lhs.destructor == rhs.destructor &&
+	       lhs.order_dependent == rhs.order_dependent;
+}
+
+bool WindowAggregateExecutor::CanShareGlobalState(const WindowExecutor &other_p) const {
+	if (other_p.wexpr.GetExpressionType() != ExpressionType::WINDOW_AGGREGATE) {
+		return false;
+	}
+	auto &other = other_p.Cast<WindowAggregateExecutor>();
+	if (!aggregator->IsFrameIndependent() || !other.aggregator->IsFrameIndependent()) {
+		return false;
+	}
+
+	//	The accelerators must aggregate the same inputs into the same states
+	//	(e.g., sum(x) over different frames, or var_samp(x) and stddev_samp(x) over the same one)
+	auto &owner = other.wexpr;
+	if (!HasSameStates(*wexpr.aggregate, *owner.aggregate) || wexpr.exclude_clause != owner.exclude_clause) {
+		return false;
+	}
+	if (wexpr.bind_info.get() != owner.bind_info.get()) {
+		if (!wexpr.bind_info || !owner.bind_info || !wexpr.bind_info->Equals(*owner.bind_info)) {
+			return false;
+		}
+	}
+	return Expression::ListEquals(wexpr.children, owner.children) &&
+	       Expression::Equals(wexpr.filter_expr, owner.filter_expr);
+}
+
+unique_ptr<WindowExecutorGlobalState>
+WindowAggregateExecutor::GetSharedGlobalState(const idx_t payload_count, const ValidityMask &partition_mask,
+                                              const ValidityMask &order_mask, WindowExecutorGlobalState &shared) const {
+	auto &gastate = shared.Cast<WindowAggregateExecutorGlobalState>();
+	return make_uniq<WindowAggregateExecutorGlobalState>(*this, payload_count, partition_mask, order_mask,
+	                                                     gastate.gsink);
+}
+
 class WindowAggregateExecutorLocalState : public WindowExecutorBoundsState {
 public:
 	WindowAggregateExecutorLocalState(const WindowExecutorGlobalState &gstate, const WindowAggregator &aggregator)
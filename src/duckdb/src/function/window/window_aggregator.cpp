@@ -78,6 +78,10 @@ void WindowAggregatorLocalState::Finalize(WindowAggregatorGlobalState &gastate,
 	}
 }
 
+bool WindowAggregator::IsFrameIndependent() const {
+	return false;
+}
+
 void WindowAggregator::Finalize(WindowAggregatorState &gstate, WindowAggregatorState &lstate, CollectionPtr collection,
                                 const FrameStats &stats) {
 	auto &gasink = gstate.Cast<WindowAggregatorGlobalState>();
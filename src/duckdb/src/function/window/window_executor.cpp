@@ -82,6 +82,17 @@ unique_ptr<WindowExecutorGlobalState> WindowExecutor::GetGlobalState(const idx_t
 	return make_uniq<WindowExecutorGlobalState>(*this, payload_count, partition_mask, order_mask);
 }
 
+bool WindowExecutor::CanShareGlobalState(const WindowExecutor &other) const {
+	return false;
+}
+
+unique_ptr<WindowExecutorGlobalState> WindowExecutor::GetSharedGlobalState(const idx_t payload_count,
+                                                                           const ValidityMask &partition_mask,
+                                                                           const ValidityMask &order_mask,
+                                                                           WindowExecutorGlobalState &shared) const {
+	return GetGlobalState(payload_count, partition_mask, order_mask);
+}
+
 unique_ptr<WindowExecutorLocalState> WindowExecutor::GetLocalState(const WindowExecutorGlobalState &gstate) const {
 	return make_uniq<WindowExecutorBoundsState>(gstate);
 }
@@ -137,8 +137,8 @@ public:
 	}
 
 	void Finalize(WindowAggregatorGlobalState &gastate, CollectionPtr collection) override;
-	void Evaluate(const WindowSegmentTreeGlobalState &gsink, const DataChunk &bounds, Vector &result, idx_t count,
-	              idx_t row_idx);
+	void Evaluate(const AggregateObject &aggr, const WindowSegmentTreeGlobalState &gsink, const DataChunk &bounds,
+	              Vector &result, idx_t count, idx_t row_idx);
 	//! The left (default) segment tree part
 	unique_ptr<WindowSegmentTreePart> part;
 	//! The right segment tree part (for EXCLUDE)
@@ -191,6 +191,11 @@ unique_ptr<WindowAggregatorState> WindowSegmentTree::GetLocalState(const WindowA
 	return make_uniq<WindowSegmentTreeState>();
 }
 
+bool WindowSegmentTree::IsFrameIndependent() const {
+	//	The tree levels are built over the whole hash group
+	return true;
+}
+
 void WindowSegmentTreePart::FlushStates(bool combining) {
 	if (!flush_count) {
 		return;
@@ -394,18 +399,20 @@ void WindowSegmentTree::Evaluate(const WindowAggregatorState &gsink, WindowAggre
                                  const DataChunk &bounds, Vector &result, idx_t count, idx_t row_idx) const {
 	const auto &gtstate = gsink.Cast<WindowSegmentTreeGlobalState>();
 	auto &ltstate = lstate.Cast<WindowSegmentTreeState>();
-	ltstate.Evaluate(gtstate, bounds, result, count, row_idx);
+	//	The tree may have been built by another aggregate with the same states,
+	//	so we use our own function to finalize the results
+	ltstate.Evaluate(aggr, gtstate, bounds, result, count, row_idx);
 }
 
-void WindowSegmentTreeState::Evaluate(const WindowSegmentTreeGlobalState &gtstate, const DataChunk &bounds,
-                                      Vector &result, idx_t count, idx_t row_idx) {
+void WindowSegmentTreeState::Evaluate(const AggregateObject &aggr, const WindowSegmentTreeGlobalState &gtstate,
+                                      const DataChunk &bounds, Vector &result, idx_t count, idx_t row_idx) {
 	auto window_begin = FlatVector::GetData<const idx_t>(bounds.data[FRAME_BEGIN]);
 	auto window_end = FlatVector::GetData<const idx_t>(bounds.data[FRAME_END]);
 	auto peer_begin = FlatVector::GetData<const idx_t>(bounds.data[PEER_BEGIN]);
 	auto peer_end = FlatVector::GetData<const idx_t>(bounds.data[PEER_END]);
 
 	if (!part) {
-		part = make_uniq<WindowSegmentTreePart>(allocator, gtstate.aggr, cursor->Copy(), gtstate.filter_mask);
+		part = make_uniq<WindowSegmentTreePart>(allocator, aggr, cursor->Copy(), gtstate.filter_mask);
 	}
 
 	if (gtstate.aggregator.exclude_mode != WindowExcludeMode::NO_OTHER) {
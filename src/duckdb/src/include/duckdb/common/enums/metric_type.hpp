@@ -69,6 +69,10 @@ enum class MetricsType : uint8_t {
     OPTIMIZER_MATERIALIZED_CTE,
     OPTIMIZER_SUM_REWRITER,
     OPTIMIZER_LATE_MATERIALIZATION,
+    OPTIMIZER_COMMON_SUBPLAN,
+    OPTIMIZER_AGGREGATE_PUSHDOWN,
+    OPTIMIZER_HNSW_INDEX_SCAN,
+    PHASE_PLAN_NODES,
 };
 
 struct MetricsTypeHashFunction {
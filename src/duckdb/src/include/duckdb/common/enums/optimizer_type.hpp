@@ -41,7 +41,10 @@ enum class OptimizerType : uint32_t {
 	EXTENSION,
 	MATERIALIZED_CTE,
 	SUM_REWRITER,
-	LATE_MATERIALIZATION
+	LATE_MATERIALIZATION,
+	COMMON_SUBPLAN,
+	AGGREGATE_PUSHDOWN,
+	HNSW_INDEX_SCAN
 };
 
 string OptimizerTypeToString(OptimizerType type);
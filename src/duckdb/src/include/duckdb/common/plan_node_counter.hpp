@@ -0,0 +1,29 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/plan_node_counter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+//! The PlanNodeCounter counts the plan nodes created by the current thread, so that the query profiler can report
+//! how many plan nodes every planning/optimization phase creates (the PHASE_PLAN_NODES metric). Logical operators are
+//! counted on construction. Expressions are created during execution as well, so they are only counted by the
+//! optimizer passes that generate them in bulk (e.g. the FilterCombiner).
+//! Note that this is a count of constructed plan nodes - not of memory allocations or of allocated bytes: the plan is
+//! allocated with the global allocator, which does not track individual allocations.
+class PlanNodeCounter {
+public:
+	//! Registers the creation of "count" plan nodes
+	DUCKDB_API static void Increment(idx_t count = 1);
+	//! Returns the number of plan nodes created by the current thread
+	DUCKDB_API static idx_t GetCount();
+};
+
+} // namespace duckdb
@@ -43,9 +43,11 @@ public:
 		throw NotImplementedException("Cannot read data from this type");
 	}
 
-	static inline void EncodeStringDataPrefix(data_ptr_t dataptr, string_t value, idx_t prefix_len) {
-		auto len = value.GetSize();
-		memcpy(dataptr, value.GetData(), MinValue(len, prefix_len));
+	static inline void EncodeStringDataPrefix(data_ptr_t dataptr, string_t value, idx_t prefix_len,
+	                                          idx_t skip_len = 0) {
+		skip_len = MinValue<idx_t>(skip_len, value.GetSize());
+		auto len = value.GetSize() - skip_len;
+		memcpy(dataptr, value.GetData() + skip_len, MinValue(len, prefix_len));
 		if (len < prefix_len) {
 			memset(dataptr + len, '\0', prefix_len - len);
 		}
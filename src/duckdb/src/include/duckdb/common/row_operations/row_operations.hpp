@@ -42,10 +42,13 @@ public:
 };
 
 struct RowOperationsState {
-	explicit RowOperationsState(ArenaAllocator &allocator) : allocator(allocator) {
+	explicit RowOperationsState(ArenaAllocator &allocator, bool spillable = false)
+	    : allocator(allocator), spillable(spillable) {
 	}
 
 	ArenaAllocator &allocator;
+	//! Whether the states are updated by a hash table that can spill them (see AggregateInputData::spillable)
+	bool spillable;
 };
 
 // RowOperations contains a set of operations that operate on data using a RowLayout
@@ -119,9 +122,10 @@ struct RowOperations {
 	// Sorting Operators
 	//===--------------------------------------------------------------------===//
 	//! Scatter vector data to the rows in radix-sortable format.
+	//! For strings, the first skip_len bytes (a prefix that all strings share) are left out.
 	static void RadixScatter(Vector &v, idx_t vcount, const SelectionVector &sel, idx_t ser_count,
 	                         data_ptr_t key_locations[], bool desc, bool has_null, bool nulls_first, idx_t prefix_len,
-	                         idx_t width, idx_t offset = 0);
+	                         idx_t width, idx_t offset = 0, idx_t skip_len = 0);
 
 	//===--------------------------------------------------------------------===//
 	// Out-of-Core Operators
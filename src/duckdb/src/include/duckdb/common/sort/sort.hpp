@@ -22,6 +22,8 @@ struct SortConstants {
 	static constexpr idx_t MSD_RADIX_LOCATIONS = VALUES_PER_RADIX + 1;
 	static constexpr idx_t INSERTION_SORT_THRESHOLD = 24;
 	static constexpr idx_t MSD_RADIX_SORT_SIZE_THRESHOLD = 4;
+	//! Maximum number of pre-sorted runs in a block for which we merge the runs rather than sorting the block
+	static constexpr idx_t MAX_SORTED_RUNS = 64;
 };
 
 struct SortLayout {
@@ -41,6 +43,9 @@ public:
 	vector<bool> constant_size;
 	vector<idx_t> column_sizes;
 	vector<idx_t> prefix_lengths;
+	//! Length of the prefix that all values of a VARCHAR column share (according to the statistics).
+	//! This prefix is left out of the radix sorting data, so that prefix_lengths covers the distinguishing bytes
+	vector<idx_t> common_prefix_lengths;
 	vector<BaseStatistics *> stats;
 	vector<bool> has_null;
 
@@ -80,7 +85,6 @@ public:
 	//! Sorted data
 	vector<unique_ptr<SortedBlock>> sorted_blocks;
 	vector<vector<unique_ptr<SortedBlock>>> sorted_blocks_temp;
-	unique_ptr<SortedBlock> odd_one_out;
 
 	//! Pinned heap data (if sorting in memory)
 	vector<unique_ptr<RowDataBlock>> heap_blocks;
@@ -91,11 +95,14 @@ public:
 	//! Whether we are doing an external sort
 	bool external;
 
-	//! Progress in merge path stage
-	idx_t pair_idx;
-	idx_t num_pairs;
-	idx_t l_start;
-	idx_t r_start;
+	//! The maximum number of sorted blocks that are merged into one in a single merge round
+	static constexpr idx_t MERGE_FAN_IN = 16;
+
+	//! Progress in merge stage: sorted blocks [group_offsets[g], group_offsets[g + 1]) are merged into one
+	idx_t group_idx;
+	vector<idx_t> group_offsets;
+	//! Start of the next partition within each sorted block of the current group
+	vector<idx_t> run_starts;
 };
 
 struct LocalSortState {
@@ -116,6 +123,11 @@ public:
 private:
 	//! Sorts the data in the newly created SortedBlock
 	void SortInMemory();
+	//! Sorts the data in the newly created SortedBlock by merging its pre-sorted runs
+	void MergeSortedRuns();
+	//! Detects where the rows that were just sunk break the current sorted run
+	void TrackSortedRuns(data_ptr_t key_locations[], idx_t count);
+	void ResetSortedRuns();
 	//! Re-order the local state after sorting
 	void ReOrder(GlobalSortState &gstate, bool reorder_heap);
 	//! Re-order a SortedData object after sorting
@@ -125,6 +137,9 @@ private:
 public:
 	//! Whether this local state has been initialized
 	bool initialized;
+	//! Whether to detect runs of pre-sorted rows in the input (e.g. from a table that is sorted per row group), and
+	//! merge these runs instead of sorting them
+	bool detect_sorted_runs;
 	//! The buffer manager
 	BufferManager *buffer_manager;
 	//! The sorting and payload layouts
@@ -145,6 +160,12 @@ private:
 	//! Selection vector and addresses for scattering the data to rows
 	const SelectionVector &sel_ptr = *FlatVector::IncrementalSelectionVector();
 	Vector addresses = Vector(LogicalType::POINTER);
+	//! Whether the data accumulated so far consists of few enough sorted runs to merge them
+	bool has_sorted_runs;
+	//! The start offsets of the sorted runs in the data accumulated so far
+	vector<idx_t> run_starts;
+	//! The comparison key of the last row that was sunk
+	unsafe_unique_array<data_t> last_key;
 };
 
 struct MergeSorter {
@@ -161,47 +182,57 @@ private:
 	BufferManager &buffer_manager;
 	const SortLayout &sort_layout;
 
-	//! The left and right reader
-	unique_ptr<SBScanState> left;
-	unique_ptr<SBScanState> right;
+	//! Readers of the complete sorted blocks of the current group (used for partitioning)
+	vector<unique_ptr<SBScanState>> runs;
+	//! Readers of the slices that are merged by this thread
+	vector<unique_ptr<SBScanState>> inputs;
 
 	//! Input and output blocks
-	unique_ptr<SortedBlock> left_input;
-	unique_ptr<SortedBlock> right_input;
+	vector<unique_ptr<SortedBlock>> input_slices;
 	SortedBlock *result;
 
+	//! Loser tree over the inputs: tree[0] holds the current winner, the other nodes hold the loser of their match
+	vector<idx_t> tree;
+	//! Whether the slice of an input has been fully merged
+	vector<bool> exhausted;
+
 private:
-	//! Computes the left and right block that will be merged next (Merge Path partition)
+	//! Computes the slices of the sorted blocks that will be merged next (k-way Merge Path partition)
 	void GetNextPartition();
-	//! Finds the boundary of the next partition using binary search
-	void GetIntersection(const idx_t diagonal, idx_t &l_idx, idx_t &r_idx);
-	//! Compare values within SortedBlocks using a global index
+	//! Computes, for each sorted block in the group, how many of its rows are among the first 'rank' merged rows
+	void GetPartitionBoundaries(const idx_t rank, vector<idx_t> &ends);
+	//! Computes the rank of the row at 'run_idx' in sorted block 'run' within the merged group
+	idx_t ComputeRank(const idx_t run, const idx_t run_idx, const idx_t max_rank);
+	//! Compare values within the sorted blocks of the current group using a global index
 	int CompareUsingGlobalIndex(SBScanState &l, SBScanState &r, const idx_t l_idx, const idx_t r_idx);
 
-	//! Finds the next partition and merges it
+	//! Merges the slices of the current partition into the result block
 	void MergePartition();
 
-	//! Computes how the next 'count' tuples should be merged by setting the 'left_smaller' array
-	void ComputeMerge(const idx_t &count, bool left_smaller[]);
-
-	//! Merges the radix sorting blocks according to the 'left_smaller' array
-	void MergeRadix(const idx_t &count, const bool left_smaller[]);
-	//! Merges SortedData according to the 'left_smaller' array
-	void MergeData(SortedData &result_data, SortedData &l_data, SortedData &r_data, const idx_t &count,
-	               const bool left_smaller[], idx_t next_entry_sizes[], bool reset_indices);
-	//! Merges constant size rows according to the 'left_smaller' array
-	void MergeRows(data_ptr_t &l_ptr, idx_t &l_entry_idx, const idx_t &l_count, data_ptr_t &r_ptr, idx_t &r_entry_idx,
-	               const idx_t &r_count, RowDataBlock &target_block, data_ptr_t &target_ptr, const idx_t &entry_size,
-	               const bool left_smaller[], idx_t &copied, const idx_t &count);
-	//! Flushes constant size rows into the result
-	void FlushRows(data_ptr_t &source_ptr, idx_t &source_entry_idx, const idx_t &source_count,
-	               RowDataBlock &target_block, data_ptr_t &target_ptr, const idx_t &entry_size, idx_t &copied,
-	               const idx_t &count);
-	//! Flushes blob rows and accompanying heap
-	void FlushBlobs(const RowLayout &layout, const idx_t &source_count, data_ptr_t &source_data_ptr,
-	                idx_t &source_entry_idx, data_ptr_t &source_heap_ptr, RowDataBlock &target_data_block,
-	                data_ptr_t &target_data_ptr, RowDataBlock &target_heap_block, BufferHandle &target_heap_handle,
-	                data_ptr_t &target_heap_ptr, idx_t &copied, const idx_t &count);
+	//! Whether the current row of input 'l' comes before the current row of input 'r' (ties go to the lower input)
+	bool InputLess(const idx_t l, const idx_t r);
+	//! Builds the loser tree over the current rows of the inputs
+	void InitializeTree();
+	//! Replays the matches on the path from input 'input' to the root after its current row has changed
+	void ReplayTree(idx_t input);
+	//! Pins the current block of an input, or marks it as exhausted
+	void PinInput(const idx_t input);
+	//! Computes how many rows (from the current row of the current block) the winner of the loser tree wins in a row
+	idx_t GetRunLength(const idx_t winner);
+	//! Appends 'count' rows from the current row of an input to the result and advances the input
+	void AppendRun(const idx_t input, const idx_t count);
+	//! Appends 'count' rows from the current row of 'source_data' to the last block of 'result_data'
+	void AppendData(SBScanState &source, const idx_t count, SortedData &source_data, SortedData &result_data,
+	                BufferHandle &result_data_handle, BufferHandle &result_heap_handle);
+	//! Sizes the heap block of 'result_data' for the heap entries of all rows of the inputs
+	void ReserveResultHeap(SortedData &result_data, SortedData &(*get_data)(SortedBlock &sb));
+
+	//! Pinned result blocks
+	BufferHandle result_radix_handle;
+	BufferHandle result_blob_handle;
+	BufferHandle result_blob_heap_handle;
+	BufferHandle result_payload_handle;
+	BufferHandle result_payload_heap_handle;
 };
 
 struct SBIterator {
@@ -30,6 +30,8 @@ public:
 	static constexpr idx_t Q = 64 - P;
 	static constexpr idx_t M = 1 << P;
 	static constexpr double ALPHA = 0.721347520444481703680; // 1 / (2 log(2))
+	//! Size of a sketch written by ToBlob: the storage type followed by the registers
+	static constexpr idx_t BLOB_SIZE = 1 + M;
 
 public:
 	HyperLogLog() {
@@ -67,6 +69,11 @@ public:
 	void Serialize(Serializer &serializer) const;
 	static unique_ptr<HyperLogLog> Deserialize(Deserializer &deserializer);
 
+	//! Write the sketch to "target", which must hold BLOB_SIZE bytes
+	void ToBlob(data_ptr_t target) const;
+	//! Merge a sketch that was written by ToBlob into this HLL
+	void MergeBlob(const_data_ptr_t blob, idx_t size);
+
 	//! Algorithm 4
 	void ExtractCounts(uint32_t *c) const;
 	//! Algorithm 6
@@ -11,41 +11,62 @@
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/chrono.hpp"
-#include "duckdb/common/random_engine.hpp"
 
 namespace duckdb {
 
 struct AdaptiveFilterState {
+	//! The time at which the previous predicate finished (or the filter started)
 	time_point<high_resolution_clock> start_time;
+	//! Whether or not statistics are gathered for this evaluation
+	bool adaptive = false;
 };
 
+//! Runtime statistics of a single predicate of an adaptive filter
+struct AdaptivePredicateStatistics {
+	//! The (smoothed) time spent per input tuple
+	double cost = 0;
+	//! The (smoothed) fraction of input tuples that pass the predicate
+	double selectivity = 0;
+	//! Whether or not the predicate has been observed at all
+	bool observed = false;
+};
+
+//! AdaptiveFilter orders the predicates of a conjunction (or the filters of a table scan) by their rank. The rank
+//! combines the observed cost and selectivity of each predicate: for an AND, predicates that remove the most tuples
+//! per unit of time are evaluated first ((1 - selectivity) / cost), for an OR predicates that accept the most tuples
+//! per unit of time (selectivity / cost). Statistics are exponentially smoothed, and every predicate is periodically
+//! moved to the front to refresh its (otherwise conditional) statistics.
 class AdaptiveFilter {
 public:
 	explicit AdaptiveFilter(const Expression &expr);
 	explicit AdaptiveFilter(const TableFilterSet &table_filters);
 
+	//! The order in which the predicates are evaluated
 	vector<idx_t> permutation;
 
-public:
-	void AdaptRuntimeStatistics(double duration);
+	//! The weight of a new observation in the smoothed statistics
+	static constexpr double SMOOTHING_FACTOR = 0.1;
+	//! The amount of evaluations after which a predicate is moved to the front to re-explore it
+	static constexpr idx_t EXPLORE_INTERVAL = 64;
 
+public:
 	AdaptiveFilterState BeginFilter() const;
+	//! Record the evaluation of the predicate with the given index, which selected output_count of input_count tuples
+	void EndPredicate(AdaptiveFilterState &state, idx_t predicate_idx, idx_t input_count, idx_t output_count);
 	void EndFilter(AdaptiveFilterState state);
 
+private:
+	double GetRank(idx_t predicate_idx) const;
+
 private:
 	bool disable_permutations = false;
+	//! Whether the predicates are OR-ed together (rather than AND-ed)
+	bool is_disjunction = false;
 
-	//! used for adaptive expression reordering
+	vector<AdaptivePredicateStatistics> statistics;
+	//! The amount of evaluations of the filter so far
 	idx_t iteration_count = 0;
-	idx_t swap_idx = 0;
-	idx_t right_random_border = 0;
-	idx_t observe_interval = 0;
-	idx_t execute_interval = 0;
-	double runtime_sum = 0;
-	double prev_mean = 0;
-	bool observe = false;
-	bool warmup = false;
-	vector<idx_t> swap_likeliness;
-	RandomEngine generator;
+	//! The next predicate to re-explore
+	idx_t explore_idx = 0;
 };
 } // namespace duckdb
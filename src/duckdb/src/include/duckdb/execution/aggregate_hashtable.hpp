@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/row_operations/row_matcher.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
 #include "duckdb/common/types/row/partitioned_tuple_data.hpp"
 #include "duckdb/execution/base_aggregate_hashtable.hpp"
 #include "duckdb/execution/ht_entry.hpp"
@@ -22,6 +23,28 @@ class BufferHandle;
 
 struct FlushMoveState;
 
+//! The serialized payloads of aggregate states that were spilled from a GroupedAggregateHashTable. The payloads are
+//! kept in a buffer-managed ColumnDataCollection (a BLOB column per spillable aggregate), which can be evicted to
+//! temporary storage. Spilled rows refer to their payloads through the AggregateSpillSlot behind each state.
+class SpilledAggregateStates {
+public:
+	SpilledAggregateStates(BufferManager &buffer_manager, const TupleDataLayout &layout);
+
+	//! Serializes the spillable states of the rows, then releases their payloads and re-initializes them
+	void Spill(RowOperationsState &state, const TupleDataLayout &layout, Vector &row_locations, idx_t count);
+	//! Restores the spilled states of the rows (which may have been spilled from different hash tables)
+	static void Reload(RowOperationsState &state, const TupleDataLayout &layout, Vector &row_locations, idx_t count);
+	//! The number of rows whose states were spilled
+	idx_t Count() const {
+		return payloads.Count();
+	}
+
+private:
+	ColumnDataCollection payloads;
+	ColumnDataAppendState append_state;
+	DataChunk payload_chunk;
+};
+
 //! GroupedAggregateHashTable is a linear probing HT that is used for computing
 //! aggregates
 /*!
@@ -85,6 +108,13 @@ public:
 	void Abandon();
 	void Repartition();
 	shared_ptr<ArenaAllocator> GetAggregateAllocator();
+	//! The arena allocator used by spillable aggregates while sinking (nullptr if there are none)
+	shared_ptr<ArenaAllocator> GetSpillableAllocator();
+	//! The states spilled by this HT (nullptr if it did not spill)
+	shared_ptr<SpilledAggregateStates> GetSpilledStates();
+	//! Spills the states of the (abandoned) data, which will not be updated until they are combined. Releases the
+	//! payloads of the spillable aggregates, so no other rows of this HT may hold spillable states.
+	void SpillStates(PartitionedTupleData &data);
 
 	//! Resize the HT to the specified size. Must be larger than the current size.
 	void Resize(idx_t size);
@@ -170,8 +200,12 @@ private:
 
 	//! The active arena allocator used by the aggregates for their internal state
 	shared_ptr<ArenaAllocator> aggregate_allocator;
+	//! The arena allocator used by spillable aggregates, kept apart so it can be reset after spilling
+	shared_ptr<ArenaAllocator> spillable_allocator;
 	//! Owning arena allocators that this HT has data from
 	vector<shared_ptr<ArenaAllocator>> stored_allocators;
+	//! The states spilled by this HT
+	shared_ptr<SpilledAggregateStates> spilled_states;
 
 private:
 	//! Disabled the copy constructor
@@ -10,6 +10,7 @@
 
 #include "duckdb/planner/logical_operator_visitor.hpp"
 #include "duckdb/planner/column_binding_map.hpp"
+#include "duckdb/common/optional_idx.hpp"
 #include "duckdb/common/vector.hpp"
 
 namespace duckdb {
@@ -27,6 +28,11 @@ public:
 protected:
 	vector<ColumnBinding> bindings;
 	bool verify_only;
+	//! Maps bindings to their index in "bindings" - lazily (re)built when "bindings" is large and changes
+	column_binding_map_t<idx_t> binding_index;
+
+	//! Find the index of a binding in the current set of column bindings
+	optional_idx FindBinding(const ColumnBinding &binding);
 
 	unique_ptr<Expression> VisitReplace(BoundColumnRefExpression &expr, unique_ptr<Expression> *expr_ptr) override;
 	static unordered_set<idx_t> VerifyInternal(LogicalOperator &op);
@@ -103,6 +103,9 @@ protected:
 	                                                   ExpressionExecutorState &state);
 	static unique_ptr<ExpressionState> InitializeState(const BoundParameterExpression &expr,
 	                                                   ExpressionExecutorState &state);
+	//! Compile the outermost fusable expressions below the state into fused kernels (if enabled). The nodes of a fused
+	//! chain are evaluated by the kernel of its root, so they are not fused themselves.
+	static void InitializeFusedExpressions(ExpressionState &state);
 
 	void Execute(const Expression &expr, ExpressionState *state, const SelectionVector *sel, idx_t count,
 	             Vector &result);
@@ -12,16 +12,66 @@
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/function/function.hpp"
 
+#include <functional>
+
 namespace duckdb {
 class Expression;
 class ExpressionExecutor;
 struct ExpressionExecutorState;
 struct FunctionLocalState;
+class FusedExpression;
+
+//! DictionaryExpressionCache memoizes the result of an expression per entry of a dictionary vector argument (when all
+//! other arguments are constant), so that the expression is evaluated once per dictionary entry instead of once per
+//! row. Dictionaries with an id (e.g. from dictionary compressed storage or Parquet files) are cached across chunks.
+//! Only the entries that are referenced by a chunk are evaluated, so errors are only thrown for values that are
+//! actually present in the input.
+struct DictionaryExpressionCache {
+	explicit DictionaryExpressionCache(const LogicalType &result_type);
+
+	//! The maximum size of a dictionary with an id for which we cache results
+	static constexpr idx_t MAX_DICTIONARY_SIZE_THRESHOLD = 20000;
+	//! Dictionaries without an id are only used if they are this factor smaller than the chunk
+	static constexpr idx_t DICTIONARY_THRESHOLD = 2;
+
+	//! The result type of the expression
+	LogicalType result_type;
+	//! The id of the cached dictionary (empty if the results are only valid for the current chunk)
+	string dictionary_id;
+	//! The size of the cached dictionary, found_entry is initialized for exactly this many entries
+	idx_t dictionary_size = 0;
+	//! The capacity of found_entry and result_index
+	idx_t capacity = 0;
+	//! Whether or not the result of a dictionary entry has been computed
+	unsafe_unique_array<bool> found_entry;
+	//! The index of the result of a dictionary entry in "results"
+	unsafe_unique_array<sel_t> result_index;
+	//! The computed results
+	unique_ptr<Vector> results;
+	idx_t result_count = 0;
+	//! The dictionary entries that are evaluated for the current chunk
+	SelectionVector unique_entries;
+	//! The arguments that are evaluated for the current chunk
+	DataChunk entry_arguments;
+
+public:
+	//! Evaluate the arguments per dictionary entry using the execute callback - returns the dictionary argument, or
+	//! nullptr if the arguments are not a single dictionary vector with constants
+	optional_ptr<Vector> Evaluate(DataChunk &arguments, const std::function<void(DataChunk &, Vector &)> &execute);
+	//! Fetch the results for the rows of the (evaluated) dictionary argument
+	void Slice(Vector &input, idx_t count, Vector &result);
+	//! Select the rows of the (evaluated) dictionary argument for which the (boolean) result is true
+	idx_t Select(Vector &input, const SelectionVector *sel, idx_t count, SelectionVector *true_sel,
+	             SelectionVector *false_sel);
+
+private:
+	bool Initialize(Vector &input, idx_t count);
+	void Reset();
+};
 
 struct ExpressionState {
 	ExpressionState(const Expression &expr, ExpressionExecutorState &root);
-	virtual ~ExpressionState() {
-	}
+	virtual ~ExpressionState();
 
 	const Expression &expr;
 	ExpressionExecutorState &root;
@@ -29,10 +79,16 @@ struct ExpressionState {
 	vector<LogicalType> types;
 	DataChunk intermediate_chunk;
 	vector<bool> initialize;
+	//! The fused kernel that evaluates this expression in a single loop (if any)
+	unique_ptr<FusedExpression> fused_expression;
+	//! Memoized results per dictionary entry (if the expression has a single non-foldable child)
+	unique_ptr<DictionaryExpressionCache> dictionary_cache;
 
 public:
 	void AddChild(Expression &child_expr);
 	void Finalize();
+	//! Initialize the dictionary cache (if the expression can be evaluated per dictionary entry)
+	void InitializeDictionaryCache(const LogicalType &result_type);
 	Allocator &GetAllocator();
 	bool HasContext();
 	DUCKDB_API ClientContext &GetContext();
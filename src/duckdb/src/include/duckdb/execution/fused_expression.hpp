@@ -0,0 +1,96 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/fused_expression.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/types/data_chunk.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/enums/expression_type.hpp"
+
+namespace duckdb {
+class Expression;
+
+enum class FusedArithmeticType : uint8_t { ADD, SUBTRACT, MULTIPLY };
+
+//! A leaf of a fused arithmetic chain: either a column of the input chunk or a constant
+struct FusedOperand {
+	//! The column index in the input chunk, or DConstants::INVALID_INDEX for a constant
+	idx_t column_index = DConstants::INVALID_INDEX;
+	//! The index of the column in the unified formats of the FusedExpression
+	idx_t format_index = DConstants::INVALID_INDEX;
+	//! The constant value (if column_index is INVALID_INDEX)
+	Value constant;
+	//! The arithmetic operation that combines the running result with this operand (unused for the first operand)
+	FusedArithmeticType op = FusedArithmeticType::ADD;
+	//! Whether the operand is the left-hand side of the operation (i.e. "operand - result" instead of "result - operand")
+	bool swapped = false;
+};
+
+//! A left-deep chain of numeric arithmetic: ((op_0 OP op_1) OP op_2) ...
+struct FusedArithmeticChain {
+	vector<FusedOperand> operands;
+};
+
+//! FusedExpression evaluates a chain of numeric +, - and * over columns and constants (optionally compared with
+//! another chain) into a single buffer, with one type- and operator-specialized loop per operation. The interpreted
+//! path materializes an intermediate vector (and resolves the children) for every function node instead. The same
+//! (overflow-checked) operators as the bound functions are used, so results and errors are identical to the
+//! interpreted path.
+class FusedExpression {
+public:
+	//! The maximum amount of operands in a single chain
+	static constexpr idx_t MAX_OPERANDS = 8;
+
+	FusedExpression(PhysicalType type, ExpressionType comparison, FusedArithmeticChain left,
+	                FusedArithmeticChain right);
+
+	//! The physical type the arithmetic is performed in
+	PhysicalType type;
+	//! The comparison between the left and the right chain - or INVALID if this is a single arithmetic chain (left)
+	ExpressionType comparison;
+	FusedArithmeticChain left;
+	FusedArithmeticChain right;
+
+public:
+	//! Try to fuse a (comparison over) an arithmetic expression; returns nullptr if the expression cannot be fused or
+	//! if there is no intermediate to save (e.g. a plain comparison between two columns)
+	static unique_ptr<FusedExpression> TryCreate(const Expression &expr);
+
+	//! Execute the fused expression for the (selected) rows of the input chunk into the result vector. Returns false if
+	//! the interpreted path should be used instead (e.g. because all inputs are constant vectors).
+	bool Execute(DataChunk &input, const SelectionVector *sel, idx_t count, Vector &result);
+	//! Select the (selected) rows of the input chunk for which the fused comparison is true. Returns false if the
+	//! interpreted path should be used instead.
+	bool Select(DataChunk &input, const SelectionVector *sel, idx_t count, SelectionVector *true_sel,
+	            SelectionVector *false_sel, idx_t &true_count);
+
+private:
+	//! Convert the columns referenced by the chains to the unified format; returns false if they are all constant
+	bool Prepare(DataChunk &input);
+
+	template <class T>
+	void EvaluateChains(const SelectionVector *sel, idx_t count);
+	template <class T>
+	void ExecuteTyped(const SelectionVector *sel, idx_t count, Vector &result);
+	template <class T>
+	idx_t SelectTyped(const SelectionVector *sel, idx_t count, SelectionVector *true_sel, SelectionVector *false_sel);
+
+private:
+	//! The unified format of every column of the input chunk that is referenced by an operand
+	vector<UnifiedVectorFormat> formats;
+	//! The referenced columns of the input chunk
+	vector<idx_t> columns;
+	//! The values of the left and right chain of a comparison
+	unsafe_unique_array<data_t> left_values;
+	unsafe_unique_array<data_t> right_values;
+	ValidityMask left_validity;
+	ValidityMask right_validity;
+};
+
+} // namespace duckdb
@@ -0,0 +1,159 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/index/hnsw/hnsw_index.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/random_engine.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/execution/index/bound_index.hpp"
+#include "duckdb/execution/index/fixed_size_allocator.hpp"
+
+namespace duckdb {
+
+enum class HNSWMetric : uint8_t { L2SQ = 0, COSINE = 1, INNER_PRODUCT = 2 };
+
+//! The build and search parameters of an HNSW index, set via CREATE INDEX ... USING HNSW (...) WITH (...).
+struct HNSWOptions {
+	//! The distance metric of the graph.
+	HNSWMetric metric = HNSWMetric::L2SQ;
+	//! The maximum number of links per node on the upper layers (twice as many on layer 0).
+	idx_t m = 16;
+	//! The size of the dynamic candidate list during construction.
+	idx_t ef_construction = 128;
+	//! The size of the dynamic candidate list during search.
+	idx_t ef_search = 64;
+
+	//! Parses and validates the index options, throwing a BinderException on invalid options.
+	static HNSWOptions Parse(const case_insensitive_map_t<Value> &options);
+	//! Returns the name of a metric as accepted by the 'metric' option.
+	static string MetricToString(HNSWMetric metric);
+};
+
+//! An approximate nearest-neighbor index over a FLOAT[n] column (Hierarchical Navigable Small World graph).
+//! The graph is kept in memory and (de)serialized as a whole through a FixedSizeAllocator of linked segments.
+class HNSWIndex : public BoundIndex {
+public:
+	//! Index type name for the HNSW index.
+	static constexpr const char *TYPE_NAME = "HNSW";
+	//! Segment size of the allocator holding the serialized graph.
+	static constexpr idx_t SEGMENT_SIZE = 4096;
+
+public:
+	HNSWIndex(const string &name, const IndexConstraintType index_constraint_type, const vector<column_t> &column_ids,
+	          TableIOManager &table_io_manager, const vector<unique_ptr<Expression>> &unbound_expressions,
+	          AttachedDatabase &db, const case_insensitive_map_t<Value> &options,
+	          const IndexStorageInfo &info = IndexStorageInfo());
+
+	//! Create a index instance of this type.
+	static unique_ptr<BoundIndex> Create(CreateIndexInput &input) {
+		auto index = make_uniq<HNSWIndex>(input.name, input.constraint_type, input.column_ids, input.table_io_manager,
+		                                  input.unbound_expressions, input.db, input.options, input.storage_info);
+		return std::move(index);
+	}
+
+	//! Plan index construction.
+	static unique_ptr<PhysicalOperator> CreatePlan(PlanIndexInput &input);
+
+	//! The build and search parameters.
+	HNSWOptions parameters;
+	//! The number of elements of the indexed arrays.
+	idx_t dimensions;
+
+public:
+	//! Fetches the row IDs of (approximately) the count nearest neighbors of the query.
+	void Search(const float *query, idx_t count, unsafe_vector<row_t> &row_ids);
+
+	//! Appends data to the locked index.
+	ErrorData Append(IndexLock &l, DataChunk &chunk, Vector &row_ids) override;
+	//! Insert a chunk.
+	ErrorData Insert(IndexLock &l, DataChunk &chunk, Vector &row_ids) override;
+
+	//! Delete a chunk from the HNSW index.
+	void Delete(IndexLock &lock, DataChunk &entries, Vector &row_ids) override;
+	//! Drop the HNSW index.
+	void CommitDrop(IndexLock &index_lock) override;
+
+	//! Merge another HNSW index into this index. Both must be locked.
+	bool MergeIndexes(IndexLock &state, BoundIndex &other_index) override;
+	//! Rebuilds the graph, if enough entries have been deleted.
+	void Vacuum(IndexLock &state) override;
+
+	//! Returns HNSW storage serialization information.
+	IndexStorageInfo GetStorageInfo(const case_insensitive_map_t<Value> &options, const bool to_wal) override;
+	//! Returns the in-memory usage of the HNSW index.
+	idx_t GetInMemorySize(IndexLock &index_lock) override;
+
+	//! Verifies the graph and optionally returns a string of the HNSW index.
+	string VerifyAndToString(IndexLock &state, const bool only_verify) override;
+	//! Verifies that the allocations match the serialized graph.
+	void VerifyAllocations(IndexLock &state) override;
+
+	string GetConstraintViolationMessage(VerifyExistenceType verify_type, idx_t failed_index,
+	                                     DataChunk &input) override;
+
+private:
+	//! Candidate (distance, node) pairs.
+	typedef std::pair<float, uint32_t> HNSWCandidate;
+
+	float Distance(const float *lhs, const float *rhs) const;
+	inline const float *GetVector(uint32_t node) const {
+		return vectors.data() + node * dimensions;
+	}
+	inline idx_t MaxLinks(idx_t level) const {
+		return level == 0 ? parameters.m * 2 : parameters.m;
+	}
+	uint32_t *GetLinks(uint32_t node, idx_t level);
+	idx_t RandomLevel();
+
+	void InsertVector(const float *vector, row_t row_id);
+	void SearchLayer(const float *query, uint32_t entry, idx_t ef, idx_t level, bool skip_deleted,
+	                 vector<HNSWCandidate> &result);
+	uint32_t GreedySearch(const float *query, uint32_t entry, idx_t from_level, idx_t to_level);
+	void SelectNeighbors(vector<HNSWCandidate> &candidates, idx_t max_count);
+	void Connect(uint32_t node, uint32_t neighbor, idx_t level);
+	void Clear();
+	void Rebuild();
+
+	void Serialize();
+	void Deserialize(IndexPointer root_pointer);
+
+private:
+	//! The vectors of all nodes, dimensions floats per node. Cosine vectors are stored normalized.
+	vector<float> vectors;
+	//! The row ID of each node.
+	vector<row_t> node_row_ids;
+	//! The top layer of each node.
+	vector<uint8_t> levels;
+	//! The deletion tombstone of each node.
+	vector<uint8_t> deleted;
+	//! The layer 0 links of all nodes: a count followed by up to 2 * m node IDs.
+	vector<uint32_t> base_links;
+	//! The upper layer links of each node: per layer, a count followed by up to m node IDs.
+	vector<vector<uint32_t>> upper_links;
+	//! Maps row IDs to their (latest) node.
+	unordered_map<row_t, uint32_t> node_map;
+	//! The number of deleted nodes.
+	idx_t deleted_count = 0;
+	//! The entry point of searches, and its layer.
+	uint32_t entry_point = 0;
+	idx_t max_level = 0;
+	//! Random number generator for the node layers.
+	RandomEngine random;
+	//! Visited markers of the current search.
+	vector<uint32_t> visited;
+	uint32_t visited_epoch = 0;
+
+	//! Holds the serialized graph.
+	unique_ptr<FixedSizeAllocator> allocator;
+	//! The first segment of the serialized graph.
+	IndexPointer root;
+	//! True, if the graph changed since its last serialization.
+	bool dirty = true;
+};
+
+} // namespace duckdb
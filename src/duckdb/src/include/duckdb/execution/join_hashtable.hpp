@@ -177,6 +177,8 @@ public:
 	void Merge(JoinHashTable &other);
 	//! Combines the partitions in sink_collection into data_collection, as if it were not partitioned
 	void Unpartition();
+	//! Re-creates the (still empty) sink_collection with the given number of radix bits
+	void InitializeSinkCollection(idx_t radix_bits);
 	//! Allocate the pointer table for the probe
 	void AllocatePointerTable();
 	//! Initialize the pointer table for the probe
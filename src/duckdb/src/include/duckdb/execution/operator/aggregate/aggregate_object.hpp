@@ -15,6 +15,7 @@ namespace duckdb {
 
 class BoundAggregateExpression;
 class BoundWindowExpression;
+class SpilledAggregateStates;
 
 struct FunctionDataWrapper {
 	explicit FunctionDataWrapper(unique_ptr<FunctionData> function_data_p) : function_data(std::move(function_data_p)) {
@@ -23,6 +24,15 @@ struct FunctionDataWrapper {
 	unique_ptr<FunctionData> function_data;
 };
 
+//! Refers to the serialized payload of a spilled aggregate state
+struct AggregateSpillSlot {
+	//! The spilled states holding the payload, or nullptr if the state was not spilled
+	SpilledAggregateStates *spilled_states;
+	//! The chunk of the spilled states holding the payload, and the row of the payload within that chunk
+	uint32_t chunk_index;
+	uint32_t row_index;
+};
+
 struct AggregateObject { // NOLINT: work-around bug in clang-tidy
 	AggregateObject(AggregateFunction function, FunctionData *bind_data, idx_t child_count, idx_t payload_size,
 	                AggregateType aggr_type, PhysicalType return_type, Expression *filter = nullptr);
@@ -40,6 +50,9 @@ struct AggregateObject { // NOLINT: work-around bug in clang-tidy
 	AggregateType aggr_type;
 	PhysicalType return_type;
 	Expression *filter = nullptr;
+	//! Whether the state can be spilled, in which case the payload ends with an AggregateSpillSlot at spill_offset
+	bool spillable = false;
+	idx_t spill_offset;
 
 public:
 	bool IsDistinct() const {
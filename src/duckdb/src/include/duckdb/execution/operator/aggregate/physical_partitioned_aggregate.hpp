@@ -18,7 +18,9 @@
 namespace duckdb {
 
 //! PhysicalPartitionedAggregate is an aggregate operator that can only perform aggregates on data that is partitioned
-// by the grouping columns
+// by (a subset of) the grouping columns. If the data is partitioned by all grouping columns, every partition is a
+// single group. Otherwise, every partition is aggregated in its own hash table, and partitions are finalized
+// independently of each other. Until then, the aggregated data of the partitions is unpinned, so it can be spilled.
 class PhysicalPartitionedAggregate : public PhysicalOperator {
 public:
 	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::PARTITIONED_AGGREGATE;
@@ -26,23 +28,43 @@ public:
 public:
 	PhysicalPartitionedAggregate(ClientContext &context, vector<LogicalType> types,
 	                             vector<unique_ptr<Expression>> expressions, vector<unique_ptr<Expression>> groups,
-	                             vector<column_t> partitions, idx_t estimated_cardinality);
+	                             vector<column_t> partitions, vector<idx_t> partition_groups,
+	                             idx_t estimated_cardinality);
 
 	//! The partitions over which this is grouped
 	vector<column_t> partitions;
+	//! The indexes of the groups that correspond to the partitions
+	vector<idx_t> partition_groups;
 	//! The groups over which the aggregate is partitioned - note that this is only
 	vector<unique_ptr<Expression>> groups;
 	//! The aggregates that have to be computed
 	vector<unique_ptr<Expression>> aggregates;
+	//! The group types of the per-partition hash tables (only used if the partitions are a subset of the groups)
+	vector<LogicalType> group_types;
+	//! The payload types of the per-partition hash tables
+	vector<LogicalType> payload_types;
+	//! The aggregate bindings of the per-partition hash tables
+	vector<BoundAggregateExpression *> bindings;
+
+public:
+	//! Whether or not every partition is a single group
+	bool SingleGroupPartitions() const {
+		return partition_groups.size() == groups.size();
+	}
 
 public:
 	// Source interface
 	SourceResultType GetData(ExecutionContext &context, DataChunk &chunk, OperatorSourceInput &input) const override;
 	unique_ptr<GlobalSourceState> GetGlobalSourceState(ClientContext &context) const override;
+	unique_ptr<LocalSourceState> GetLocalSourceState(ExecutionContext &context,
+	                                                 GlobalSourceState &gstate) const override;
 
 	bool IsSource() const override {
 		return true;
 	}
+	bool ParallelSource() const override {
+		return true;
+	}
 
 public:
 	// Sink interface
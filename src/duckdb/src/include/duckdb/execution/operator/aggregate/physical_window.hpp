@@ -14,7 +14,8 @@
 namespace duckdb {
 
 //! PhysicalWindow implements window functions
-//! It assumes that all functions have a common partitioning and ordering
+//! It assumes that all functions have a common partitioning and ordering,
+//! except for partition-wide aggregates, which may use a coarser partitioning
 class PhysicalWindow : public PhysicalOperator {
 public:
 	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::WINDOW;
@@ -27,6 +28,8 @@ public:
 	vector<unique_ptr<Expression>> select_list;
 	//! The window expression with the order clause
 	idx_t order_idx;
+	//! The window expression with the coarsest partition clause (the hash partitioning)
+	idx_t partition_idx;
 	//! Whether or not the window is order dependent (only true if ANY window function contains neither an order nor a
 	//! partition clause)
 	bool is_order_dependent;
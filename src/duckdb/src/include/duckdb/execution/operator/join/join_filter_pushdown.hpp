@@ -13,6 +13,7 @@
 #include "duckdb/planner/table_filter.hpp"
 
 namespace duckdb {
+struct BloomFilterData;
 class DataChunk;
 class DynamicTableFilterSet;
 class LogicalGet;
@@ -56,6 +57,9 @@ struct PushdownFilterTarget {
 };
 
 struct JoinFilterPushdownInfo {
+	//! The maximum build side size for which we push a bloom filter into the probe side
+	static constexpr const idx_t MAX_BLOOM_FILTER_COUNT = 1048576;
+
 	//! The join condition indexes for which we compute the min/max aggregates
 	vector<idx_t> join_condition;
 	//! The probes to push the filter into
@@ -75,6 +79,7 @@ public:
 private:
 	void PushInFilter(const JoinFilterPushdownFilter &info, JoinHashTable &ht, const PhysicalOperator &op,
 	                  idx_t filter_idx, idx_t filter_col_idx) const;
+	shared_ptr<BloomFilterData> CreateBloomFilter(JoinHashTable &ht, idx_t filter_idx) const;
 };
 
 } // namespace duckdb
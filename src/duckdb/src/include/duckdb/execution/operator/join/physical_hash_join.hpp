@@ -14,6 +14,7 @@
 #include "duckdb/execution/operator/join/physical_comparison_join.hpp"
 #include "duckdb/execution/physical_operator.hpp"
 #include "duckdb/planner/operator/logical_join.hpp"
+#include "duckdb/storage/temporary_memory_manager.hpp"
 
 namespace duckdb {
 
@@ -53,6 +54,10 @@ public:
 
 	//! Join Keys statistics (optional)
 	vector<unique_ptr<BaseStatistics>> join_stats;
+	//! Identifies the build side relation for cardinality feedback (empty if no feedback should be recorded)
+	string cardinality_feedback_key;
+	//! The table scanned by the build side relation
+	string cardinality_feedback_table;
 
 public:
 	InsertionOrderPreservingMap<string> ParamsToString() const override;
@@ -104,6 +109,56 @@ public:
 	bool ParallelSink() const override {
 		return true;
 	}
+
+private:
+	//! Report the actual build side cardinality to the CardinalityFeedback if it diverges from the estimate
+	void RecordCardinalityFeedback(ClientContext &context, GlobalSinkState &global_state) const;
+};
+
+//! The global sink state of a PhysicalHashJoin (also the base of the state of joins that can fall back to it)
+class HashJoinGlobalSinkState : public GlobalSinkState {
+public:
+	HashJoinGlobalSinkState(const PhysicalHashJoin &op_p, ClientContext &context_p);
+
+	void ScheduleFinalize(Pipeline &pipeline, Event &event);
+	void InitializeProbeSpill();
+
+public:
+	ClientContext &context;
+	const PhysicalHashJoin &op;
+
+	const idx_t num_threads;
+	//! Temporary memory state for managing this operator's memory usage
+	unique_ptr<TemporaryMemoryState> temporary_memory_state;
+
+	//! Global HT used by the join
+	unique_ptr<JoinHashTable> hash_table;
+	//! The perfect hash join executor (if any)
+	unique_ptr<PerfectHashJoinExecutor> perfect_join_executor;
+	//! Whether or not the hash table has been finalized
+	bool finalized;
+	//! The number of active local states
+	atomic<idx_t> active_local_states;
+
+	//! Whether we are doing an external + some sizes
+	bool external;
+	idx_t total_size;
+	idx_t max_partition_size;
+	idx_t max_partition_count;
+	idx_t probe_side_requirement;
+
+	//! Hash tables built by each thread
+	vector<unique_ptr<JoinHashTable>> local_hash_tables;
+
+	//! Excess probe data gathered during Sink
+	vector<LogicalType> probe_types;
+	unique_ptr<JoinHashTable::ProbeSpill> probe_spill;
+
+	//! Whether or not we have started scanning data using GetData
+	atomic<bool> scanned_data;
+
+	bool skip_filter_pushdown = false;
+	unique_ptr<JoinFilterGlobalState> global_filter_state;
 };
 
 } // namespace duckdb
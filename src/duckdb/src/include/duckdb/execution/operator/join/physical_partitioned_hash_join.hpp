@@ -0,0 +1,53 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/join/physical_partitioned_hash_join.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/operator/join/physical_hash_join.hpp"
+
+namespace duckdb {
+
+//! PhysicalPartitionedHashJoin is an inner hash join over inputs that are both partitioned by the same join key (e.g.
+//! two hive-partitioned datasets joined on their partition column). Every value of the partition key gets its own
+//! hash table, which is finalized and probed independently - no global hash table is built. The partitions are not
+//! spilled: all hash tables stay in memory (and are reserved as such) until the probe is done. If the reservation
+//! cannot be granted, the partitions are merged into the global hash table of the PhysicalHashJoin, which spills.
+class PhysicalPartitionedHashJoin : public PhysicalHashJoin {
+public:
+	PhysicalPartitionedHashJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> left,
+	                            unique_ptr<PhysicalOperator> right, vector<JoinCondition> cond,
+	                            const vector<idx_t> &left_projection_map, const vector<idx_t> &right_projection_map,
+	                            idx_t partition_condition, idx_t estimated_cardinality);
+
+	//! The index of the join condition by which both sides are partitioned
+	idx_t partition_condition;
+
+public:
+	InsertionOrderPreservingMap<string> ParamsToString() const override;
+
+public:
+	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
+
+protected:
+	OperatorResultType ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+	                                   GlobalOperatorState &gstate, OperatorState &state) const override;
+
+	//! Releases the hash tables of the partitions, or scans the spilled partitions of the fallback hash join
+	SourceResultType GetData(ExecutionContext &context, DataChunk &chunk, OperatorSourceInput &input) const override;
+
+public:
+	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
+	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
+	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
+	void PrepareFinalize(ClientContext &context, GlobalSinkState &global_state) const override;
+	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+	                          OperatorSinkFinalizeInput &input) const override;
+};
+
+} // namespace duckdb
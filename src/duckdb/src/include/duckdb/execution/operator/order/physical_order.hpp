@@ -28,6 +28,9 @@ public:
 	//! Input data
 	vector<BoundOrderByNode> orders;
 	vector<idx_t> projections;
+	//! Whether the input is read from row groups that are each sorted on the first key - if so, the sort detects the
+	//! pre-sorted runs in its input and merges them instead of sorting them
+	bool sorted_runs = false;
 
 public:
 	// Source interface
@@ -13,6 +13,7 @@
 
 namespace duckdb {
 struct DynamicFilterData;
+struct DynamicFilterColumnRange;
 
 //! Represents a physical ordering of the data. Note that this will not change
 //! the data but only add a selection vector.
@@ -22,7 +23,8 @@ public:
 
 public:
 	PhysicalTopN(vector<LogicalType> types, vector<BoundOrderByNode> orders, idx_t limit, idx_t offset,
-	             shared_ptr<DynamicFilterData> dynamic_filter, idx_t estimated_cardinality);
+	             shared_ptr<DynamicFilterData> dynamic_filter, unique_ptr<DynamicFilterColumnRange> dynamic_filter_range,
+	             idx_t estimated_cardinality);
 	~PhysicalTopN() override;
 
 	vector<BoundOrderByNode> orders;
@@ -30,6 +32,10 @@ public:
 	idx_t offset;
 	//! Dynamic table filter (if any)
 	shared_ptr<DynamicFilterData> dynamic_filter;
+	//! The range of the filtered column, if the first ORDER BY expression is a monotonic function of it (if any)
+	unique_ptr<DynamicFilterColumnRange> dynamic_filter_range;
+	//! The first ORDER BY expression, evaluated over the filtered column (if dynamic_filter_range is set)
+	unique_ptr<Expression> dynamic_filter_expression;
 
 public:
 	// Source interface
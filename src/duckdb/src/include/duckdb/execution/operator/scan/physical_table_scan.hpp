@@ -74,6 +74,10 @@ public:
 	bool SupportsPartitioning(const OperatorPartitionInfo &partition_info) const override;
 
 	ProgressData GetProgress(ClientContext &context, GlobalSourceState &gstate) const override;
+
+private:
+	//! Renders a set of filters on the columns of the scan
+	string FiltersToString(const TableFilterSet &filters) const;
 };
 
 } // namespace duckdb
@@ -44,6 +44,9 @@ public:
 	static bool UseBatchIndex(ClientContext &context, PhysicalOperator &plan);
 	//! Whether or not we should preserve insertion order for executing the given sink
 	static bool PreserveInsertionOrder(ClientContext &context, PhysicalOperator &plan);
+	//! Whether or not the given output columns of the plan originate from a table scan that emits single-value
+	//! partitions over them (e.g. hive partitions). On success, the columns are replaced by the base column ids.
+	static bool HasSingleValuePartitions(ClientContext &context, PhysicalOperator &plan, vector<column_t> &columns);
 
 protected:
 	unique_ptr<PhysicalOperator> CreatePlan(LogicalOperator &op);
@@ -56,6 +56,8 @@ public:
 	const TupleDataLayout &GetLayout() const;
 	idx_t MaxThreads(GlobalSinkState &sink) const;
 	static void SetMultiScan(GlobalSinkState &sink);
+	//! The number of rows whose aggregate states were spilled during the Sink (only known after the Finalize)
+	static idx_t SpilledStateCount(GlobalSinkState &sink);
 
 private:
 	void SetGroupingValues();
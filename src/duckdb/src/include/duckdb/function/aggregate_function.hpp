@@ -84,6 +84,13 @@ typedef void (*aggregate_window_t)(AggregateInputData &aggr_input_data, const Wi
 typedef void (*aggregate_wininit_t)(AggregateInputData &aggr_input_data, const WindowPartitionInput &partition,
                                     data_ptr_t g_state);
 
+//! The type used for serializing the payloads of hashed aggregate states into BLOBs, so they can be spilled (optional)
+typedef void (*aggregate_state_serialize_t)(Vector &states, AggregateInputData &aggr_input_data, Vector &result,
+                                            idx_t count);
+//! The type used for restoring serialized payloads into initialized hashed aggregate states (optional)
+typedef void (*aggregate_state_deserialize_t)(Vector &serialized, AggregateInputData &aggr_input_data, Vector &states,
+                                              idx_t count);
+
 typedef void (*aggregate_serialize_t)(Serializer &serializer, const optional_ptr<FunctionData> bind_data,
                                       const AggregateFunction &function);
 typedef unique_ptr<FunctionData> (*aggregate_deserialize_t)(Deserializer &deserializer, AggregateFunction &function);
@@ -191,6 +198,11 @@ public:
 	//! The statistics propagation function (may be null)
 	aggregate_statistics_t statistics;
 
+	//! The state serialization functions (may be null). Hash tables that go out-of-core serialize the states
+	//! they will no longer update, release their payloads, and restore them before combining.
+	aggregate_state_serialize_t state_serialize = nullptr;
+	aggregate_state_deserialize_t state_deserialize = nullptr;
+
 	aggregate_serialize_t serialize;
 	aggregate_deserialize_t deserialize;
 	//! Whether or not the aggregate is order dependent
@@ -331,6 +343,29 @@ public:
 	static void StateDestroy(Vector &states, AggregateInputData &aggr_input_data, idx_t count) {
 		AggregateExecutor::Destroy<STATE, OP>(states, aggr_input_data, count);
 	}
+
+	template <class STATE, class OP>
+	static void StateSerialize(Vector &states, AggregateInputData &aggr_input_data, Vector &result, idx_t count) {
+		SerializeStates(states, result, count, [&](data_ptr_t state, Serializer &serializer) {
+			OP::template SerializeState<STATE>(*reinterpret_cast<STATE *>(state), serializer, aggr_input_data);
+		});
+	}
+
+	template <class STATE, class OP>
+	static void StateDeserialize(Vector &serialized, AggregateInputData &aggr_input_data, Vector &states,
+	                             idx_t count) {
+		DeserializeStates(serialized, states, count, [&](data_ptr_t state, Deserializer &deserializer) {
+			OP::template DeserializeState<STATE>(*reinterpret_cast<STATE *>(state), deserializer, aggr_input_data);
+		});
+	}
+
+private:
+	//! Serializes every state into a BLOB of the result, using the callback to write the payload of the state
+	DUCKDB_API static void SerializeStates(Vector &states, Vector &result, idx_t count,
+	                                       const std::function<void(data_ptr_t, Serializer &)> &serialize_state);
+	//! Restores every state from a BLOB, using the callback to read the payload of the state
+	DUCKDB_API static void DeserializeStates(Vector &serialized, Vector &states, idx_t count,
+	                                         const std::function<void(data_ptr_t, Deserializer &)> &deserialize_state);
 };
 
 } // namespace duckdb
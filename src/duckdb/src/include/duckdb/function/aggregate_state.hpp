@@ -32,6 +32,9 @@ struct AggregateInputData {
 	optional_ptr<FunctionData> bind_data;
 	ArenaAllocator &allocator;
 	AggregateCombineType combine_type;
+	//! Whether the states belong to a hash table that can spill them. Their payloads may then be allocated from the
+	//! arena, which the hash table resets after spilling, instead of being owned (and destroyed) by the states
+	bool spillable = false;
 };
 
 struct AggregateUnaryInput {
@@ -40,6 +40,15 @@ public:
 	static unique_ptr<FunctionData> Deserialize(Deserializer &deserializer, ScalarFunction &);
 };
 
+//! ListLambdaLocalState keeps the expression executor of the lambda expression alive across the chunks of a thread
+struct ListLambdaLocalState : public FunctionLocalState {
+	ListLambdaLocalState(ClientContext &context, const Expression &lambda_expr) : expr_executor(context, lambda_expr) {
+	}
+
+	//! The expression executor that executes the lambda expression
+	ExpressionExecutor expr_executor;
+};
+
 class LambdaFunctions {
 public:
 	//! Returns the parameter type for binary lambdas
@@ -56,6 +65,11 @@ public:
 	                                               vector<unique_ptr<Expression>> &arguments,
 	                                               const bool has_index = false);
 
+	//! Initializes the thread-local expression executor of the lambda expression
+	static unique_ptr<FunctionLocalState> ListLambdaInitLocalState(ExpressionState &state,
+	                                                               const BoundFunctionExpression &expr,
+	                                                               FunctionData *bind_data);
+
 	//! Internally executes list_transform
 	static void ListTransformFunction(DataChunk &args, ExpressionState &state, Vector &result);
 	//! Internally executes list_filter
@@ -108,6 +122,15 @@ public:
 
 			// get the lambda column data for all other input vectors
 			column_infos = LambdaFunctions::GetColumnInfo(args, row_count);
+
+			// get the expression executor, which we only have to create if there is no local state
+			auto local_state = ExecuteFunctionState::GetFunctionState(state);
+			if (local_state) {
+				expr_executor = &local_state->Cast<ListLambdaLocalState>().expr_executor;
+			} else {
+				owned_expr_executor = make_uniq<ExpressionExecutor>(state.GetContext(), *lambda_expr);
+				expr_executor = owned_expr_executor.get();
+			}
 		};
 
 		const list_entry_t *list_entries;
@@ -117,6 +140,8 @@ public:
 		optional_ptr<ValidityMask> result_validity;
 		vector<ColumnInfo> column_infos;
 		optional_ptr<Expression> lambda_expr;
+		optional_ptr<ExpressionExecutor> expr_executor;
+		unique_ptr<ExpressionExecutor> owned_expr_executor;
 
 		const idx_t row_count;
 		bool has_index;
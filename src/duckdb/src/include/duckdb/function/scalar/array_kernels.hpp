@@ -0,0 +1,142 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/function/scalar/array_kernels.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+#include "duckdb/common/typedefs.hpp"
+#include "duckdb/common/algorithm.hpp"
+#include <cmath>
+
+namespace duckdb {
+
+//-------------------------------------------------------------------------
+// Folding Operations
+//-------------------------------------------------------------------------
+// The kernels accumulate into ARRAY_KERNEL_LANES independent partial sums. This breaks the dependency between
+// consecutive additions, so the compiler can keep the loops in SIMD registers without reordering floating point
+// operations on its own (i.e. without -ffast-math), and without any architecture specific code.
+static constexpr idx_t ARRAY_KERNEL_LANES = 8;
+
+template <class TYPE>
+static inline TYPE SumLanes(const TYPE *lanes) {
+	TYPE result = 0;
+	for (idx_t lane = 0; lane < ARRAY_KERNEL_LANES; lane++) {
+		result += lanes[lane];
+	}
+	return result;
+}
+
+struct InnerProductOp {
+	static constexpr bool ALLOW_EMPTY = true;
+
+	template <class TYPE>
+	static TYPE Operation(const TYPE *lhs_data, const TYPE *rhs_data, const idx_t count) {
+		TYPE lanes[ARRAY_KERNEL_LANES] = {};
+
+		idx_t i = 0;
+		for (; i + ARRAY_KERNEL_LANES <= count; i += ARRAY_KERNEL_LANES) {
+			for (idx_t lane = 0; lane < ARRAY_KERNEL_LANES; lane++) {
+				lanes[lane] += lhs_data[i + lane] * rhs_data[i + lane];
+			}
+		}
+
+		TYPE result = SumLanes(lanes);
+		for (; i < count; i++) {
+			result += lhs_data[i] * rhs_data[i];
+		}
+		return result;
+	}
+};
+
+struct NegativeInnerProductOp {
+	static constexpr bool ALLOW_EMPTY = true;
+
+	template <class TYPE>
+	static TYPE Operation(const TYPE *lhs_data, const TYPE *rhs_data, const idx_t count) {
+		return -InnerProductOp::Operation(lhs_data, rhs_data, count);
+	}
+};
+
+struct CosineSimilarityOp {
+	static constexpr bool ALLOW_EMPTY = false;
+
+	template <class TYPE>
+	static TYPE Operation(const TYPE *lhs_data, const TYPE *rhs_data, const idx_t count) {
+		TYPE distance_lanes[ARRAY_KERNEL_LANES] = {};
+		TYPE norm_l_lanes[ARRAY_KERNEL_LANES] = {};
+		TYPE norm_r_lanes[ARRAY_KERNEL_LANES] = {};
+
+		idx_t i = 0;
+		for (; i + ARRAY_KERNEL_LANES <= count; i += ARRAY_KERNEL_LANES) {
+			for (idx_t lane = 0; lane < ARRAY_KERNEL_LANES; lane++) {
+				const auto x = lhs_data[i + lane];
+				const auto y = rhs_data[i + lane];
+				distance_lanes[lane] += x * y;
+				norm_l_lanes[lane] += x * x;
+				norm_r_lanes[lane] += y * y;
+			}
+		}
+
+		TYPE distance = SumLanes(distance_lanes);
+		TYPE norm_l = SumLanes(norm_l_lanes);
+		TYPE norm_r = SumLanes(norm_r_lanes);
+		for (; i < count; i++) {
+			const auto x = lhs_data[i];
+			const auto y = rhs_data[i];
+			distance += x * y;
+			norm_l += x * x;
+			norm_r += y * y;
+		}
+
+		auto similarity = distance / std::sqrt(norm_l * norm_r);
+		return std::max(static_cast<TYPE>(-1.0), std::min(similarity, static_cast<TYPE>(1.0)));
+	}
+};
+
+struct CosineDistanceOp {
+	static constexpr bool ALLOW_EMPTY = false;
+
+	template <class TYPE>
+	static TYPE Operation(const TYPE *lhs_data, const TYPE *rhs_data, const idx_t count) {
+		return static_cast<TYPE>(1.0) - CosineSimilarityOp::Operation(lhs_data, rhs_data, count);
+	}
+};
+
+struct DistanceSquaredOp {
+	static constexpr bool ALLOW_EMPTY = true;
+
+	template <class TYPE>
+	static TYPE Operation(const TYPE *lhs_data, const TYPE *rhs_data, const idx_t count) {
+		TYPE lanes[ARRAY_KERNEL_LANES] = {};
+
+		idx_t i = 0;
+		for (; i + ARRAY_KERNEL_LANES <= count; i += ARRAY_KERNEL_LANES) {
+			for (idx_t lane = 0; lane < ARRAY_KERNEL_LANES; lane++) {
+				const auto diff = lhs_data[i + lane] - rhs_data[i + lane];
+				lanes[lane] += diff * diff;
+			}
+		}
+
+		TYPE distance = SumLanes(lanes);
+		for (; i < count; i++) {
+			const auto diff = lhs_data[i] - rhs_data[i];
+			distance += diff * diff;
+		}
+		return distance;
+	}
+};
+
+struct DistanceOp {
+	static constexpr bool ALLOW_EMPTY = true;
+
+	template <class TYPE>
+	static TYPE Operation(const TYPE *lhs_data, const TYPE *rhs_data, const idx_t count) {
+		return std::sqrt(DistanceSquaredOp::Operation(lhs_data, rhs_data, count));
+	}
+};
+
+} // namespace duckdb
@@ -8,8 +8,11 @@
 
 #pragma once
 
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/unordered_map.hpp"
 #include "duckdb/function/function_set.hpp"
 #include "re2/re2.h"
+#include "re2/filtered_re2.h"
 #include "duckdb/function/built_in_functions.hpp"
 #include "re2/stringpiece.h"
 
@@ -136,10 +139,74 @@ public:
 	duckdb_re2::StringPiece *group_buffer;
 };
 
+//! A compiled pattern, optionally with a literal prefilter extracted by FilteredRE2: inputs that do not contain the
+//! literals required by the pattern are rejected without running RE2
+class PrefilteredRegex {
+public:
+	PrefilteredRegex(const duckdb_re2::StringPiece &pattern, const duckdb_re2::RE2::Options &options,
+	                 bool build_prefilter);
+
+	//! Atoms shorter than this are not worth searching for
+	static constexpr int MIN_ATOM_LENGTH = 3;
+
+public:
+	const RE2 &GetPattern() const {
+		return filter ? filter->GetRE2(0) : *pattern;
+	}
+	bool HasPrefilter() const {
+		return !atoms.empty();
+	}
+	//! Returns false if "input" cannot match the pattern
+	bool MayMatch(const string_t &input);
+
+private:
+	//! Owns the compiled pattern if the prefilter was built
+	unique_ptr<duckdb_re2::FilteredRE2> filter;
+	//! The compiled pattern otherwise
+	unique_ptr<RE2> pattern;
+	//! The lower-case literals the prefilter searches for
+	vector<string> atoms;
+	vector<int> matched_atoms;
+	vector<int> potentials;
+	//! Buffer for the lower-cased input
+	string lowered;
+};
+
+//! LRU cache of compiled patterns, so that non-constant patterns are not compiled again for every row
+class RegexPatternCache {
+public:
+	RegexPatternCache(const duckdb_re2::RE2::Options &options, bool build_prefilter);
+
+	//! The maximum number of compiled patterns that are kept
+	static constexpr idx_t MAX_PATTERNS = 64;
+
+public:
+	PrefilteredRegex &GetPattern(const string_t &pattern);
+
+private:
+	using cache_entry_t = pair<string, unique_ptr<PrefilteredRegex>>;
+
+	duckdb_re2::RE2::Options options;
+	bool build_prefilter;
+	//! The most recently used pattern is in front
+	list<cache_entry_t> patterns;
+	unordered_map<string, list<cache_entry_t>::iterator> lookup;
+};
+
+//! Local state of the regex functions when the pattern is not constant
+struct RegexCacheLocalState : public FunctionLocalState {
+	RegexCacheLocalState(const RegexpBaseBindData &info, bool build_prefilter)
+	    : cache(info.options, build_prefilter) {
+	}
+
+	RegexPatternCache cache;
+};
+
 struct RegexLocalState : public FunctionLocalState {
-	explicit RegexLocalState(RegexpBaseBindData &info, bool extract_all = false)
-	    : constant_pattern(duckdb_re2::StringPiece(info.constant_string.c_str(), info.constant_string.size()),
-	                       info.options) {
+	explicit RegexLocalState(RegexpBaseBindData &info, bool extract_all = false, bool build_prefilter = false)
+	    : compiled(duckdb_re2::StringPiece(info.constant_string.c_str(), info.constant_string.size()), info.options,
+	               build_prefilter),
+	      constant_pattern(compiled.GetPattern()) {
 		if (extract_all) {
 			auto group_count_p = constant_pattern.NumberOfCapturingGroups();
 			if (group_count_p != -1) {
@@ -149,7 +216,10 @@ struct RegexLocalState : public FunctionLocalState {
 		D_ASSERT(info.constant_pattern);
 	}
 
-	RE2 constant_pattern;
+	//! The compiled constant pattern, with its literal prefilter if requested (regexp_matches only)
+	PrefilteredRegex compiled;
+	//! The pattern owned by "compiled"
+	const RE2 &constant_pattern;
 	//! Used by regexp_extract_all to pre-allocate the args
 	RegexStringPieceArgs group_buffer;
 };
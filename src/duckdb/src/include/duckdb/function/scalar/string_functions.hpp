@@ -132,6 +132,15 @@ struct ContainsFun {
 	static ScalarFunctionSet GetFunctions();
 };
 
+struct InternalContainsAnyFun {
+	static constexpr const char *Name = "__internal_contains_any";
+	static constexpr const char *Parameters = "";
+	static constexpr const char *Description = "";
+	static constexpr const char *Example = "";
+
+	static ScalarFunction GetFunction();
+};
+
 struct StripAccentsFun {
 	static constexpr const char *Name = "strip_accents";
 	static constexpr const char *Parameters = "string";
@@ -55,6 +55,10 @@ struct DuckDBConstraintsFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+struct DuckDBQueryResultCacheFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 struct DuckDBSecretsFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
@@ -16,6 +16,16 @@ namespace duckdb {
 class DuckTableEntry;
 class TableCatalogEntry;
 
+//! A nearest-neighbor search through an HNSW index, replacing the sequential scan below a matching TopN.
+struct HNSWIndexScanInfo {
+	//! The name of the index to search.
+	string index_name;
+	//! The query vector.
+	vector<float> query;
+	//! The number of nearest neighbors to fetch. If fewer of them are visible, the scan falls back to a full scan.
+	idx_t limit;
+};
+
 struct TableScanBindData : public TableFunctionData {
 	explicit TableScanBindData(TableCatalogEntry &table) : table(table), is_index_scan(false), is_create_index(false) {
 	}
@@ -28,6 +38,9 @@ struct TableScanBindData : public TableFunctionData {
 	bool is_index_scan;
 	//! Whether or not the table scan is for index creation.
 	bool is_create_index;
+	//! If set, only the rows returned by this nearest-neighbor search are scanned.
+	//! This is not serialized: a deserialized plan falls back to a sequential scan, which is still correct.
+	unique_ptr<HNSWIndexScanInfo> hnsw_scan;
 
 public:
 	bool Equals(const FunctionData &other_p) const override {
@@ -39,6 +52,9 @@ public:
 		bind_data->is_index_scan = is_index_scan;
 		bind_data->is_create_index = is_create_index;
 		bind_data->column_ids = column_ids;
+		if (hnsw_scan) {
+			bind_data->hnsw_scan = make_uniq<HNSWIndexScanInfo>(*hnsw_scan);
+		}
 		return std::move(bind_data);
 	}
 };
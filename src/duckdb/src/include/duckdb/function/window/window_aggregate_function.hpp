@@ -28,6 +28,12 @@ public:
 	                                                     const ValidityMask &order_mask) const override;
 	unique_ptr<WindowExecutorLocalState> GetLocalState(const WindowExecutorGlobalState &gstate) const override;
 
+	bool CanShareGlobalState(const WindowExecutor &other) const override;
+	unique_ptr<WindowExecutorGlobalState> GetSharedGlobalState(const idx_t payload_count,
+	                                                           const ValidityMask &partition_mask,
+	                                                           const ValidityMask &order_mask,
+	                                                           WindowExecutorGlobalState &shared) const override;
+
 	const WindowAggregationMode mode;
 
 	// aggregate computation algorithm
@@ -113,6 +113,8 @@ public:
 	virtual unique_ptr<WindowAggregatorState> GetGlobalState(ClientContext &context, idx_t group_count,
 	                                                         const ValidityMask &partition_mask) const;
 	virtual unique_ptr<WindowAggregatorState> GetLocalState(const WindowAggregatorState &gstate) const = 0;
+	//! Whether the global state only depends on the aggregate inputs (so it can be shared between frames)
+	virtual bool IsFrameIndependent() const;
 
 	//	Build
 	virtual void Sink(WindowAggregatorState &gstate, WindowAggregatorState &lstate, DataChunk &sink_chunk,
@@ -89,10 +89,24 @@ public:
 	virtual ~WindowExecutor() {
 	}
 
+	template <class TARGET>
+	const TARGET &Cast() const {
+		DynamicCastCheck<TARGET>(this);
+		return reinterpret_cast<const TARGET &>(*this);
+	}
+
 	virtual unique_ptr<WindowExecutorGlobalState>
 	GetGlobalState(const idx_t payload_count, const ValidityMask &partition_mask, const ValidityMask &order_mask) const;
 	virtual unique_ptr<WindowExecutorLocalState> GetLocalState(const WindowExecutorGlobalState &gstate) const;
 
+	//! Can this executor evaluate using the data built by the global state of another executor?
+	virtual bool CanShareGlobalState(const WindowExecutor &other) const;
+	//! Create a global state that reuses the data built by the global state of another executor
+	virtual unique_ptr<WindowExecutorGlobalState> GetSharedGlobalState(const idx_t payload_count,
+	                                                                   const ValidityMask &partition_mask,
+	                                                                   const ValidityMask &order_mask,
+	                                                                   WindowExecutorGlobalState &shared) const;
+
 	virtual void Sink(DataChunk &sink_chunk, DataChunk &coll_chunk, const idx_t input_idx,
 	                  WindowExecutorGlobalState &gstate, WindowExecutorLocalState &lstate) const;
 
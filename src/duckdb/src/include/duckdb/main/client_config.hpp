@@ -101,6 +101,9 @@ struct ClientConfig {
 	idx_t nested_loop_join_threshold = 5;
 	//! The number of rows we need on either table to choose a merge join over an IE join
 	idx_t merge_join_threshold = 1000;
+	//! The factor by which the observed build side cardinality of a hash join needs to diverge from the estimate before
+	//! it is fed back into the join order optimizer (0 = disabled)
+	double cardinality_feedback_threshold = 0;
 
 	//! The maximum amount of memory to keep buffered in a streaming query result. Default: 1mb.
 	idx_t streaming_buffer_size = 1000000;
@@ -127,6 +130,10 @@ struct ClientConfig {
 	bool integer_division = false;
 	//! When a scalar subquery returns multiple rows - return a random row instead of returning an error
 	bool scalar_subquery_error_on_multiple_rows = true;
+	//! Evaluate chains of numeric arithmetic and comparisons with fused kernels
+	bool enable_fused_expressions = false;
+	//! Compute mode and quantiles with bounded-size sketches instead of exactly
+	bool approximate_holistic_aggregates = false;
 	//! Use IEE754-compliant floating point operations (returning NAN instead of errors/NULL)
 	bool ieee_floating_point_ops = true;
 	//! Allow ordering by non-integer literals - ordering by such literals has no effect
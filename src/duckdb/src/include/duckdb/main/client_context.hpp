@@ -249,6 +249,10 @@ private:
 	                                                                shared_ptr<PreparedStatementData> statement_p,
 	                                                                const PendingQueryParameters &parameters);
 	void CheckIfPreparedStatementIsExecutable(PreparedStatementData &statement);
+	//! Serve the statement from the query result cache if possible - returns a statement that scans the cached result
+	//! on a cache hit, or the original statement otherwise
+	shared_ptr<PreparedStatementData> CheckQueryResultCache(ClientContextLock &lock,
+	                                                        shared_ptr<PreparedStatementData> statement);
 
 	//! Internally prepare a SQL statement. Caller must hold the context_lock.
 	shared_ptr<PreparedStatementData>
@@ -239,6 +239,10 @@ struct DBConfigOptions {
 	bool enable_view_dependencies = false;
 	//! Enable macros to create dependencies
 	bool enable_macro_dependencies = false;
+	//! Whether or not the results of read-only queries are cached
+	bool enable_query_result_cache = false;
+	//! The maximum amount of memory used by the query result cache (default: 64MB)
+	idx_t query_result_cache_max_memory = 67108864ULL;
 	//! Start transactions immediately in all attached databases - instead of lazily when a database is referenced
 	bool immediate_transaction_mode = false;
 	//! Debug setting - how to initialize  blocks in the storage layer when allocating
@@ -21,6 +21,7 @@ class CatalogEntry;
 class ClientContext;
 class PhysicalOperator;
 class SQLStatement;
+struct QueryResultCacheInfo;
 
 class PreparedStatementData {
 public:
@@ -45,6 +46,10 @@ public:
 	bound_parameter_map_t value_map;
 	//! Whether we are creating a streaming result or not
 	bool is_streaming = false;
+	//! Information required to cache the result of this statement (if it can be cached)
+	unique_ptr<QueryResultCacheInfo> result_cache_info;
+	//! The version of the cardinality feedback of every table scanned by this statement when it was planned
+	unordered_map<string, idx_t> cardinality_feedback_versions;
 
 public:
 	void CheckParameterCount(idx_t parameter_count);
@@ -203,6 +203,10 @@ private:
 	using PhaseTimingItem = PhaseTimingStorage::value_type;
 	//! The stack of currently active phases
 	vector<MetricsType> phase_stack;
+	//! The plan node count at the start of each of the currently active phases
+	vector<idx_t> phase_plan_node_stack;
+	//! A mapping of the phase names to the number of plan nodes they created (see PlanNodeCounter)
+	unordered_map<MetricsType, idx_t, MetricsTypeHashFunction> phase_plan_nodes;
 
 private:
 	void MoveOptimizerPhasesToRoot();
@@ -0,0 +1,110 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/query_result_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/planner/bound_parameter_map.hpp"
+
+namespace duckdb {
+class ClientContext;
+class ColumnDataCollection;
+class DatabaseInstance;
+class LogicalOperator;
+struct DataTableInfo;
+
+//! QueryResultCacheInfo describes a bound, read-only plan whose result can be served from the QueryResultCache
+struct QueryResultCacheInfo {
+	//! The serialized bound plan - this uniquely identifies the query
+	string plan;
+	//! The tables that are read by the plan
+	vector<weak_ptr<DataTableInfo>> tables;
+};
+
+//! The version of a table at the point it was read by a cached query
+struct QueryResultCacheTableVersion {
+	weak_ptr<DataTableInfo> table;
+	transaction_t commit_id;
+};
+
+//! QueryResultCacheKey identifies a single execution of a cacheable plan: the plan, the parameter values and the
+//! versions of the tables as seen by the transaction executing the query
+struct QueryResultCacheKey {
+	string key;
+	vector<QueryResultCacheTableVersion> tables;
+};
+
+//! The QueryResultCache holds the (buffer-managed) results of read-only queries. Entries are invalidated as soon as
+//! a transaction commits changes to one of the tables that were read by the query.
+class QueryResultCache {
+public:
+	explicit QueryResultCache(DatabaseInstance &db);
+	~QueryResultCache();
+
+	static QueryResultCache &Get(ClientContext &context);
+	static QueryResultCache &Get(DatabaseInstance &db);
+
+	//! Analyze a bound plan - returns nullptr if the result of the plan cannot be cached
+	static unique_ptr<QueryResultCacheInfo> AnalyzePlan(ClientContext &context, LogicalOperator &plan);
+	//! Obtain the key for executing a cacheable plan with the given parameters in the current transaction. Returns
+	//! nullptr if the result cannot be cached in the current transaction (e.g. because it has local changes).
+	static unique_ptr<QueryResultCacheKey> GetKey(ClientContext &context, const QueryResultCacheInfo &info,
+	                                              const bound_parameter_map_t &values);
+
+	//! Look up the result for the given key - returns nullptr if there is no (valid) entry
+	shared_ptr<ColumnDataCollection> Lookup(const QueryResultCacheKey &key);
+	//! Store the result of a query under the given key
+	void Store(const QueryResultCacheKey &key, ColumnDataCollection &result);
+	//! Remove all entries from the cache
+	void Clear();
+	//! Returns the total allocation size of all cached results
+	idx_t GetMemoryUsage();
+	//! Returns the number of cached results
+	idx_t GetEntryCount();
+	//! Returns the number of lookups that were served from the cache
+	idx_t GetHitCount() const {
+		return hit_count;
+	}
+	//! Returns the number of lookups that were not served from the cache
+	idx_t GetMissCount() const {
+		return miss_count;
+	}
+
+private:
+	struct CacheEntry {
+		string key;
+		vector<QueryResultCacheTableVersion> tables;
+		shared_ptr<ColumnDataCollection> result;
+		idx_t size;
+	};
+	using entry_iterator_t = list<CacheEntry>::iterator;
+
+	static bool TableVersionsMatch(const vector<QueryResultCacheTableVersion> &left,
+	                               const vector<QueryResultCacheTableVersion> &right);
+	void EraseEntry(entry_iterator_t entry);
+	void EvictEntries(idx_t max_memory);
+
+private:
+	DatabaseInstance &db;
+	mutex lock;
+	//! The cached entries, ordered from most recently to least recently used
+	list<CacheEntry> entries;
+	//! Map of key -> entry
+	unordered_map<string, entry_iterator_t> entry_map;
+	//! The total allocation size of all cached results
+	idx_t memory_usage;
+	//! The number of lookups that were (not) served from the cache
+	atomic<idx_t> hit_count;
+	atomic<idx_t> miss_count;
+};
+
+} // namespace duckdb
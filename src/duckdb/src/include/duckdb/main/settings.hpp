@@ -184,6 +184,18 @@ struct AllowedPathsSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct ApproximateHolisticAggregatesSetting {
+	using RETURN_TYPE = bool;
+	static constexpr const char *Name = "approximate_holistic_aggregates";
+	static constexpr const char *Description =
+	    "Compute mode, median and quantiles of numeric values with mergeable sketches of bounded size instead of "
+	    "exactly";
+	static constexpr const char *InputType = "BOOLEAN";
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ArrowLargeBufferSizeSetting {
 	using RETURN_TYPE = bool;
 	static constexpr const char *Name = "arrow_large_buffer_size";
@@ -251,6 +263,19 @@ struct AutoloadKnownExtensionsSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct CardinalityFeedbackThresholdSetting {
+	using RETURN_TYPE = double;
+	static constexpr const char *Name = "cardinality_feedback_threshold";
+	static constexpr const char *Description =
+	    "The factor by which the actual build side cardinality of a hash join must differ from the estimate before it is "
+	    "used to re-plan subsequent queries over the same relation (0 disables cardinality feedback)";
+	static constexpr const char *InputType = "DOUBLE";
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static bool OnLocalSet(ClientContext &context, const Value &input);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct CatalogErrorMaxSchemasSetting {
 	using RETURN_TYPE = idx_t;
 	static constexpr const char *Name = "catalog_error_max_schemas";
@@ -505,6 +530,17 @@ struct EnableFSSTVectorsSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct EnableFusedExpressionsSetting {
+	using RETURN_TYPE = bool;
+	static constexpr const char *Name = "enable_fused_expressions";
+	static constexpr const char *Description =
+	    "Evaluate chains of numeric arithmetic and comparisons in a single fused loop instead of per expression node";
+	static constexpr const char *InputType = "BOOLEAN";
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct EnableHTTPLoggingSetting {
 	using RETURN_TYPE = bool;
 	static constexpr const char *Name = "enable_http_logging";
@@ -591,6 +627,19 @@ struct EnableProgressBarPrintSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct EnableQueryResultCacheSetting {
+	using RETURN_TYPE = bool;
+	static constexpr const char *Name = "enable_query_result_cache";
+	static constexpr const char *Description =
+	    "Cache the results of read-only queries until one of the tables they read is modified";
+	static constexpr const char *InputType = "BOOLEAN";
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static bool OnGlobalSet(DatabaseInstance *db, DBConfig &config, const Value &input);
+	static bool OnGlobalReset(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct EnableViewDependenciesSetting {
 	using RETURN_TYPE = bool;
 	static constexpr const char *Name = "enable_view_dependencies";
@@ -1090,6 +1139,17 @@ struct ProgressBarTimeSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct QueryResultCacheMaxMemorySetting {
+	using RETURN_TYPE = string;
+	static constexpr const char *Name = "query_result_cache_max_memory";
+	static constexpr const char *Description =
+	    "The maximum amount of memory used by the query result cache (when enabled) (e.g. 64MB)";
+	static constexpr const char *InputType = "VARCHAR";
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ScalarSubqueryErrorOnMultipleRowsSetting {
 	using RETURN_TYPE = bool;
 	static constexpr const char *Name = "scalar_subquery_error_on_multiple_rows";
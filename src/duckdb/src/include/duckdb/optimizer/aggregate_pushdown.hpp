@@ -0,0 +1,47 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/aggregate_pushdown.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/optional_idx.hpp"
+#include "duckdb/planner/column_binding_map.hpp"
+#include "duckdb/planner/logical_operator_visitor.hpp"
+
+namespace duckdb {
+class Optimizer;
+
+//! The AggregatePushdown optimizer performs eager aggregation: a GROUP BY over an inner join is pre-aggregated on the
+//! join keys below the join, if the aggregates can be decomposed (SUM/COUNT/MIN/MAX) and pre-aggregating
+//! significantly reduces the input of the join
+class AggregatePushdown : public LogicalOperatorVisitor {
+public:
+	//! The minimum factor by which the pre-aggregation must reduce the number of rows that go into the join
+	static constexpr const idx_t MIN_REDUCTION_FACTOR = 10;
+
+public:
+	explicit AggregatePushdown(Optimizer &optimizer);
+
+	void Optimize(unique_ptr<LogicalOperator> &op);
+	void VisitOperator(LogicalOperator &op) override;
+
+private:
+	void StandardVisitOperator(LogicalOperator &op);
+	unique_ptr<Expression> VisitReplace(BoundColumnRefExpression &expr, unique_ptr<Expression> *expr_ptr) override;
+	//! Try to push a partial aggregate into one of the sides of the join below the aggregate
+	void TryPushdownAggregate(unique_ptr<LogicalOperator> &op);
+	bool PushdownAggregate(unique_ptr<LogicalOperator> &op, idx_t side);
+	//! Estimate the number of groups when grouping the output of "op" by the given columns
+	optional_idx EstimateGroupCount(LogicalOperator &op, const vector<ColumnBinding> &bindings);
+
+private:
+	Optimizer &optimizer;
+	//! Bindings of aggregates that were moved into a projection
+	column_binding_map_t<ColumnBinding> aggregate_map;
+};
+
+} // namespace duckdb
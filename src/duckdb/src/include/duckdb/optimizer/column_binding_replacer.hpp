@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/planner/column_binding_map.hpp"
 #include "duckdb/planner/logical_operator.hpp"
 
 namespace duckdb {
@@ -42,6 +43,16 @@ public:
 
 	//! Do not recurse further than this operator (optional)
 	optional_ptr<LogicalOperator> stop_operator;
+
+private:
+	//! Index the replacement bindings that were added since the last visit
+	void UpdateReplacementIndex();
+
+private:
+	//! For every old binding, the (ascending) indexes of the replacement bindings that replace it
+	column_binding_map_t<vector<idx_t>> replacement_index;
+	//! The number of replacement bindings in the index
+	idx_t indexed_count = 0;
 };
 
 } // namespace duckdb
@@ -0,0 +1,73 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/common_subplan_optimizer.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/optional_idx.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/planner/column_binding_map.hpp"
+#include "duckdb/planner/logical_operator.hpp"
+
+namespace duckdb {
+
+class Optimizer;
+
+//! The CommonSubplanOptimizer finds structurally identical subplans (e.g. the same join appearing in several UNION ALL
+//! branches, or a CTE that was inlined multiple times) and materializes them once as a CTE, so that every occurrence
+//! reads the materialized result instead of re-executing the subplan
+class CommonSubplanOptimizer {
+public:
+	explicit CommonSubplanOptimizer(Optimizer &optimizer);
+
+	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
+
+private:
+	struct SubplanInfo {
+		//! The unique_ptr that holds the operator
+		unique_ptr<LogicalOperator> *slot;
+		//! The index of the parent of the subplan (if any)
+		optional_idx parent;
+		//! The depth of the operator in the plan
+		idx_t depth;
+		//! The number of operators in the subplan (the subplan occupies the indexes [index - size + 1, index])
+		idx_t size;
+		//! Whether or not the subplan can be shared
+		bool eligible;
+		//! Whether or not the subplan is expensive enough to be worth materializing (i.e. it joins or aggregates)
+		bool expensive;
+		//! The id of the signature that identifies the subplan - structurally identical subplans have the same id
+		idx_t signature_id;
+	};
+
+private:
+	//! Enumerates the subplans in post-order, returns the index of the subplan rooted at "op"
+	idx_t EnumerateSubplans(unique_ptr<LogicalOperator> &op, idx_t depth);
+	//! Creates the signature of a single operator, in which all column references are replaced by their position in
+	//! the output of the children. Returns false if the operator cannot be part of a shared subplan.
+	bool CreateOperatorSignature(LogicalOperator &op, string &result);
+	//! Whether or not the output of a subplan is consumed by a LIMIT that can stop its execution early
+	bool HasLimitConsumer(idx_t subplan_idx);
+	//! Whether or not materializing the subplan (once) is cheaper than executing every occurrence
+	bool MaterializationIsCheaper(idx_t subplan_idx);
+	//! Returns the index of the lowest common ancestor of a set of subplans
+	idx_t LowestCommonAncestor(const vector<idx_t> &subplan_indexes);
+	//! Replaces a set of identical subplans by references to a single materialized CTE
+	void MaterializeSubplans(unique_ptr<LogicalOperator> &root, const vector<idx_t> &subplan_indexes);
+
+private:
+	Optimizer &optimizer;
+	//! The subplans, in post-order
+	vector<SubplanInfo> subplans;
+	//! Interned subplan signatures. A signature consists of the signature of the operator followed by the signature ids
+	//! of its children, so its size does not grow with the size of the subplan.
+	unordered_map<string, idx_t> signature_ids;
+	//! Whether or not the plan can be optimized
+	bool supported;
+};
+
+} // namespace duckdb
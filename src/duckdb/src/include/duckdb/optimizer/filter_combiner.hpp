@@ -37,6 +37,10 @@ public:
 
 	ClientContext &context;
 
+	//! Equivalence sets up to this size generate an equality filter between every pair of entries (giving the join
+	//! order optimizer the most freedom) - larger sets only chain consecutive entries to avoid a quadratic blow-up
+	static constexpr idx_t MAX_PAIRWISE_EQUIVALENCE_SET = 16;
+
 public:
 	struct ExpressionValueInformation {
 		Value constant;
@@ -0,0 +1,33 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/hnsw_index_scan.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+class ClientContext;
+class LogicalOperator;
+class LogicalTopN;
+
+//! Rewrites ORDER BY array_distance(column, constant) LIMIT k over a table scan into a nearest-neighbor
+//! search of a matching HNSW index. The TopN stays in place and re-ranks the fetched rows by their exact distance.
+class HNSWIndexScanOptimizer {
+public:
+	explicit HNSWIndexScanOptimizer(ClientContext &context);
+
+	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
+
+private:
+	bool TryOptimize(LogicalTopN &top_n);
+
+private:
+	ClientContext &context;
+};
+
+} // namespace duckdb
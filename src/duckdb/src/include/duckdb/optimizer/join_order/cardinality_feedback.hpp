@@ -0,0 +1,81 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/join_order/cardinality_feedback.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/storage/object_cache.hpp"
+
+namespace duckdb {
+class ClientContext;
+class LogicalOperator;
+class TableCatalogEntry;
+
+//! The CardinalityFeedback keeps track of the cardinalities that were observed for join relations during execution.
+//! Hash joins report the actual size of their build side when it diverges from the estimate, and the join order
+//! optimizer uses the observed cardinality instead of the estimate the next time the relation is planned.
+class CardinalityFeedback : public ObjectCacheEntry {
+public:
+	//! The maximum number of relations we keep feedback for - the least recently used entries are evicted
+	static constexpr const idx_t MAX_ENTRIES = 4096;
+
+public:
+	CardinalityFeedback();
+	~CardinalityFeedback() override = default;
+
+	//! Returns the feedback of the database, or nullptr if cardinality feedback is disabled for this client
+	static optional_ptr<CardinalityFeedback> Get(ClientContext &context);
+
+	//! Returns a key that identifies the relation rooted at "op" (a filtered scan over a table) in the current version
+	//! of the table, or an empty string if we cannot provide feedback for the relation. The name of the scanned table
+	//! is written to "table_name".
+	static string GetRelationKey(LogicalOperator &op, string &table_name);
+	//! Returns the name that identifies a table in the feedback
+	static string GetTableName(TableCatalogEntry &table);
+
+	//! Look up the observed cardinality of a relation
+	bool TryGetCardinality(const string &key, idx_t &result);
+	//! Report the observed cardinality of a relation over the given table. Returns true if this changes the feedback.
+	bool Record(const string &table_name, const string &key, idx_t cardinality, double threshold);
+	//! Whether or not "actual" diverges from "estimate" by more than the threshold
+	static bool Diverges(idx_t estimate, idx_t actual, double threshold);
+
+	//! The version of the feedback for the relations over a table - this is incremented every time it changes
+	idx_t GetTableVersion(const string &table_name);
+	//! Collects the current feedback version of every table that is scanned by the plan
+	void GetTableVersions(LogicalOperator &plan, unordered_map<string, idx_t> &result);
+
+	static string ObjectType() {
+		return "CARDINALITY_FEEDBACK";
+	}
+
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+private:
+	struct FeedbackEntry {
+		string key;
+		idx_t cardinality;
+	};
+	using entry_iterator_t = list<FeedbackEntry>::iterator;
+
+private:
+	mutex lock;
+	//! The observed cardinalities, ordered from most recently to least recently used
+	list<FeedbackEntry> entries;
+	//! Relation key -> entry
+	unordered_map<string, entry_iterator_t> entry_map;
+	//! Table name -> the version of the feedback for relations over that table
+	unordered_map<string, idx_t> table_versions;
+};
+
+} // namespace duckdb
@@ -0,0 +1,26 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/rule/contains_disjunction.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/optimizer/rule.hpp"
+
+namespace duckdb {
+
+// The Contains Disjunction rule combines disjunctions of substring searches on the same string into a single
+// multi-needle search, e.g. contains(x, 'a') OR contains(x, 'b') => __internal_contains_any(x, 'a', 'b'), so that
+// the string is only scanned once (LIKE '%a%' is rewritten to contains(x, 'a') by the LikeOptimizationRule)
+class ContainsDisjunctionRule : public Rule {
+public:
+	explicit ContainsDisjunctionRule(ExpressionRewriter &rewriter);
+
+	unique_ptr<Expression> Apply(LogicalOperator &op, vector<reference<Expression>> &bindings, bool &changes_made,
+	                             bool is_root) override;
+};
+
+} // namespace duckdb
@@ -3,6 +3,7 @@
 #include "duckdb/optimizer/rule/comparison_simplification.hpp"
 #include "duckdb/optimizer/rule/conjunction_simplification.hpp"
 #include "duckdb/optimizer/rule/constant_folding.hpp"
+#include "duckdb/optimizer/rule/contains_disjunction.hpp"
 #include "duckdb/optimizer/rule/date_part_simplification.hpp"
 #include "duckdb/optimizer/rule/distributivity.hpp"
 #include "duckdb/optimizer/rule/empty_needle_removal.hpp"
@@ -11,12 +11,15 @@
 #include "duckdb/common/constants.hpp"
 
 namespace duckdb {
+class ClientContext;
 class LogicalOperator;
 class LogicalTopN;
 class Optimizer;
 
 class TopN {
 public:
+	explicit TopN(ClientContext &context);
+
 	//! Optimize ORDER BY + LIMIT to TopN
 	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
 	//! Whether we can perform the optimization on this operator
@@ -24,6 +27,9 @@ public:
 
 private:
 	void PushdownDynamicFilters(LogicalTopN &op);
+
+private:
+	ClientContext &context;
 };
 
 } // namespace duckdb
@@ -77,6 +77,8 @@ public:
 	idx_t GetSharedOrders(const BoundWindowExpression &other) const;
 
 	bool PartitionsAreEquivalent(const BoundWindowExpression &other) const;
+	//! Whether the partitions of other are a strict superset of these (non-empty) partitions
+	bool PartitionsAreRefinedBy(const BoundWindowExpression &other) const;
 	bool KeysAreCompatible(const BoundWindowExpression &other) const;
 	bool Equals(const BaseExpression &other) const override;
 
@@ -0,0 +1,92 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/planner/table_filter.hpp"
+
+namespace duckdb {
+class SelectionVector;
+class Vector;
+struct UnifiedVectorFormat;
+
+//! The (immutable) bit array of a bloom filter, together with statistics on how selective the filter is
+struct BloomFilterData {
+public:
+	//! If the filter lets through more than this fraction of tuples, it is disabled
+	static constexpr const double MAX_PASS_RATIO = 0.9;
+	//! The number of tuples we check before deciding whether or not to disable the filter
+	static constexpr const idx_t MIN_PROBED_TUPLES = 65536;
+
+public:
+	explicit BloomFilterData(idx_t key_count);
+	//! Create a bloom filter from the (serialized) bit array of another bloom filter
+	BloomFilterData(vector<uint64_t> blocks, bool disabled);
+
+	//! Insert the hashes of a set of keys into the bloom filter (must be called before the filter is used)
+	void Insert(Vector &hashes, idx_t count);
+	//! Whether or not the given hash might be in the filter
+	inline bool Lookup(hash_t hash) const {
+		return (blocks[hash & block_mask] & GetMask(hash)) == GetMask(hash);
+	}
+
+	//! Update the statistics of the filter, possibly disabling it
+	void Update(idx_t probed_count, idx_t passed_count);
+	bool IsDisabled() const {
+		return disabled;
+	}
+	const vector<uint64_t> &GetBlocks() const {
+		return blocks;
+	}
+
+private:
+	static inline uint64_t GetMask(hash_t hash) {
+		// each key sets three bits in a single 64-bit block
+		return (uint64_t(1) << ((hash >> 40) & 63)) | (uint64_t(1) << ((hash >> 46) & 63)) |
+		       (uint64_t(1) << ((hash >> 52) & 63));
+	}
+
+private:
+	vector<uint64_t> blocks;
+	idx_t block_mask;
+
+	atomic<idx_t> probed;
+	atomic<idx_t> passed;
+	atomic<bool> disabled;
+};
+
+//! A BloomFilter removes the tuples whose value is (definitely) not in a set of keys - e.g. the keys of the build side
+//! of a hash join. The filter can have false positives, so it can only be used where the exact filtering happens
+//! afterwards (e.g. in the join itself).
+class BloomFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::BLOOM_FILTER;
+
+public:
+	BloomFilter();
+	explicit BloomFilter(shared_ptr<BloomFilterData> filter_data);
+
+	//! The shared bloom filter data
+	shared_ptr<BloomFilterData> filter_data;
+
+public:
+	//! Filter the tuples in the vector, returns the number of tuples that (might) be in the filter
+	idx_t Filter(Vector &vector, UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t scan_count,
+	             idx_t approved_tuple_count) const;
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
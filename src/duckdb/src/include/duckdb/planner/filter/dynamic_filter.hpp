@@ -24,6 +24,17 @@ struct DynamicFilterData {
 	void Reset();
 };
 
+//! The range of the filtered column for a dynamic filter that is set from a monotonic function of that column (e.g.
+//! ORDER BY date_trunc('day', ts)). Boundary values of the function are mapped back to a bound on the column by
+//! searching this range.
+struct DynamicFilterColumnRange {
+	//! The minimum and maximum value of the column
+	Value min;
+	Value max;
+	//! Whether the function is decreasing (rather than increasing) in the column
+	bool decreasing = false;
+};
+
 class DynamicFilter : public TableFilter {
 public:
 	static constexpr const TableFilterType TYPE = TableFilterType::DYNAMIC_FILTER;
@@ -31,6 +31,8 @@ public:
 	idx_t table_index;
 	idx_t column_count;
 	string ctename;
+	//! Whether the CTE was introduced by the CommonSubplanOptimizer (rather than written by the user)
+	bool is_shared_subplan = false;
 
 public:
 	InsertionOrderPreservingMap<string> ParamsToString() const override;
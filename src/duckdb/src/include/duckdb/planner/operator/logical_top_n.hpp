@@ -13,6 +13,7 @@
 
 namespace duckdb {
 struct DynamicFilterData;
+struct DynamicFilterColumnRange;
 
 //! LogicalTopN represents a comibination of ORDER BY and LIMIT clause, using Min/Max Heap
 class LogicalTopN : public LogicalOperator {
@@ -30,6 +31,9 @@ public:
 	idx_t offset;
 	//! Dynamic table filter (if any)
 	shared_ptr<DynamicFilterData> dynamic_filter;
+	//! The range of the filtered column, if the dynamic filter is on a column that the first ORDER BY expression is a
+	//! monotonic function of (rather than the ORDER BY expression itself)
+	unique_ptr<DynamicFilterColumnRange> dynamic_filter_range;
 
 public:
 	vector<ColumnBinding> GetColumnBindings() override {
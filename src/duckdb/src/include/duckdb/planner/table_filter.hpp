@@ -32,7 +32,8 @@ enum class TableFilterType : uint8_t {
 	STRUCT_EXTRACT = 5,      // filter applies to child-column of struct
 	OPTIONAL_FILTER = 6,     // executing filter is not required for query correctness
 	IN_FILTER = 7,           // col IN (C1, C2, C3, ...)
-	DYNAMIC_FILTER = 8       // dynamic filters can be updated at run-time
+	DYNAMIC_FILTER = 8,      // dynamic filters can be updated at run-time
+	BLOOM_FILTER = 9         // bloom filter on a set of keys (might have false positives)
 };
 
 //! TableFilter represents a filter pushed down into the table scan.
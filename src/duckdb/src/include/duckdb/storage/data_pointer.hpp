@@ -71,6 +71,8 @@ struct RowGroupPointer {
 	vector<MetaBlockPointer> data_pointers;
 	//! Data pointers to the delete information of the row group (if any)
 	vector<MetaBlockPointer> deletes_pointers;
+	//! The columns whose values are sorted (non-decreasing and non-NULL) within the row group
+	vector<idx_t> sorted_columns;
 };
 
 } // namespace duckdb
@@ -91,6 +91,8 @@ public:
 	//! Fetch data from the specific row identifiers from the base table
 	void Fetch(DuckTransaction &transaction, DataChunk &result, const vector<StorageIndex> &column_ids,
 	           const Vector &row_ids, idx_t fetch_count, ColumnFetchState &state);
+	//! Returns true, if the row exists and is visible to the transaction. The caller must hold the checkpoint lock.
+	bool CanFetch(DuckTransaction &transaction, const row_t row_id);
 
 	//! Initializes appending to transaction-local storage
 	void InitializeLocalAppend(LocalAppendState &state, TableCatalogEntry &table, ClientContext &context,
@@ -250,6 +252,8 @@ public:
 
 	//! Returns a list of the partition stats
 	vector<PartitionStatistics> GetPartitionStats(ClientContext &context);
+	//! Whether the column is sorted within every row group of the table (ignoring transaction-local data)
+	bool HasSortedRowGroups(const StorageIndex &column_index) const;
 
 private:
 	//! Verify the new added constraints against current persistent&local data
@@ -52,6 +52,13 @@ public:
 	string GetTableName();
 	void SetTableName(string name);
 
+	//! Returns the commit id of the most recent transaction that committed changes to this table
+	transaction_t GetLastCommitId() const {
+		return last_commit_id;
+	}
+	//! Mark that a transaction with the given commit id has committed changes to this table
+	void SetLastCommitId(transaction_t commit_id);
+
 private:
 	//! The database instance of the table
 	AttachedDatabase &db;
@@ -69,6 +76,8 @@ private:
 	vector<IndexStorageInfo> index_storage_infos;
 	//! Lock held while checkpointing
 	StorageLock checkpoint_lock;
+	//! The commit id of the most recent transaction that committed changes to this table (0 if none)
+	atomic<transaction_t> last_commit_id;
 };
 
 } // namespace duckdb
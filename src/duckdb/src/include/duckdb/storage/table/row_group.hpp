@@ -158,6 +158,9 @@ public:
 	void UpdateColumn(TransactionData transaction, DataChunk &updates, Vector &row_ids,
 	                  const vector<column_t> &column_path);
 
+	//! Whether the values of the column are sorted (non-decreasing and non-NULL) within this row group
+	bool IsSorted(idx_t column_idx) const;
+
 	void MergeStatistics(idx_t column_idx, const BaseStatistics &other);
 	void MergeIntoStatistics(idx_t column_idx, BaseStatistics &other);
 	void MergeIntoStatistics(TableStatistics &other);
@@ -201,12 +204,19 @@ private:
 
 	bool HasUnloadedDeletes() const;
 
+	void InitializeSorted();
+	static bool SupportsSortedTracking(const LogicalType &type);
+	//! Tracks whether the column stays sorted after appending the given values
+	void UpdateSorted(idx_t column_idx, Vector &vector, idx_t append_count);
+
 private:
 	mutex row_group_lock;
 	vector<MetaBlockPointer> column_pointers;
 	unique_ptr<atomic<bool>[]> is_loaded;
 	vector<MetaBlockPointer> deletes_pointers;
 	atomic<bool> deletes_is_loaded;
+	//! Whether the values of each column are sorted within this row group
+	unique_ptr<atomic<bool>[]> is_sorted;
 	idx_t allocation_size;
 };
 
@@ -101,6 +101,12 @@ struct ColumnScanState {
 	vector<bool> scan_child_column;
 	//! Contains TableScan level config for scanning
 	optional_ptr<TableScanOptions> scan_options;
+	//! The id of the last dictionary a table filter was evaluated on (if any)
+	string filter_dictionary_id;
+	//! The table filter that was evaluated on the dictionary
+	optional_ptr<const TableFilter> filter_dictionary_filter;
+	//! For every entry of the dictionary - whether or not it passes the table filter
+	unsafe_vector<bool> filter_dictionary_result;
 
 public:
 	void Initialize(const LogicalType &type, const vector<StorageIndex> &children,
@@ -10,6 +10,7 @@
 #include "duckdb/common/types/column/column_data_collection.hpp"
 #include "duckdb/execution/column_binding_resolver.hpp"
 #include "duckdb/execution/operator/helper/physical_result_collector.hpp"
+#include "duckdb/execution/operator/scan/physical_column_data_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/main/appender.hpp"
 #include "duckdb/main/attached_database.hpp"
@@ -22,8 +23,10 @@
 #include "duckdb/main/materialized_query_result.hpp"
 #include "duckdb/main/query_profiler.hpp"
 #include "duckdb/main/query_result.hpp"
+#include "duckdb/main/query_result_cache.hpp"
 #include "duckdb/main/relation.hpp"
 #include "duckdb/main/stream_query_result.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/optimizer/optimizer.hpp"
 #include "duckdb/parser/expression/constant_expression.hpp"
 #include "duckdb/parser/expression/parameter_expression.hpp"
@@ -56,6 +59,10 @@ public:
 	unique_ptr<Executor> executor;
 	//! The progress bar
 	unique_ptr<ProgressBar> progress_bar;
+	//! The key under which the result should be stored in the query result cache (if any)
+	unique_ptr<QueryResultCacheKey> result_cache_key;
+	//! The cached result that is scanned if the query is served from the query result cache
+	shared_ptr<ColumnDataCollection> cached_result;
 
 public:
 	void SetOpenResult(BaseQueryResult &result) {
@@ -328,6 +335,12 @@ unique_ptr<QueryResult> ClientContext::FetchResultInternal(ClientContextLock &lo
 	// we have a result collector - fetch the result directly from the result collector
 	result = executor.GetResult();
 	if (!create_stream_result) {
+		if (active_query->result_cache_key && result->type == QueryResultType::MATERIALIZED_RESULT &&
+		    !result->HasError()) {
+			// store the result in the query result cache
+			auto &materialized = result->Cast<MaterializedQueryResult>();
+			QueryResultCache::Get(*this).Store(*active_query->result_cache_key, materialized.Collection());
+		}
 		CleanupInternal(lock, result.get(), false);
 	} else {
 		active_query->SetOpenResult(*result);
@@ -380,7 +393,17 @@ ClientContext::CreatePreparedStatementInternal(ClientContextLock &lock, const st
 #ifdef DEBUG
 	plan->Verify(*this);
 #endif
+	if (statement_type == StatementType::SELECT_STATEMENT && result->properties.IsReadOnly() &&
+	    DBConfig::GetConfig(*this).options.enable_query_result_cache) {
+		// check if the result of this query can be served from the query result cache
+		result->result_cache_info = QueryResultCache::AnalyzePlan(*this, *plan);
+	}
 	if (config.enable_optimizer && plan->RequireOptimizer()) {
+		auto feedback = CardinalityFeedback::Get(*this);
+		if (feedback) {
+			// remember which cardinality feedback was used to plan the statement
+			feedback->GetTableVersions(*plan, result->cardinality_feedback_versions);
+		}
 		profiler.StartPhase(MetricsType::ALL_OPTIMIZERS);
 		Optimizer optimizer(*planner.binder, *this);
 		plan = optimizer.Optimize(std::move(plan));
@@ -484,6 +507,35 @@ void ClientContext::RebindPreparedStatement(ClientContextLock &lock, const strin
 	prepared->properties.bound_all_parameters = false;
 }
 
+shared_ptr<PreparedStatementData>
+ClientContext::CheckQueryResultCache(ClientContextLock &lock, shared_ptr<PreparedStatementData> statement_p) {
+	D_ASSERT(active_query);
+	auto &statement = *statement_p;
+	if (!statement.result_cache_info || !DBConfig::GetConfig(*this).options.enable_query_result_cache) {
+		return statement_p;
+	}
+	auto key = QueryResultCache::GetKey(*this, *statement.result_cache_info, statement.value_map);
+	if (!key) {
+		// the result cannot be cached in the current transaction
+		return statement_p;
+	}
+	auto cached_result = QueryResultCache::Get(*this).Lookup(*key);
+	if (!cached_result) {
+		// cache miss - store the result once the query finishes
+		active_query->result_cache_key = std::move(key);
+		return statement_p;
+	}
+	// cache hit - replace the plan with a scan over the cached result
+	auto result = make_shared_ptr<PreparedStatementData>(statement.statement_type);
+	result->names = statement.names;
+	result->types = statement.types;
+	result->properties = statement.properties;
+	result->plan = make_uniq<PhysicalColumnDataScan>(statement.types, PhysicalOperatorType::COLUMN_DATA_SCAN,
+	                                                 cached_result->Count(), *cached_result);
+	active_query->cached_result = std::move(cached_result);
+	return result;
+}
+
 void ClientContext::CheckIfPreparedStatementIsExecutable(PreparedStatementData &statement) {
 	if (ValidChecker::IsInvalidated(ActiveTransaction()) && statement.properties.requires_valid_transaction) {
 		throw ErrorManager::InvalidatedTransaction(*this);
@@ -509,10 +561,10 @@ unique_ptr<PendingQueryResult>
 ClientContext::PendingPreparedStatementInternal(ClientContextLock &lock, shared_ptr<PreparedStatementData> statement_p,
                                                 const PendingQueryParameters &parameters) {
 	D_ASSERT(active_query);
+	BindPreparedStatementParameters(*statement_p, parameters);
+	statement_p = CheckQueryResultCache(lock, std::move(statement_p));
 	auto &statement = *statement_p;
 
-	BindPreparedStatementParameters(statement, parameters);
-
 	active_query->executor = make_uniq<Executor>(*this);
 	auto &executor = *active_query->executor;
 	if (config.enable_progress_bar) {
@@ -15,6 +15,7 @@
 #include "duckdb/main/db_instance_cache.hpp"
 #include "duckdb/main/error_manager.hpp"
 #include "duckdb/main/extension_helper.hpp"
+#include "duckdb/main/query_result_cache.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parsed_data/attach_info.hpp"
@@ -73,6 +74,7 @@ DatabaseInstance::~DatabaseInstance() {
 	}
 	// destroy child elements
 	connection_manager.reset();
+	result_cache.reset();
 	object_cache.reset();
 	scheduler.reset();
 	db_manager.reset();
@@ -297,6 +299,7 @@ void DatabaseInstance::Initialize(const char *database_path, DBConfig *user_conf
 
 	scheduler = make_uniq<TaskScheduler>(*this);
 	object_cache = make_uniq<ObjectCache>();
+	result_cache = make_uniq<QueryResultCache>(*this);
 	connection_manager = make_uniq<ConnectionManager>();
 
 	// initialize the secret manager
@@ -376,6 +379,10 @@ ObjectCache &DatabaseInstance::GetObjectCache() {
 	return *object_cache;
 }
 
+QueryResultCache &DatabaseInstance::GetQueryResultCache() {
+	return *result_cache;
+}
+
 FileSystem &DatabaseInstance::GetFileSystem() {
 	return *db_file_system;
 }
@@ -5,6 +5,8 @@
 #include "duckdb/common/exception/binder_exception.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/query_result_cache.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/transaction/transaction.hpp"
 
 namespace duckdb {
@@ -55,6 +57,17 @@ bool PreparedStatementData::RequireRebind(ClientContext &context,
 		// parameters not yet bound: query always requires a rebind
 		return true;
 	}
+	if (!cardinality_feedback_versions.empty()) {
+		// re-plan the statement if we have learned about the cardinalities of its tables since it was planned
+		auto feedback = CardinalityFeedback::Get(context);
+		if (feedback) {
+			for (auto &entry : cardinality_feedback_versions) {
+				if (feedback->GetTableVersion(entry.first) != entry.second) {
+					return true;
+				}
+			}
+		}
+	}
 	for (auto &it : value_map) {
 		auto &identifier = it.first;
 		auto lookup = values->find(identifier);
@@ -95,6 +95,9 @@ void ProfilingInfo::ResetMetrics() {
 		case MetricsType::OPERATOR_ROWS_SCANNED:
 			metrics[metric] = Value::CreateValue<uint64_t>(0);
 			break;
+		case MetricsType::PHASE_PLAN_NODES:
+			metrics[metric] = Value::MAP(LogicalType::VARCHAR, LogicalType::UBIGINT, vector<Value>(), vector<Value>());
+			break;
 		case MetricsType::EXTRA_INFO:
 			break;
 		default:
@@ -221,6 +224,16 @@ void ProfilingInfo::WriteMetricsToJSON(yyjson_mut_doc *doc, yyjson_mut_val *dest
 			yyjson_mut_obj_add_uint(doc, dest, key_ptr, metrics[metric].GetValue<uint64_t>());
 			break;
 		}
+		case MetricsType::PHASE_PLAN_NODES: {
+			auto plan_nodes_obj = yyjson_mut_obj(doc);
+			for (auto &entry : MapValue::GetChildren(metrics[metric])) {
+				auto &key_value = StructValue::GetChildren(entry);
+				yyjson_mut_obj_add_uint(doc, plan_nodes_obj, key_value[0].GetValue<string>().c_str(),
+				                        key_value[1].GetValue<uint64_t>());
+			}
+			yyjson_mut_obj_add_val(doc, dest, key_ptr, plan_nodes_obj);
+			break;
+		}
 		default:
 			throw NotImplementedException("MetricsType %s not implemented", EnumUtil::ToString(metric));
 		}
@@ -3,6 +3,7 @@
 #include "duckdb/common/fstream.hpp"
 #include "duckdb/common/limits.hpp"
 #include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/common/plan_node_counter.hpp"
 #include "duckdb/common/printer.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/tree_renderer/text_tree_renderer.hpp"
@@ -110,6 +111,8 @@ void QueryProfiler::StartQuery(string query, bool is_explain_analyze_p, bool sta
 	root = nullptr;
 	phase_timings.clear();
 	phase_stack.clear();
+	phase_plan_node_stack.clear();
+	phase_plan_nodes.clear();
 	main_query.Start();
 }
 
@@ -321,6 +324,7 @@ void QueryProfiler::StartPhase(MetricsType phase_metric) {
 
 	// start a new phase
 	phase_stack.push_back(phase_metric);
+	phase_plan_node_stack.push_back(PlanNodeCounter::GetCount());
 	// restart the timer
 	phase_profiler.Start();
 }
@@ -338,8 +342,11 @@ void QueryProfiler::EndPhase() {
 	for (auto &phase : phase_stack) {
 		phase_timings[phase] += phase_profiler.Elapsed();
 	}
+	// count the plan nodes created during the phase (including any nested phases)
+	phase_plan_nodes[phase_stack.back()] += PlanNodeCounter::GetCount() - phase_plan_node_stack.back();
 	// now remove the last added phase
 	phase_stack.pop_back();
+	phase_plan_node_stack.pop_back();
 
 	if (!phase_stack.empty()) {
 		phase_profiler.Start();
@@ -744,7 +751,7 @@ profiler_settings_t EraseQueryRootSettings(profiler_settings_t settings) {
 
 	for (auto &setting : settings) {
 		if (MetricsUtils::IsOptimizerMetric(setting) || MetricsUtils::IsPhaseTimingMetric(setting) ||
-		    setting == MetricsType::BLOCKED_THREAD_TIME) {
+		    setting == MetricsType::BLOCKED_THREAD_TIME || setting == MetricsType::PHASE_PLAN_NODES) {
 			phase_timing_settings_to_erase.insert(setting);
 		}
 	}
@@ -865,6 +872,22 @@ void QueryProfiler::MoveOptimizerPhasesToRoot() {
 			root_metrics[phase] = Value::CreateValue(timing);
 		}
 	}
+
+	if (root_info.Enabled(root_info.expanded_settings, MetricsType::PHASE_PLAN_NODES)) {
+		// sort the phases by name so the output is deterministic
+		map<string, idx_t> sorted_plan_nodes;
+		for (auto &entry : phase_plan_nodes) {
+			sorted_plan_nodes[StringUtil::Lower(EnumUtil::ToString(entry.first))] = entry.second;
+		}
+		vector<Value> keys;
+		vector<Value> values;
+		for (auto &entry : sorted_plan_nodes) {
+			keys.push_back(Value(entry.first));
+			values.push_back(Value::UBIGINT(entry.second));
+		}
+		root_metrics[MetricsType::PHASE_PLAN_NODES] =
+		    Value::MAP(LogicalType::VARCHAR, LogicalType::UBIGINT, std::move(keys), std::move(values));
+	}
 }
 
 void QueryProfiler::Propagate(QueryProfiler &) {
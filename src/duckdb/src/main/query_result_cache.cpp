@@ -0,0 +1,336 @@
+#include "duckdb/main/query_result_cache.hpp"
+
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/common/serializer/binary_serializer.hpp"
+#include "duckdb/common/serializer/memory_stream.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/planner/expression/bound_window_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/logical_operator.hpp"
+#include "duckdb/planner/logical_operator_visitor.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/meta_transaction.hpp"
+
+namespace duckdb {
+
+QueryResultCache::QueryResultCache(DatabaseInstance &db) : db(db), memory_usage(0), hit_count(0), miss_count(0) {
+}
+
+QueryResultCache::~QueryResultCache() {
+}
+
+QueryResultCache &QueryResultCache::Get(ClientContext &context) {
+	return context.db->GetQueryResultCache();
+}
+
+QueryResultCache &QueryResultCache::Get(DatabaseInstance &db) {
+	return db.GetQueryResultCache();
+}
+
+//===--------------------------------------------------------------------===//
+// Plan Analysis
+//===--------------------------------------------------------------------===//
+static bool ExpressionIsCacheable(const Expression &expr) {
+	switch (expr.GetExpressionClass()) {
+	case ExpressionClass::BOUND_SUBQUERY:
+		// subqueries should have been planned at this point - bail out if they are not
+		return false;
+	case ExpressionClass::BOUND_FUNCTION: {
+		// the bind data of a function can capture session state (e.g. current_setting()) - if it is not serialized
+		// it is not part of the key, and we cannot cache the result
+		auto &func = expr.Cast<BoundFunctionExpression>();
+		if (func.bind_info && !func.function.serialize) {
+			return false;
+		}
+		break;
+	}
+	case ExpressionClass::BOUND_AGGREGATE: {
+		auto &aggr = expr.Cast<BoundAggregateExpression>();
+		if (aggr.function.stability != FunctionStability::CONSISTENT) {
+			return false;
+		}
+		if (aggr.bind_info && !aggr.function.serialize) {
+			return false;
+		}
+		break;
+	}
+	case ExpressionClass::BOUND_WINDOW: {
+		auto &window = expr.Cast<BoundWindowExpression>();
+		if (window.aggregate && window.aggregate->stability != FunctionStability::CONSISTENT) {
+			return false;
+		}
+		if (window.aggregate && window.bind_info && !window.aggregate->serialize) {
+			return false;
+		}
+		break;
+	}
+	default:
+		break;
+	}
+	// volatile functions (e.g. random()) and functions that are only consistent within a query (e.g. now()) cannot
+	// be cached
+	if (!expr.IsConsistent()) {
+		return false;
+	}
+	bool cacheable = true;
+	ExpressionIterator::EnumerateChildren(expr, [&](const Expression &child) {
+		if (!ExpressionIsCacheable(child)) {
+			cacheable = false;
+		}
+	});
+	return cacheable;
+}
+
+static bool OperatorIsCacheable(LogicalOperator &op, vector<weak_ptr<DataTableInfo>> &tables) {
+	if (!op.SupportSerialization()) {
+		return false;
+	}
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_GET: {
+		// we can only cache scans over DuckDB tables - the result of other table functions (e.g. files, remote
+		// databases) can change without us knowing about it
+		auto &get = op.Cast<LogicalGet>();
+		auto table = get.GetTable();
+		if (!table || !table->IsDuckTable()) {
+			return false;
+		}
+		auto &info = table->GetStorage().GetDataTableInfo();
+		bool found = false;
+		for (auto &existing : tables) {
+			if (existing.lock() == info) {
+				found = true;
+				break;
+			}
+		}
+		if (!found) {
+			tables.push_back(info);
+		}
+		break;
+	}
+	case LogicalOperatorType::LOGICAL_SAMPLE:
+	case LogicalOperatorType::LOGICAL_EXTENSION_OPERATOR:
+		return false;
+	default:
+		break;
+	}
+	bool cacheable = true;
+	LogicalOperatorVisitor::EnumerateExpressions(op, [&](unique_ptr<Expression> *child) {
+		if (!ExpressionIsCacheable(**child)) {
+			cacheable = false;
+		}
+	});
+	if (!cacheable) {
+		return false;
+	}
+	for (auto &child : op.children) {
+		if (!OperatorIsCacheable(*child, tables)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+unique_ptr<QueryResultCacheInfo> QueryResultCache::AnalyzePlan(ClientContext &context, LogicalOperator &plan) {
+	auto result = make_uniq<QueryResultCacheInfo>();
+	if (!OperatorIsCacheable(plan, result->tables)) {
+		return nullptr;
+	}
+	if (result->tables.empty()) {
+		// nothing to gain by caching queries that do not read any tables
+		return nullptr;
+	}
+	// the serialized bound plan is used to identify the query
+	try {
+		MemoryStream stream(Allocator::Get(context));
+		BinarySerializer::Serialize(plan, stream);
+		result->plan = string(char_ptr_cast(stream.GetData()), stream.GetPosition());
+	} catch (std::exception &) {
+		// the plan cannot be serialized - we cannot cache its result
+		return nullptr;
+	}
+	return result;
+}
+
+unique_ptr<QueryResultCacheKey> QueryResultCache::GetKey(ClientContext &context, const QueryResultCacheInfo &info,
+                                                         const bound_parameter_map_t &values) {
+	auto &meta_transaction = MetaTransaction::Get(context);
+	if (meta_transaction.ModifiedDatabase()) {
+		// the transaction has (potentially) made changes that are not visible to other transactions
+		return nullptr;
+	}
+	auto result = make_uniq<QueryResultCacheKey>();
+	for (auto &table_ref : info.tables) {
+		auto table = table_ref.lock();
+		if (!table) {
+			return nullptr;
+		}
+		auto commit_id = table->GetLastCommitId();
+		auto &transaction = DuckTransaction::Get(context, table->GetDB());
+		if (commit_id >= transaction.start_time) {
+			// the most recent changes to this table are not visible to the transaction
+			return nullptr;
+		}
+		QueryResultCacheTableVersion version;
+		version.table = table;
+		version.commit_id = commit_id;
+		result->tables.push_back(std::move(version));
+	}
+
+	// the key consists of the plan and the values of all parameters (in a deterministic order)
+	MemoryStream stream(Allocator::Get(context));
+	BinarySerializer serializer(stream);
+	serializer.Begin();
+	vector<string> identifiers;
+	for (auto &entry : values) {
+		identifiers.push_back(entry.first);
+	}
+	std::sort(identifiers.begin(), identifiers.end());
+	serializer.WriteList(100, "parameters", identifiers.size(), [&](Serializer::List &list, idx_t i) {
+		auto &identifier = identifiers[i];
+		auto &data = values.find(identifier)->second;
+		list.WriteObject([&](Serializer &object) {
+			object.WriteProperty(100, "identifier", identifier);
+			object.WriteProperty(101, "value", data->GetValue());
+		});
+	});
+	// the result of a query can depend on settings without this being visible in the serialized plan (e.g. the ICU
+	// TIMESTAMPTZ -> VARCHAR cast captures the TimeZone, the default collation or approximate_holistic_aggregates
+	// change how the plan is bound or executed) - so the current value of every setting is part of the key
+	auto &config = DBConfig::GetConfig(context);
+	vector<string> extension_settings;
+	for (auto &entry : config.extension_parameters) {
+		extension_settings.push_back(entry.first);
+	}
+	std::sort(extension_settings.begin(), extension_settings.end());
+	auto option_count = DBConfig::GetOptionCount();
+	serializer.WriteList(101, "settings", option_count + extension_settings.size(),
+	                     [&](Serializer::List &list, idx_t i) {
+		                     Value setting_value;
+		                     if (i < option_count) {
+			                     setting_value = DBConfig::GetOptionByIndex(i)->get_setting(context);
+		                     } else {
+			                     context.TryGetCurrentSetting(extension_settings[i - option_count], setting_value);
+		                     }
+		                     list.WriteElement(setting_value);
+	                     });
+	serializer.End();
+	result->key = info.plan + string(char_ptr_cast(stream.GetData()), stream.GetPosition());
+	return result;
+}
+
+//===--------------------------------------------------------------------===//
+// Cache Operations
+//===--------------------------------------------------------------------===//
+bool QueryResultCache::TableVersionsMatch(const vector<QueryResultCacheTableVersion> &left,
+                                          const vector<QueryResultCacheTableVersion> &right) {
+	if (left.size() != right.size()) {
+		return false;
+	}
+	for (idx_t i = 0; i < left.size(); i++) {
+		if (left[i].commit_id != right[i].commit_id) {
+			return false;
+		}
+		auto left_table = left[i].table.lock();
+		if (!left_table || left_table != right[i].table.lock()) {
+			return false;
+		}
+	}
+	return true;
+}
+
+shared_ptr<ColumnDataCollection> QueryResultCache::Lookup(const QueryResultCacheKey &key) {
+	lock_guard<mutex> guard(lock);
+	auto entry = entry_map.find(key.key);
+	if (entry == entry_map.end()) {
+		miss_count++;
+		return nullptr;
+	}
+	auto cache_entry = entry->second;
+	if (!TableVersionsMatch(cache_entry->tables, key.tables)) {
+		// one of the underlying tables has been modified since the result was cached
+		// table versions only move forward - so this entry can never be used again
+		EraseEntry(cache_entry);
+		miss_count++;
+		return nullptr;
+	}
+	hit_count++;
+	// move the entry to the front of the LRU list
+	entries.splice(entries.begin(), entries, cache_entry);
+	return cache_entry->result;
+}
+
+void QueryResultCache::Store(const QueryResultCacheKey &key, ColumnDataCollection &result) {
+	auto max_memory = db.config.options.query_result_cache_max_memory;
+	if (result.SizeInBytes() > max_memory) {
+		return;
+	}
+	// copy the result into a buffer-managed collection so it is accounted for (and can be evicted) by the buffer pool
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	auto collection = make_shared_ptr<ColumnDataCollection>(buffer_manager, result.Types());
+	ColumnDataAppendState append_state;
+	collection->InitializeAppend(append_state);
+	for (auto &chunk : result.Chunks()) {
+		collection->Append(append_state, chunk);
+	}
+	auto size = collection->AllocationSize() + key.key.size();
+	if (size > max_memory) {
+		return;
+	}
+
+	lock_guard<mutex> guard(lock);
+	auto existing = entry_map.find(key.key);
+	if (existing != entry_map.end()) {
+		EraseEntry(existing->second);
+	}
+	EvictEntries(max_memory - size);
+
+	CacheEntry entry;
+	entry.key = key.key;
+	entry.tables = key.tables;
+	entry.result = std::move(collection);
+	entry.size = size;
+	entries.push_front(std::move(entry));
+	entry_map[key.key] = entries.begin();
+	memory_usage += size;
+}
+
+void QueryResultCache::EraseEntry(entry_iterator_t entry) {
+	D_ASSERT(memory_usage >= entry->size);
+	memory_usage -= entry->size;
+	entry_map.erase(entry->key);
+	entries.erase(entry);
+}
+
+void QueryResultCache::EvictEntries(idx_t max_memory) {
+	while (memory_usage > max_memory && !entries.empty()) {
+		auto last = entries.end();
+		--last;
+		EraseEntry(last);
+	}
+}
+
+void QueryResultCache::Clear() {
+	lock_guard<mutex> guard(lock);
+	entries.clear();
+	entry_map.clear();
+	memory_usage = 0;
+}
+
+idx_t QueryResultCache::GetMemoryUsage() {
+	lock_guard<mutex> guard(lock);
+	return memory_usage;
+}
+
+idx_t QueryResultCache::GetEntryCount() {
+	lock_guard<mutex> guard(lock);
+	return entries.size();
+}
+
+} // namespace duckdb
@@ -138,6 +138,23 @@ Value AllowUnsignedExtensionsSetting::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(config.options.allow_unsigned_extensions);
 }
 
+//===----------------------------------------------------------------------===//
+// Approximate Holistic Aggregates
+//===----------------------------------------------------------------------===//
+void ApproximateHolisticAggregatesSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto &config = ClientConfig::GetConfig(context);
+	config.approximate_holistic_aggregates = input.GetValue<bool>();
+}
+
+void ApproximateHolisticAggregatesSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).approximate_holistic_aggregates = ClientConfig().approximate_holistic_aggregates;
+}
+
+Value ApproximateHolisticAggregatesSetting::GetSetting(const ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	return Value::BOOLEAN(config.approximate_holistic_aggregates);
+}
+
 //===----------------------------------------------------------------------===//
 // Arrow Large Buffer Size
 //===----------------------------------------------------------------------===//
@@ -225,6 +242,26 @@ Value AutoloadKnownExtensionsSetting::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(config.options.autoload_known_extensions);
 }
 
+//===----------------------------------------------------------------------===//
+// Cardinality Feedback Threshold
+//===----------------------------------------------------------------------===//
+void CardinalityFeedbackThresholdSetting::SetLocal(ClientContext &context, const Value &input) {
+	if (!OnLocalSet(context, input)) {
+		return;
+	}
+	auto &config = ClientConfig::GetConfig(context);
+	config.cardinality_feedback_threshold = input.GetValue<double>();
+}
+
+void CardinalityFeedbackThresholdSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).cardinality_feedback_threshold = ClientConfig().cardinality_feedback_threshold;
+}
+
+Value CardinalityFeedbackThresholdSetting::GetSetting(const ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	return Value::DOUBLE(config.cardinality_feedback_threshold);
+}
+
 //===----------------------------------------------------------------------===//
 // Catalog Error Max Schemas
 //===----------------------------------------------------------------------===//
@@ -447,6 +484,23 @@ Value EnableFSSTVectorsSetting::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(config.options.enable_fsst_vectors);
 }
 
+//===----------------------------------------------------------------------===//
+// Enable Fused Expressions
+//===----------------------------------------------------------------------===//
+void EnableFusedExpressionsSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto &config = ClientConfig::GetConfig(context);
+	config.enable_fused_expressions = input.GetValue<bool>();
+}
+
+void EnableFusedExpressionsSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).enable_fused_expressions = ClientConfig().enable_fused_expressions;
+}
+
+Value EnableFusedExpressionsSetting::GetSetting(const ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	return Value::BOOLEAN(config.enable_fused_expressions);
+}
+
 //===----------------------------------------------------------------------===//
 // Enable H T T P Logging
 //===----------------------------------------------------------------------===//
@@ -519,6 +573,28 @@ Value EnableProgressBarSetting::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(config.enable_progress_bar);
 }
 
+//===----------------------------------------------------------------------===//
+// Enable Query Result Cache
+//===----------------------------------------------------------------------===//
+void EnableQueryResultCacheSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	if (!OnGlobalSet(db, config, input)) {
+		return;
+	}
+	config.options.enable_query_result_cache = input.GetValue<bool>();
+}
+
+void EnableQueryResultCacheSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	if (!OnGlobalReset(db, config)) {
+		return;
+	}
+	config.options.enable_query_result_cache = DBConfig().options.enable_query_result_cache;
+}
+
+Value EnableQueryResultCacheSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.enable_query_result_cache);
+}
+
 //===----------------------------------------------------------------------===//
 // Enable View Dependencies
 //===----------------------------------------------------------------------===//
@@ -21,6 +21,7 @@
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/query_profiler.hpp"
+#include "duckdb/main/query_result_cache.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parser.hpp"
@@ -262,6 +263,17 @@ Value ArrowLargeBufferSizeSetting::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(export_large_buffers_arrow);
 }
 
+//===----------------------------------------------------------------------===//
+// Cardinality Feedback Threshold
+//===----------------------------------------------------------------------===//
+bool CardinalityFeedbackThresholdSetting::OnLocalSet(ClientContext &context, const Value &input) {
+	auto threshold = input.GetValue<double>();
+	if (threshold != 0 && threshold < 1.0) {
+		throw InvalidInputException("the cardinality feedback threshold must be 0 (disabled) or at least 1");
+	}
+	return true;
+}
+
 //===----------------------------------------------------------------------===//
 // Checkpoint Threshold
 //===----------------------------------------------------------------------===//
@@ -881,6 +893,24 @@ bool EnableProgressBarSetting::OnLocalReset(ClientContext &context) {
 	return true;
 }
 
+//===----------------------------------------------------------------------===//
+// Enable Query Result Cache
+//===----------------------------------------------------------------------===//
+bool EnableQueryResultCacheSetting::OnGlobalSet(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	if (db && !input.GetValue<bool>()) {
+		// drop all cached results when the cache is disabled
+		QueryResultCache::Get(*db).Clear();
+	}
+	return true;
+}
+
+bool EnableQueryResultCacheSetting::OnGlobalReset(DatabaseInstance *db, DBConfig &config) {
+	if (db) {
+		QueryResultCache::Get(*db).Clear();
+	}
+	return true;
+}
+
 //===----------------------------------------------------------------------===//
 // External Threads
 //===----------------------------------------------------------------------===//
@@ -1214,6 +1244,30 @@ Value ProgressBarTimeSetting::GetSetting(const ClientContext &context) {
 	return Value::BIGINT(ClientConfig::GetConfig(context).wait_time);
 }
 
+//===----------------------------------------------------------------------===//
+// Query Result Cache Max Memory
+//===----------------------------------------------------------------------===//
+void QueryResultCacheMaxMemorySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto max_memory = DBConfig::ParseMemoryLimit(input.ToString());
+	if (db) {
+		// evict entries that no longer fit by clearing the cache
+		QueryResultCache::Get(*db).Clear();
+	}
+	config.options.query_result_cache_max_memory = max_memory;
+}
+
+void QueryResultCacheMaxMemorySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	if (db) {
+		QueryResultCache::Get(*db).Clear();
+	}
+	config.options.query_result_cache_max_memory = DBConfig().options.query_result_cache_max_memory;
+}
+
+Value QueryResultCacheMaxMemorySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(StringUtil::BytesToHumanReadableString(config.options.query_result_cache_max_memory));
+}
+
 //===----------------------------------------------------------------------===//
 // Schema
 //===----------------------------------------------------------------------===//
@@ -0,0 +1,339 @@
+#include "duckdb/optimizer/aggregate_pushdown.hpp"
+
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
+#include "duckdb/function/function_binder.hpp"
+#include "duckdb/optimizer/column_binding_replacer.hpp"
+#include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_cast_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+
+namespace duckdb {
+
+AggregatePushdown::AggregatePushdown(Optimizer &optimizer) : optimizer(optimizer) {
+}
+
+void AggregatePushdown::Optimize(unique_ptr<LogicalOperator> &op) {
+	if (op->type == LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY) {
+		TryPushdownAggregate(op);
+	}
+	VisitOperator(*op);
+}
+
+void AggregatePushdown::StandardVisitOperator(LogicalOperator &op) {
+	for (auto &child : op.children) {
+		Optimize(child);
+	}
+	if (!aggregate_map.empty()) {
+		VisitOperatorExpressions(op);
+	}
+}
+
+void AggregatePushdown::VisitOperator(LogicalOperator &op) {
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_UNION:
+	case LogicalOperatorType::LOGICAL_EXCEPT:
+	case LogicalOperatorType::LOGICAL_INTERSECT:
+	case LogicalOperatorType::LOGICAL_MATERIALIZED_CTE:
+	case LogicalOperatorType::LOGICAL_PROJECTION: {
+		AggregatePushdown aggregate_pushdown(optimizer);
+		aggregate_pushdown.StandardVisitOperator(op);
+		return;
+	}
+	default:
+		break;
+	}
+
+	StandardVisitOperator(op);
+}
+
+unique_ptr<Expression> AggregatePushdown::VisitReplace(BoundColumnRefExpression &expr,
+                                                       unique_ptr<Expression> *expr_ptr) {
+	// check if this column ref points to an aggregate that was remapped; if it does we remap it
+	auto entry = aggregate_map.find(expr.binding);
+	if (entry != aggregate_map.end()) {
+		expr.binding = entry->second;
+	}
+	return nullptr;
+}
+
+static bool IsDecomposableAggregate(const BoundAggregateExpression &aggr) {
+	if (aggr.IsDistinct() || aggr.filter || aggr.order_bys || aggr.IsVolatile()) {
+		return false;
+	}
+	auto &name = aggr.function.name;
+	if (name == "count_star") {
+		return aggr.children.empty();
+	}
+	if (name == "sum" || name == "count" || name == "min" || name == "max") {
+		return aggr.children.size() == 1;
+	}
+	return false;
+}
+
+static void EnumerateColumnReferences(Expression &expr,
+                                      const std::function<void(BoundColumnRefExpression &colref)> &callback) {
+	if (expr.GetExpressionClass() == ExpressionClass::BOUND_COLUMN_REF) {
+		callback(expr.Cast<BoundColumnRefExpression>());
+	}
+	ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) { EnumerateColumnReferences(child, callback); });
+}
+
+static bool ReferencesOnly(Expression &expr, const column_binding_set_t &bindings) {
+	bool result = true;
+	EnumerateColumnReferences(expr, [&](BoundColumnRefExpression &colref) {
+		if (bindings.find(colref.binding) == bindings.end()) {
+			result = false;
+		}
+	});
+	return result;
+}
+
+static optional_ptr<LogicalGet> FindGet(LogicalOperator &op, idx_t table_index) {
+	if (op.type == LogicalOperatorType::LOGICAL_GET) {
+		auto &get = op.Cast<LogicalGet>();
+		if (get.table_index == table_index) {
+			return &get;
+		}
+	}
+	for (auto &child : op.children) {
+		auto result = FindGet(*child, table_index);
+		if (result) {
+			return result;
+		}
+	}
+	return nullptr;
+}
+
+static idx_t GetCardinality(ClientContext &context, LogicalOperator &op) {
+	if (op.has_estimated_cardinality) {
+		return op.estimated_cardinality;
+	}
+	return op.EstimateCardinality(context);
+}
+
+optional_idx AggregatePushdown::EstimateGroupCount(LogicalOperator &op, const vector<ColumnBinding> &bindings) {
+	auto &context = optimizer.context;
+	double group_count = 1;
+	for (auto &binding : bindings) {
+		// we can only estimate the number of groups for columns that come straight from a table scan
+		auto get = FindGet(op, binding.table_index);
+		if (!get || !get->GetTable() || !get->function.statistics) {
+			return optional_idx();
+		}
+		auto &column_ids = get->GetColumnIds();
+		auto column_idx = get->projection_ids.empty() ? binding.column_index : get->projection_ids[binding.column_index];
+		if (column_idx >= column_ids.size()) {
+			return optional_idx();
+		}
+		auto column_id = column_ids[column_idx].GetPrimaryIndex();
+		if (column_id >= get->names.size()) {
+			// virtual column (e.g. rowid)
+			return optional_idx();
+		}
+		auto column_stats = get->function.statistics(context, get->bind_data.get(), column_id);
+		if (!column_stats) {
+			return optional_idx();
+		}
+		group_count *= static_cast<double>(MaxValue<idx_t>(column_stats->GetDistinctCount(), 1));
+	}
+	auto cardinality = static_cast<double>(GetCardinality(context, op));
+	return optional_idx(static_cast<idx_t>(MinValue<double>(group_count, cardinality)));
+}
+
+static unique_ptr<Expression> BindSum(ClientContext &context, unique_ptr<Expression> child) {
+	auto entry = Catalog::GetEntry<AggregateFunctionCatalogEntry>(context, SYSTEM_CATALOG, DEFAULT_SCHEMA, "sum",
+	                                                              OnEntryNotFound::RETURN_NULL);
+	if (!entry) {
+		return nullptr;
+	}
+	FunctionBinder function_binder(context);
+	ErrorData error;
+	vector<LogicalType> types {child->return_type};
+	auto best_function = function_binder.BindFunction(entry->name, entry->functions, types, error);
+	if (!best_function.IsValid()) {
+		return nullptr;
+	}
+	auto bound_function = entry->functions.GetFunctionByOffset(best_function.GetIndex());
+	vector<unique_ptr<Expression>> children;
+	children.push_back(std::move(child));
+	return function_binder.BindAggregateFunction(bound_function, std::move(children), nullptr,
+	                                             AggregateType::NON_DISTINCT);
+}
+
+bool AggregatePushdown::PushdownAggregate(unique_ptr<LogicalOperator> &op, idx_t side) {
+	auto &context = optimizer.context;
+	auto &aggr = op->Cast<LogicalAggregate>();
+	auto &join = aggr.children[0]->Cast<LogicalComparisonJoin>();
+	auto &child = join.children[side];
+	if (child->type == LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY) {
+		// already aggregated
+		return false;
+	}
+
+	child->ResolveOperatorTypes();
+	auto child_bindings = child->GetColumnBindings();
+	column_binding_set_t child_binding_set;
+	column_binding_map_t<LogicalType> child_types;
+	for (idx_t col_idx = 0; col_idx < child_bindings.size(); col_idx++) {
+		child_binding_set.insert(child_bindings[col_idx]);
+		child_types[child_bindings[col_idx]] = child->types[col_idx];
+	}
+	// the inputs of all aggregates must come from this side of the join
+	for (auto &expr : aggr.expressions) {
+		if (!ReferencesOnly(*expr, child_binding_set)) {
+			return false;
+		}
+	}
+
+	// the partial aggregate groups on the columns of this side that are required above the join
+	vector<ColumnBinding> group_bindings;
+	column_binding_set_t group_binding_set;
+	auto add_group_bindings = [&](Expression &expr) {
+		EnumerateColumnReferences(expr, [&](BoundColumnRefExpression &colref) {
+			if (child_binding_set.find(colref.binding) == child_binding_set.end()) {
+				return;
+			}
+			if (group_binding_set.insert(colref.binding).second) {
+				group_bindings.push_back(colref.binding);
+			}
+		});
+	};
+	for (auto &cond : join.conditions) {
+		add_group_bindings(side == 0 ? *cond.left : *cond.right);
+	}
+	for (auto &group : aggr.groups) {
+		add_group_bindings(*group);
+	}
+	if (group_bindings.empty()) {
+		return false;
+	}
+
+	// only pre-aggregate if this significantly reduces the number of rows that go into the join
+	auto group_count = EstimateGroupCount(*child, group_bindings);
+	if (!group_count.IsValid()) {
+		return false;
+	}
+	auto input_count = GetCardinality(context, *child);
+	if (group_count.GetIndex() * MIN_REDUCTION_FACTOR > input_count) {
+		return false;
+	}
+
+	// create the partial and final aggregates
+	auto group_index = optimizer.binder.GenerateTableIndex();
+	auto aggregate_index = optimizer.binder.GenerateTableIndex();
+	vector<unique_ptr<Expression>> partial_aggregates;
+	vector<unique_ptr<Expression>> final_aggregates;
+	for (idx_t aggr_idx = 0; aggr_idx < aggr.expressions.size(); aggr_idx++) {
+		auto &aggr_expr = aggr.expressions[aggr_idx]->Cast<BoundAggregateExpression>();
+		auto partial_aggregate = aggr_expr.Copy();
+		auto partial_ref =
+		    make_uniq<BoundColumnRefExpression>(partial_aggregate->return_type, ColumnBinding(aggregate_index, aggr_idx));
+		unique_ptr<Expression> final_aggregate;
+		if (aggr_expr.function.name == "min" || aggr_expr.function.name == "max") {
+			// min/max of the partial min/max
+			final_aggregate = aggr_expr.Copy();
+			final_aggregate->Cast<BoundAggregateExpression>().children[0] = std::move(partial_ref);
+		} else {
+			// sum of the partial sums/counts
+			final_aggregate = BindSum(context, std::move(partial_ref));
+			if (!final_aggregate) {
+				return false;
+			}
+		}
+		partial_aggregates.push_back(std::move(partial_aggregate));
+		final_aggregates.push_back(std::move(final_aggregate));
+	}
+
+	// push the partial aggregate into the join
+	auto partial_aggr = make_uniq<LogicalAggregate>(group_index, aggregate_index, std::move(partial_aggregates));
+	for (auto &binding : group_bindings) {
+		partial_aggr->groups.push_back(make_uniq<BoundColumnRefExpression>(child_types[binding], binding));
+	}
+	partial_aggr->children.push_back(std::move(child));
+	partial_aggr->SetEstimatedCardinality(group_count.GetIndex());
+	partial_aggr->ResolveOperatorTypes();
+	child = std::move(partial_aggr);
+
+	// the join and the groups of the aggregate now reference the groups of the partial aggregate
+	ColumnBindingReplacer replacer;
+	for (idx_t group_idx = 0; group_idx < group_bindings.size(); group_idx++) {
+		replacer.replacement_bindings.emplace_back(group_bindings[group_idx], ColumnBinding(group_index, group_idx));
+	}
+	replacer.stop_operator = child.get();
+	replacer.VisitOperator(*op);
+
+	// replace the aggregates with the final aggregates
+	bool types_changed = false;
+	vector<LogicalType> original_types;
+	for (idx_t aggr_idx = 0; aggr_idx < aggr.expressions.size(); aggr_idx++) {
+		original_types.push_back(aggr.expressions[aggr_idx]->return_type);
+		if (final_aggregates[aggr_idx]->return_type != original_types.back()) {
+			types_changed = true;
+		}
+		aggr.expressions[aggr_idx] = std::move(final_aggregates[aggr_idx]);
+	}
+	aggr.ResolveOperatorTypes();
+	if (!types_changed) {
+		return true;
+	}
+
+	// the sum of the partial counts has a different type than the count - cast it back in a projection
+	vector<unique_ptr<Expression>> projection_expressions;
+	auto proj_index = optimizer.binder.GenerateTableIndex();
+	auto aggr_bindings = aggr.GetColumnBindings();
+	for (idx_t col_idx = 0; col_idx < aggr_bindings.size(); col_idx++) {
+		auto &binding = aggr_bindings[col_idx];
+		aggregate_map[binding] = ColumnBinding(proj_index, col_idx);
+		unique_ptr<Expression> expr = make_uniq<BoundColumnRefExpression>(aggr.types[col_idx], binding);
+		if (binding.table_index == aggr.aggregate_index) {
+			expr = BoundCastExpression::AddCastToType(context, std::move(expr), original_types[binding.column_index]);
+		}
+		projection_expressions.push_back(std::move(expr));
+	}
+	auto proj = make_uniq<LogicalProjection>(proj_index, std::move(projection_expressions));
+	if (op->has_estimated_cardinality) {
+		proj->SetEstimatedCardinality(op->estimated_cardinality);
+	}
+	proj->children.push_back(std::move(op));
+	proj->ResolveOperatorTypes();
+	op = std::move(proj);
+	return true;
+}
+
+void AggregatePushdown::TryPushdownAggregate(unique_ptr<LogicalOperator> &op) {
+	auto &aggr = op->Cast<LogicalAggregate>();
+	if (aggr.groups.empty() || aggr.grouping_sets.size() > 1 || !aggr.grouping_functions.empty() ||
+	    aggr.expressions.empty()) {
+		// without groups the result of an empty join differs (e.g. COUNT(*) returns 0, not NULL)
+		return;
+	}
+	if (aggr.children[0]->type != LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+		return;
+	}
+	auto &join = aggr.children[0]->Cast<LogicalComparisonJoin>();
+	if (join.join_type != JoinType::INNER || join.HasProjectionMap() || join.conditions.empty()) {
+		return;
+	}
+	for (auto &expr : aggr.expressions) {
+		if (!IsDecomposableAggregate(expr->Cast<BoundAggregateExpression>())) {
+			return;
+		}
+	}
+	// try to pre-aggregate the largest side first
+	auto &context = optimizer.context;
+	idx_t first_side = GetCardinality(context, *join.children[0]) >= GetCardinality(context, *join.children[1]) ? 0 : 1;
+	if (PushdownAggregate(op, first_side)) {
+		return;
+	}
+	PushdownAggregate(op, 1 - first_side);
+}
+
+} // namespace duckdb
@@ -1,5 +1,6 @@
 #include "duckdb/optimizer/column_binding_replacer.hpp"
 
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/planner/expression/bound_columnref_expression.hpp"
 
 namespace duckdb {
@@ -15,6 +16,17 @@ ReplacementBinding::ReplacementBinding(ColumnBinding old_binding, ColumnBinding
 ColumnBindingReplacer::ColumnBindingReplacer() {
 }
 
+void ColumnBindingReplacer::UpdateReplacementIndex() {
+	if (indexed_count > replacement_bindings.size()) {
+		// replacement bindings were removed - rebuild the index
+		replacement_index.clear();
+		indexed_count = 0;
+	}
+	for (; indexed_count < replacement_bindings.size(); indexed_count++) {
+		replacement_index[replacement_bindings[indexed_count].old_binding].push_back(indexed_count);
+	}
+}
+
 void ColumnBindingReplacer::VisitOperator(LogicalOperator &op) {
 	if (stop_operator && stop_operator.get() == &op) {
 		return;
@@ -26,14 +38,26 @@ void ColumnBindingReplacer::VisitOperator(LogicalOperator &op) {
 void ColumnBindingReplacer::VisitExpression(unique_ptr<Expression> *expression) {
 	auto &expr = *expression;
 	if (expr->GetExpressionClass() == ExpressionClass::BOUND_COLUMN_REF) {
+		UpdateReplacementIndex();
 		auto &bound_column_ref = expr->Cast<BoundColumnRefExpression>();
-		for (const auto &replace_binding : replacement_bindings) {
-			if (bound_column_ref.binding == replace_binding.old_binding) {
-				bound_column_ref.binding = replace_binding.new_binding;
-				if (replace_binding.replace_type) {
-					bound_column_ref.return_type = replace_binding.new_type;
-				}
+		// apply the replacements in order: a later replacement can replace the binding we just replaced with
+		idx_t next_idx = 0;
+		while (true) {
+			auto entry = replacement_index.find(bound_column_ref.binding);
+			if (entry == replacement_index.end()) {
+				break;
+			}
+			auto &indexes = entry->second;
+			auto it = std::lower_bound(indexes.begin(), indexes.end(), next_idx);
+			if (it == indexes.end()) {
+				break;
+			}
+			const auto &replace_binding = replacement_bindings[*it];
+			bound_column_ref.binding = replace_binding.new_binding;
+			if (replace_binding.replace_type) {
+				bound_column_ref.return_type = replace_binding.new_type;
 			}
+			next_idx = *it + 1;
 		}
 	}
 
@@ -0,0 +1,440 @@
+#include "duckdb/optimizer/common_subplan_optimizer.hpp"
+
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/common/serializer/binary_serializer.hpp"
+#include "duckdb/common/operator/multiply.hpp"
+#include "duckdb/common/serializer/memory_stream.hpp"
+#include "duckdb/optimizer/column_binding_replacer.hpp"
+#include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
+#include "duckdb/planner/operator/logical_cteref.hpp"
+#include "duckdb/planner/operator/logical_filter.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_materialized_cte.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+CommonSubplanOptimizer::CommonSubplanOptimizer(Optimizer &optimizer_p) : optimizer(optimizer_p), supported(true) {
+}
+
+static void AppendSignature(string &result, const string &signature) {
+	// length-prefix the signature so that the concatenation is unambiguous
+	result += to_string(signature.size());
+	result += ":";
+	result += signature;
+}
+
+//! Creates a copy of an expression in which all column references are replaced by their position in the output of
+//! the children of the operator - so that the expressions of identical operators serialize to the same bytes
+static unique_ptr<Expression> CanonicalizeExpression(const Expression &expr,
+                                                     const column_binding_map_t<idx_t> &positions) {
+	if (expr.IsVolatile()) {
+		// volatile expressions (e.g. random()) cannot be shared
+		return nullptr;
+	}
+	auto result = expr.Copy();
+	bool success = true;
+	ExpressionIterator::EnumerateExpression(result, [&](Expression &child) {
+		child.SetAlias(string());
+		child.SetQueryLocation(optional_idx());
+		if (child.GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
+			return;
+		}
+		auto &colref = child.Cast<BoundColumnRefExpression>();
+		auto entry = positions.find(colref.binding);
+		if (colref.depth > 0 || entry == positions.end()) {
+			success = false;
+			return;
+		}
+		colref.binding = ColumnBinding(0, entry->second);
+	});
+	if (!success) {
+		return nullptr;
+	}
+	return result;
+}
+
+bool CommonSubplanOptimizer::CreateOperatorSignature(LogicalOperator &op, string &result) {
+	column_binding_map_t<idx_t> positions;
+	for (auto &child : op.children) {
+		for (auto &binding : child->GetColumnBindings()) {
+			auto position = positions.size();
+			positions[binding] = position;
+		}
+	}
+	vector<unique_ptr<Expression>> expressions;
+	for (auto &expr : op.expressions) {
+		auto canonical_expr = CanonicalizeExpression(*expr, positions);
+		if (!canonical_expr) {
+			return false;
+		}
+		expressions.push_back(std::move(canonical_expr));
+	}
+
+	try {
+		MemoryStream stream(Allocator::Get(optimizer.context));
+		BinarySerializer serializer(stream);
+		serializer.Begin();
+		serializer.WriteProperty(100, "type", op.type);
+		serializer.WriteProperty(101, "expressions", expressions);
+		switch (op.type) {
+		case LogicalOperatorType::LOGICAL_PROJECTION:
+		case LogicalOperatorType::LOGICAL_CROSS_PRODUCT:
+			break;
+		case LogicalOperatorType::LOGICAL_FILTER: {
+			auto &filter = op.Cast<LogicalFilter>();
+			serializer.WriteProperty(200, "projection_map", filter.projection_map);
+			break;
+		}
+		case LogicalOperatorType::LOGICAL_GET: {
+			auto &get = op.Cast<LogicalGet>();
+			auto table = get.GetTable();
+			if (!table || !get.parameters.empty() || !get.named_parameters.empty() || get.extra_info.sample_options ||
+			    get.dynamic_filters) {
+				// we only share plain table scans
+				return false;
+			}
+			serializer.WriteProperty(200, "catalog", table->ParentCatalog().GetName());
+			serializer.WriteProperty(201, "schema", table->ParentSchema().name);
+			serializer.WriteProperty(202, "table", table->name);
+			serializer.WriteProperty(203, "column_ids", get.GetColumnIds());
+			serializer.WriteProperty(204, "projection_ids", get.projection_ids);
+			serializer.WriteProperty(205, "table_filters", get.table_filters);
+			break;
+		}
+		case LogicalOperatorType::LOGICAL_COMPARISON_JOIN: {
+			auto &join = op.Cast<LogicalComparisonJoin>();
+			if (join.join_type == JoinType::MARK || join.filter_pushdown) {
+				return false;
+			}
+			vector<JoinCondition> conditions;
+			for (auto &cond : join.conditions) {
+				JoinCondition canonical_cond;
+				canonical_cond.left = CanonicalizeExpression(*cond.left, positions);
+				canonical_cond.right = CanonicalizeExpression(*cond.right, positions);
+				canonical_cond.comparison = cond.comparison;
+				if (!canonical_cond.left || !canonical_cond.right) {
+					return false;
+				}
+				conditions.push_back(std::move(canonical_cond));
+			}
+			serializer.WriteProperty(200, "join_type", join.join_type);
+			serializer.WriteProperty(201, "conditions", conditions);
+			serializer.WriteProperty(202, "left_projection_map", join.left_projection_map);
+			serializer.WriteProperty(203, "right_projection_map", join.right_projection_map);
+			break;
+		}
+		case LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY: {
+			auto &aggr = op.Cast<LogicalAggregate>();
+			vector<unique_ptr<Expression>> groups;
+			for (auto &group : aggr.groups) {
+				auto canonical_group = CanonicalizeExpression(*group, positions);
+				if (!canonical_group) {
+					return false;
+				}
+				groups.push_back(std::move(canonical_group));
+			}
+			serializer.WriteProperty(200, "groups", groups);
+			serializer.WriteProperty(201, "grouping_sets", aggr.grouping_sets);
+			serializer.WriteProperty(202, "grouping_functions", aggr.grouping_functions);
+			break;
+		}
+		default:
+			return false;
+		}
+		serializer.End();
+		result = string(char_ptr_cast(stream.GetData()), stream.GetPosition());
+	} catch (std::exception &) {
+		// the operator cannot be serialized - we cannot tell whether or not it is identical to another operator
+		return false;
+	}
+	return true;
+}
+
+idx_t CommonSubplanOptimizer::EnumerateSubplans(unique_ptr<LogicalOperator> &op, idx_t depth) {
+	if (op->type == LogicalOperatorType::LOGICAL_RECURSIVE_CTE) {
+		// the recursive part of a recursive CTE is executed repeatedly - we do not touch these plans
+		supported = false;
+	}
+	SubplanInfo info;
+	info.slot = &op;
+	info.depth = depth;
+	info.size = 1;
+	info.eligible = true;
+	info.expensive = op->type == LogicalOperatorType::LOGICAL_COMPARISON_JOIN ||
+	                 op->type == LogicalOperatorType::LOGICAL_CROSS_PRODUCT ||
+	                 op->type == LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY;
+
+	vector<idx_t> child_indexes;
+	string children_signature;
+	info.signature_id = DConstants::INVALID_INDEX;
+	for (auto &child : op->children) {
+		auto child_idx = EnumerateSubplans(child, depth + 1);
+		auto &child_info = subplans[child_idx];
+		info.size += child_info.size;
+		info.eligible = info.eligible && child_info.eligible;
+		info.expensive = info.expensive || child_info.expensive;
+		if (info.eligible) {
+			AppendSignature(children_signature, to_string(child_info.signature_id));
+		}
+		child_indexes.push_back(child_idx);
+	}
+	string signature;
+	if (info.eligible && CreateOperatorSignature(*op, signature)) {
+		string subplan_signature;
+		AppendSignature(subplan_signature, signature);
+		subplan_signature += children_signature;
+		// identical subplans get the same id, so the signature of the parent only needs the id of each child
+		auto signature_id = signature_ids.size();
+		info.signature_id = signature_ids.emplace(std::move(subplan_signature), signature_id).first->second;
+	} else {
+		info.eligible = false;
+	}
+
+	auto index = subplans.size();
+	subplans.push_back(std::move(info));
+	for (auto &child_idx : child_indexes) {
+		subplans[child_idx].parent = index;
+	}
+	return index;
+}
+
+bool CommonSubplanOptimizer::HasLimitConsumer(idx_t subplan_idx) {
+	// a LIMIT can stop the execution of the subplan early (unless there is a blocking operator in between) - when we
+	// materialize the subplan we always compute its entire result instead
+	auto current = subplans[subplan_idx].parent;
+	while (current.IsValid()) {
+		auto &info = subplans[current.GetIndex()];
+		switch ((*info.slot)->type) {
+		case LogicalOperatorType::LOGICAL_LIMIT:
+		case LogicalOperatorType::LOGICAL_TOP_N:
+			return true;
+		case LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY:
+		case LogicalOperatorType::LOGICAL_ORDER_BY:
+		case LogicalOperatorType::LOGICAL_WINDOW:
+		case LogicalOperatorType::LOGICAL_DISTINCT:
+			return false;
+		default:
+			break;
+		}
+		current = info.parent;
+	}
+	return false;
+}
+
+//! A rough estimate of the cardinality of a subplan - unlike LogicalOperator::EstimateCardinality this does not store
+//! the estimates in the plan, since the join order optimizer has not run yet
+static idx_t EstimateSubplanCardinality(ClientContext &context, LogicalOperator &op, idx_t &input_cardinality) {
+	if (op.type == LogicalOperatorType::LOGICAL_GET) {
+		auto cardinality = op.EstimateCardinality(context);
+		input_cardinality += cardinality;
+		return cardinality;
+	}
+	vector<idx_t> child_cardinalities;
+	for (auto &child : op.children) {
+		child_cardinalities.push_back(EstimateSubplanCardinality(context, *child, input_cardinality));
+	}
+	if (op.has_estimated_cardinality) {
+		return op.estimated_cardinality;
+	}
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY:
+		if (op.Cast<LogicalAggregate>().groups.empty()) {
+			return 1;
+		}
+		break;
+	case LogicalOperatorType::LOGICAL_CROSS_PRODUCT: {
+		idx_t result;
+		if (!TryMultiplyOperator::Operation(child_cardinalities[0], child_cardinalities[1], result)) {
+			return NumericLimits<idx_t>::Maximum();
+		}
+		return result;
+	}
+	default:
+		break;
+	}
+	idx_t result = 0;
+	for (auto &child_cardinality : child_cardinalities) {
+		result = MaxValue(result, child_cardinality);
+	}
+	return result;
+}
+
+bool CommonSubplanOptimizer::MaterializationIsCheaper(idx_t subplan_idx) {
+	auto &op = **subplans[subplan_idx].slot;
+	idx_t input_cardinality = 0;
+	auto cardinality = EstimateSubplanCardinality(optimizer.context, op, input_cardinality);
+	// reading the materialized result should be cheaper than reading the input of the subplan (again)
+	if (cardinality > input_cardinality) {
+		return false;
+	}
+	// the materialized result should fit in memory
+	op.ResolveOperatorTypes();
+	idx_t row_width = 0;
+	for (auto &type : op.types) {
+		row_width += GetTypeIdSize(type.InternalType());
+	}
+	idx_t materialized_size;
+	if (!TryMultiplyOperator::Operation(cardinality, row_width, materialized_size)) {
+		return false;
+	}
+	return materialized_size <= BufferManager::GetBufferManager(optimizer.context).GetQueryMaxMemory();
+}
+
+idx_t CommonSubplanOptimizer::LowestCommonAncestor(const vector<idx_t> &subplan_indexes) {
+	auto result = subplan_indexes[0];
+	for (idx_t i = 1; i < subplan_indexes.size(); i++) {
+		auto other = subplan_indexes[i];
+		while (subplans[result].depth > subplans[other].depth) {
+			result = subplans[result].parent.GetIndex();
+		}
+		while (subplans[other].depth > subplans[result].depth) {
+			other = subplans[other].parent.GetIndex();
+		}
+		while (result != other) {
+			result = subplans[result].parent.GetIndex();
+			other = subplans[other].parent.GetIndex();
+		}
+	}
+	// the CTE is placed above the common ancestor - we move it up through joins and filters so that it does not split
+	// up the join graph that the ancestor is part of
+	while (subplans[result].parent.IsValid()) {
+		auto parent = subplans[result].parent.GetIndex();
+		auto parent_type = (*subplans[parent].slot)->type;
+		if (parent_type != LogicalOperatorType::LOGICAL_COMPARISON_JOIN &&
+		    parent_type != LogicalOperatorType::LOGICAL_CROSS_PRODUCT &&
+		    parent_type != LogicalOperatorType::LOGICAL_FILTER) {
+			break;
+		}
+		result = parent;
+	}
+	return result;
+}
+
+void CommonSubplanOptimizer::MaterializeSubplans(unique_ptr<LogicalOperator> &root,
+                                                 const vector<idx_t> &subplan_indexes) {
+	auto &cte_slot = *subplans[LowestCommonAncestor(subplan_indexes)].slot;
+
+	// replace all occurrences of the subplan with a CTE reference - the first occurrence becomes the CTE definition
+	auto cte_index = optimizer.binder.GenerateTableIndex();
+	unique_ptr<LogicalOperator> definition;
+	ColumnBindingReplacer replacer;
+	for (auto &subplan_idx : subplan_indexes) {
+		auto &slot = *subplans[subplan_idx].slot;
+		slot->ResolveOperatorTypes();
+		auto bindings = slot->GetColumnBindings();
+		vector<string> names;
+		for (idx_t col_idx = 0; col_idx < slot->types.size(); col_idx++) {
+			names.push_back("#" + to_string(col_idx));
+		}
+		auto ref_index = optimizer.binder.GenerateTableIndex();
+		auto cte_ref = make_uniq<LogicalCTERef>(ref_index, cte_index, slot->types, std::move(names),
+		                                        CTEMaterialize::CTE_MATERIALIZE_ALWAYS);
+		if (slot->has_estimated_cardinality) {
+			cte_ref->SetEstimatedCardinality(slot->estimated_cardinality);
+		}
+		cte_ref->ResolveOperatorTypes();
+		for (idx_t col_idx = 0; col_idx < bindings.size(); col_idx++) {
+			replacer.replacement_bindings.emplace_back(bindings[col_idx], ColumnBinding(ref_index, col_idx));
+		}
+		if (!definition) {
+			definition = std::move(slot);
+		}
+		slot = std::move(cte_ref);
+	}
+	// update the references to the columns of the subplans
+	replacer.VisitOperator(*root);
+
+	auto column_count = definition->types.size();
+	auto cte = make_uniq<LogicalMaterializedCTE>("__subplan_" + to_string(cte_index), cte_index, column_count,
+	                                             std::move(definition), std::move(cte_slot));
+	cte->is_shared_subplan = true;
+	cte->ResolveOperatorTypes();
+	cte_slot = std::move(cte);
+}
+
+unique_ptr<LogicalOperator> CommonSubplanOptimizer::Optimize(unique_ptr<LogicalOperator> op) {
+	EnumerateSubplans(op, 0);
+	// the subplans refer to their signatures by id: the signatures themselves are no longer needed
+	signature_ids.clear();
+	if (!supported) {
+		return op;
+	}
+
+	// group the subplans that are worth sharing by their signature
+	unordered_map<idx_t, vector<idx_t>> signature_map;
+	for (idx_t subplan_idx = 0; subplan_idx < subplans.size(); subplan_idx++) {
+		auto &info = subplans[subplan_idx];
+		if (info.eligible && info.expensive) {
+			signature_map[info.signature_id].push_back(subplan_idx);
+		}
+	}
+	vector<vector<idx_t>> candidates;
+	for (auto &entry : signature_map) {
+		if (entry.second.size() > 1) {
+			candidates.push_back(std::move(entry.second));
+		}
+	}
+	if (candidates.empty()) {
+		return op;
+	}
+	// we share the largest subplans first (in a deterministic order)
+	std::sort(candidates.begin(), candidates.end(), [&](const vector<idx_t> &lhs, const vector<idx_t> &rhs) {
+		auto lhs_size = subplans[lhs[0]].size;
+		auto rhs_size = subplans[rhs[0]].size;
+		if (lhs_size != rhs_size) {
+			return lhs_size > rhs_size;
+		}
+		return lhs[0] < rhs[0];
+	});
+
+	vector<idx_t> shared_subplans;
+	vector<vector<idx_t>> materialize;
+	for (auto &candidate : candidates) {
+		vector<idx_t> subplan_indexes;
+		for (auto &subplan_idx : candidate) {
+			// skip occurrences that are part of a subplan that is already shared
+			bool is_shared = false;
+			for (auto &shared_idx : shared_subplans) {
+				if (subplan_idx <= shared_idx && subplan_idx + subplans[shared_idx].size > shared_idx) {
+					is_shared = true;
+					break;
+				}
+			}
+			if (!is_shared && !HasLimitConsumer(subplan_idx)) {
+				subplan_indexes.push_back(subplan_idx);
+			}
+		}
+		if (subplan_indexes.size() < 2 || !MaterializationIsCheaper(subplan_indexes[0])) {
+			continue;
+		}
+		// every occurrence must produce its own set of column bindings, otherwise we cannot tell them apart
+		column_binding_set_t bindings;
+		bool unique_bindings = true;
+		for (auto &subplan_idx : subplan_indexes) {
+			for (auto &binding : (*subplans[subplan_idx].slot)->GetColumnBindings()) {
+				if (!bindings.insert(binding).second) {
+					unique_bindings = false;
+				}
+			}
+		}
+		if (!unique_bindings || bindings.empty()) {
+			continue;
+		}
+		for (auto &subplan_idx : subplan_indexes) {
+			shared_subplans.push_back(subplan_idx);
+		}
+		materialize.push_back(std::move(subplan_indexes));
+	}
+	for (auto &subplan_indexes : materialize) {
+		MaterializeSubplans(op, subplan_indexes);
+	}
+	return op;
+}
+
+} // namespace duckdb
@@ -18,6 +18,7 @@
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/common/operator/subtract.hpp"
+#include "duckdb/common/plan_node_counter.hpp"
 
 namespace duckdb {
 
@@ -108,17 +109,26 @@ void FilterCombiner::GenerateFilters(const std::function<void(unique_ptr<Express
 		callback(std::move(filter));
 	}
 	remaining_filters.clear();
+	// the filters generated from the equivalence sets are new plan nodes: report them to the profiler
+	idx_t generated_filters = 0;
+	auto generate = [&](unique_ptr<Expression> filter) {
+		generated_filters++;
+		callback(std::move(filter));
+	};
 	// now loop over the equivalence sets
 	for (auto &entry : equivalence_map) {
 		auto equivalence_set = entry.first;
 		auto &entries = entry.second;
 		auto &constant_list = constant_values.find(equivalence_set)->second;
 		// for each entry generate an equality expression comparing to each other
+		// for large sets we only compare consecutive entries, which implies the other equalities by transitivity
+		auto pairwise = entries.size() <= MAX_PAIRWISE_EQUIVALENCE_SET;
 		for (idx_t i = 0; i < entries.size(); i++) {
-			for (idx_t k = i + 1; k < entries.size(); k++) {
+			auto comparison_end = pairwise ? entries.size() : MinValue<idx_t>(i + 2, entries.size());
+			for (idx_t k = i + 1; k < comparison_end; k++) {
 				auto comparison = make_uniq<BoundComparisonExpression>(
 				    ExpressionType::COMPARE_EQUAL, entries[i].get().Copy(), entries[k].get().Copy());
-				callback(std::move(comparison));
+				generate(std::move(comparison));
 			}
 			// for each entry also create a comparison with each constant
 			auto lower_index = optional_idx::Invalid();
@@ -139,7 +149,7 @@ void FilterCombiner::GenerateFilters(const std::function<void(unique_ptr<Express
 					auto constant = make_uniq<BoundConstantExpression>(info.constant);
 					auto comparison = make_uniq<BoundComparisonExpression>(
 					    info.comparison_type, entries[i].get().Copy(), std::move(constant));
-					callback(std::move(comparison));
+					generate(std::move(comparison));
 				}
 			}
 			if (lower_index.IsValid() && upper_index.IsValid()) {
@@ -151,24 +161,25 @@ void FilterCombiner::GenerateFilters(const std::function<void(unique_ptr<Express
 				auto between =
 				    make_uniq<BoundBetweenExpression>(entries[i].get().Copy(), std::move(lower_constant),
 				                                      std::move(upper_constant), lower_inclusive, upper_inclusive);
-				callback(std::move(between));
+				generate(std::move(between));
 			} else if (lower_index.IsValid()) {
 				// only lower index found, create simple comparison expression
 				auto constant = make_uniq<BoundConstantExpression>(constant_list[lower_index.GetIndex()].constant);
 				auto comparison =
 				    make_uniq<BoundComparisonExpression>(constant_list[lower_index.GetIndex()].comparison_type,
 				                                         entries[i].get().Copy(), std::move(constant));
-				callback(std::move(comparison));
+				generate(std::move(comparison));
 			} else if (upper_index.IsValid()) {
 				// only upper index found, create simple comparison expression
 				auto constant = make_uniq<BoundConstantExpression>(constant_list[upper_index.GetIndex()].constant);
 				auto comparison =
 				    make_uniq<BoundComparisonExpression>(constant_list[upper_index.GetIndex()].comparison_type,
 				                                         entries[i].get().Copy(), std::move(constant));
-				callback(std::move(comparison));
+				generate(std::move(comparison));
 			}
 		}
 	}
+	PlanNodeCounter::Increment(generated_filters);
 	stored_expressions.clear();
 	equivalence_set_map.clear();
 	constant_values.clear();
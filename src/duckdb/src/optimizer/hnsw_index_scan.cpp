@@ -0,0 +1,218 @@
+#include "duckdb/optimizer/hnsw_index_scan.hpp"
+
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/index/hnsw/hnsw_index.hpp"
+#include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/settings.hpp"
+#include "duckdb/planner/expression/bound_cast_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "duckdb/planner/operator/logical_top_n.hpp"
+#include "duckdb/storage/data_table.hpp"
+
+namespace duckdb {
+
+HNSWIndexScanOptimizer::HNSWIndexScanOptimizer(ClientContext &context) : context(context) {
+}
+
+//! Replaces references to the projections (from the top-most one down) by the projected expressions.
+static unique_ptr<Expression> InlineProjections(unique_ptr<Expression> expr,
+                                                const vector<reference<LogicalProjection>> &projections,
+                                                idx_t depth) {
+	if (expr->GetExpressionClass() == ExpressionClass::BOUND_COLUMN_REF) {
+		auto &column_ref = expr->Cast<BoundColumnRefExpression>();
+		for (idx_t i = depth; i < projections.size(); i++) {
+			auto &projection = projections[i].get();
+			if (column_ref.binding.table_index == projection.table_index) {
+				auto &projected = projection.expressions[column_ref.binding.column_index];
+				return InlineProjections(projected->Copy(), projections, i + 1);
+			}
+		}
+		return expr;
+	}
+	ExpressionIterator::EnumerateChildren(*expr, [&](unique_ptr<Expression> &child) {
+		child = InlineProjections(std::move(child), projections, depth);
+	});
+	return expr;
+}
+
+static bool TryGetMetric(const string &function_name, HNSWMetric &metric) {
+	if (function_name == "array_distance") {
+		// The euclidean distance orders rows like the squared euclidean distance.
+		metric = HNSWMetric::L2SQ;
+		return true;
+	}
+	if (function_name == "array_cosine_distance") {
+		metric = HNSWMetric::COSINE;
+		return true;
+	}
+	if (function_name == "array_negative_inner_product" || function_name == "array_negative_dot_product") {
+		metric = HNSWMetric::INNER_PRODUCT;
+		return true;
+	}
+	return false;
+}
+
+//! Returns the column reference of a FLOAT[n] column, possibly cast to DOUBLE[n], or nullptr.
+static optional_ptr<BoundColumnRefExpression> GetVectorColumn(Expression &expr) {
+	reference<Expression> column = expr;
+	if (column.get().GetExpressionClass() == ExpressionClass::BOUND_CAST) {
+		auto &cast = column.get().Cast<BoundCastExpression>();
+		if (cast.return_type.id() != LogicalTypeId::ARRAY ||
+		    ArrayType::GetChildType(cast.return_type).id() != LogicalTypeId::DOUBLE) {
+			return nullptr;
+		}
+		column = *cast.child;
+	}
+	if (column.get().GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
+		return nullptr;
+	}
+	auto &type = column.get().return_type;
+	if (type.id() != LogicalTypeId::ARRAY || ArrayType::GetChildType(type).id() != LogicalTypeId::FLOAT) {
+		return nullptr;
+	}
+	return &column.get().Cast<BoundColumnRefExpression>();
+}
+
+static bool TryGetQueryVector(ClientContext &context, Expression &expr, idx_t dimensions, vector<float> &query) {
+	if (!expr.IsFoldable()) {
+		return false;
+	}
+	auto value = ExpressionExecutor::EvaluateScalar(context, expr);
+	Value query_value;
+	if (value.IsNull() ||
+	    !value.DefaultTryCastAs(LogicalType::ARRAY(LogicalType::FLOAT, dimensions), query_value, nullptr, false)) {
+		return false;
+	}
+	for (auto &element : ArrayValue::GetChildren(query_value)) {
+		if (element.IsNull()) {
+			return false;
+		}
+		query.push_back(element.GetValue<float>());
+	}
+	return true;
+}
+
+bool HNSWIndexScanOptimizer::TryOptimize(LogicalTopN &top_n) {
+	if (top_n.orders.size() != 1 || top_n.orders[0].type != OrderType::ASCENDING) {
+		return false;
+	}
+
+	// Find the table scan below any projections.
+	vector<reference<LogicalProjection>> projections;
+	reference<LogicalOperator> child = *top_n.children[0];
+	while (child.get().type == LogicalOperatorType::LOGICAL_PROJECTION) {
+		projections.push_back(child.get().Cast<LogicalProjection>());
+		child = *child.get().children[0];
+	}
+	if (child.get().type != LogicalOperatorType::LOGICAL_GET) {
+		return false;
+	}
+	auto &get = child.get().Cast<LogicalGet>();
+	if (get.function.name != "seq_scan" || !get.bind_data || !get.GetTable()) {
+		return false;
+	}
+	// Filters and samples must see all rows, not only the nearest neighbors.
+	if (!get.table_filters.filters.empty() || get.extra_info.sample_options) {
+		return false;
+	}
+	auto &bind_data = get.bind_data->Cast<TableScanBindData>();
+	if (bind_data.hnsw_scan) {
+		return false;
+	}
+
+	// Match the distance function of a column and a constant.
+	auto order_expr = InlineProjections(top_n.orders[0].expression->Copy(), projections, 0);
+	if (order_expr->GetExpressionClass() != ExpressionClass::BOUND_FUNCTION) {
+		return false;
+	}
+	auto &function = order_expr->Cast<BoundFunctionExpression>();
+	HNSWMetric metric;
+	if (function.children.size() != 2 || !TryGetMetric(function.function.name, metric)) {
+		return false;
+	}
+	idx_t column_idx = 0;
+	auto column_ref = GetVectorColumn(*function.children[0]);
+	if (!column_ref) {
+		column_idx = 1;
+		column_ref = GetVectorColumn(*function.children[1]);
+	}
+	if (!column_ref || column_ref->binding.table_index != get.table_index) {
+		return false;
+	}
+
+	// Map the column to its physical index in the table.
+	auto &column_ids = get.GetColumnIds();
+	auto scan_idx = column_ref->binding.column_index;
+	if (!get.projection_ids.empty()) {
+		scan_idx = get.projection_ids[scan_idx];
+	}
+	auto &column_index = column_ids[scan_idx];
+	if (column_index.IsRowIdColumn() || column_index.HasChildren()) {
+		return false;
+	}
+	auto &table = get.GetTable()->Cast<DuckTableEntry>();
+	auto &column = table.GetColumn(column_index.ToLogical());
+	if (column.Generated()) {
+		return false;
+	}
+	auto physical_index = column.StorageOid();
+
+	auto dimensions = ArrayType::GetSize(column_ref->return_type);
+	vector<float> query;
+	if (!TryGetQueryVector(context, *function.children[1 - column_idx], dimensions, query)) {
+		return false;
+	}
+
+	// Fetching more rows than an ART index scan would does not pay off.
+	auto &storage = table.GetStorage();
+	auto &db_config = DBConfig::GetConfig(context);
+	auto scan_percentage = db_config.GetSetting<IndexScanPercentageSetting>(context);
+	auto scan_max_count = db_config.GetSetting<IndexScanMaxCountSetting>(context);
+	auto total_rows = storage.GetTotalRows();
+	auto max_count = MaxValue(scan_max_count, LossyNumericCast<idx_t>(double(total_rows) * scan_percentage));
+	auto limit = top_n.limit + top_n.offset;
+	if (limit == 0 || limit < top_n.limit || limit > max_count) {
+		return false;
+	}
+
+	// Find an HNSW index over the column with the metric of the distance function.
+	string index_name;
+	auto &info = storage.GetDataTableInfo();
+	info->GetIndexes().BindAndScan<HNSWIndex>(context, *info, [&](HNSWIndex &index) {
+		auto &index_columns = index.GetColumnIds();
+		if (index.parameters.metric != metric || index_columns.size() != 1 || index_columns[0] != physical_index ||
+		    index.dimensions != dimensions) {
+			return false;
+		}
+		index_name = index.GetIndexName();
+		return true;
+	});
+	if (index_name.empty()) {
+		return false;
+	}
+
+	auto scan_info = make_uniq<HNSWIndexScanInfo>();
+	scan_info->index_name = index_name;
+	scan_info->query = std::move(query);
+	scan_info->limit = limit;
+	bind_data.hnsw_scan = std::move(scan_info);
+	return true;
+}
+
+unique_ptr<LogicalOperator> HNSWIndexScanOptimizer::Optimize(unique_ptr<LogicalOperator> op) {
+	if (op->type == LogicalOperatorType::LOGICAL_TOP_N) {
+		TryOptimize(op->Cast<LogicalTopN>());
+	}
+	for (auto &child : op->children) {
+		child = Optimize(std::move(child));
+	}
+	return op;
+}
+
+} // namespace duckdb
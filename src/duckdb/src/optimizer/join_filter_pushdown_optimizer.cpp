@@ -153,12 +153,11 @@ void JoinFilterPushdownOptimizer::GenerateJoinFilters(LogicalComparisonJoin &joi
 	case JoinType::LEFT:
 	case JoinType::OUTER:
 	case JoinType::ANTI:
-	case JoinType::RIGHT_ANTI:
-	case JoinType::RIGHT_SEMI:
 		// cannot generate join filters for these join types
 		// mark/single - cannot change cardinality of probe side
 		// left/outer always need to include every row from probe side
-		// FIXME: anti/right_anti - we could do this, but need to invert the join conditions
+		// FIXME: anti - we could do this, but need to invert the join conditions
+		// note that right/right_semi/right_anti are fine: probe rows without a match never contribute to the result
 		return;
 	default:
 		break;
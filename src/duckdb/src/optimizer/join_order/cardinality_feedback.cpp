@@ -0,0 +1,158 @@
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
+
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/main/client_config.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/planner/operator/logical_filter.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/storage/data_table.hpp"
+
+namespace duckdb {
+
+CardinalityFeedback::CardinalityFeedback() {
+}
+
+optional_ptr<CardinalityFeedback> CardinalityFeedback::Get(ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	if (config.cardinality_feedback_threshold <= 0) {
+		return nullptr;
+	}
+	auto &cache = ObjectCache::GetObjectCache(context);
+	auto feedback = cache.GetOrCreate<CardinalityFeedback>(CardinalityFeedback::ObjectType());
+	return feedback.get();
+}
+
+string CardinalityFeedback::GetTableName(TableCatalogEntry &table) {
+	return table.ParentCatalog().GetName() + "." + table.ParentSchema().name + "." + table.name;
+}
+
+string CardinalityFeedback::GetRelationKey(LogicalOperator &op, string &table_name) {
+	vector<string> filters;
+	reference<LogicalOperator> current = op;
+	while (current.get().type != LogicalOperatorType::LOGICAL_GET) {
+		switch (current.get().type) {
+		case LogicalOperatorType::LOGICAL_FILTER:
+			for (auto &expr : current.get().expressions) {
+				filters.push_back(expr->ToString());
+			}
+			break;
+		case LogicalOperatorType::LOGICAL_PROJECTION:
+			break;
+		default:
+			// we only provide feedback for (filtered) base table scans
+			return string();
+		}
+		if (current.get().children.size() != 1) {
+			return string();
+		}
+		current = *current.get().children[0];
+	}
+	auto &get = current.get().Cast<LogicalGet>();
+	auto table = get.GetTable();
+	if (!table || !table->IsDuckTable()) {
+		return string();
+	}
+	if (get.dynamic_filters) {
+		// filters that are pushed into the scan at runtime (e.g. by joins) reduce the cardinality we observe - but
+		// they are not part of the relation when it is planned
+		return string();
+	}
+	for (auto &entry : get.table_filters.filters) {
+		auto &filter = *entry.second;
+		if (filter.filter_type == TableFilterType::DYNAMIC_FILTER) {
+			// the same holds for dynamic filters (e.g. from a TOP N)
+			return string();
+		}
+		if (filter.filter_type == TableFilterType::OPTIONAL_FILTER) {
+			// optional filters do not affect the cardinality - the actual filter is evaluated elsewhere
+			continue;
+		}
+		if (entry.first >= get.names.size()) {
+			return string();
+		}
+		filters.push_back(filter.ToString(get.names[entry.first]));
+	}
+	std::sort(filters.begin(), filters.end());
+
+	// the key includes the last commit to the table - feedback that was observed before the table changed no longer
+	// applies (and is eventually evicted)
+	auto commit_id = table->GetStorage().GetDataTableInfo()->GetLastCommitId();
+	table_name = GetTableName(*table);
+	string result = table_name + "@" + to_string(commit_id);
+	for (auto &filter : filters) {
+		result += "\n" + filter;
+	}
+	return result;
+}
+
+bool CardinalityFeedback::Diverges(idx_t estimate, idx_t actual, double threshold) {
+	if (threshold <= 0) {
+		return false;
+	}
+	auto estimate_d = static_cast<double>(MaxValue<idx_t>(estimate, 1));
+	auto actual_d = static_cast<double>(MaxValue<idx_t>(actual, 1));
+	return MaxValue(estimate_d / actual_d, actual_d / estimate_d) > threshold;
+}
+
+bool CardinalityFeedback::TryGetCardinality(const string &key, idx_t &result) {
+	lock_guard<mutex> guard(lock);
+	auto entry = entry_map.find(key);
+	if (entry == entry_map.end()) {
+		return false;
+	}
+	// move the entry to the front of the LRU list
+	entries.splice(entries.begin(), entries, entry->second);
+	result = entry->second->cardinality;
+	return true;
+}
+
+bool CardinalityFeedback::Record(const string &table_name, const string &key, idx_t cardinality, double threshold) {
+	lock_guard<mutex> guard(lock);
+	auto entry = entry_map.find(key);
+	if (entry != entry_map.end()) {
+		auto &feedback_entry = *entry->second;
+		if (!Diverges(feedback_entry.cardinality, cardinality, threshold)) {
+			// we already know about this relation - no need to re-plan
+			// this also prevents repeatedly re-planning if the feedback is not picked up by the optimizer
+			return false;
+		}
+		feedback_entry.cardinality = cardinality;
+		entries.splice(entries.begin(), entries, entry->second);
+	} else {
+		if (entries.size() >= MAX_ENTRIES) {
+			// evict the least recently used entry
+			entry_map.erase(entries.back().key);
+			entries.pop_back();
+		}
+		FeedbackEntry feedback_entry;
+		feedback_entry.key = key;
+		feedback_entry.cardinality = cardinality;
+		entries.push_front(std::move(feedback_entry));
+		entry_map[key] = entries.begin();
+	}
+	// only the statements that scan this table have to be re-planned
+	table_versions[table_name]++;
+	return true;
+}
+
+idx_t CardinalityFeedback::GetTableVersion(const string &table_name) {
+	lock_guard<mutex> guard(lock);
+	auto entry = table_versions.find(table_name);
+	return entry == table_versions.end() ? 0 : entry->second;
+}
+
+void CardinalityFeedback::GetTableVersions(LogicalOperator &plan, unordered_map<string, idx_t> &result) {
+	if (plan.type == LogicalOperatorType::LOGICAL_GET) {
+		auto table = plan.Cast<LogicalGet>().GetTable();
+		if (table && table->IsDuckTable()) {
+			auto table_name = GetTableName(*table);
+			result[table_name] = GetTableVersion(table_name);
+		}
+	}
+	for (auto &child : plan.children) {
+		GetTableVersions(*child, result);
+	}
+}
+
+} // namespace duckdb
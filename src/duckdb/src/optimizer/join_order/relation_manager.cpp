@@ -3,6 +3,7 @@
 #include "duckdb/common/enums/join_type.hpp"
 #include "duckdb/common/enums/logical_operator_type.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/optimizer/join_order/cardinality_feedback.hpp"
 #include "duckdb/optimizer/join_order/join_order_optimizer.hpp"
 #include "duckdb/optimizer/join_order/relation_statistics_helper.hpp"
 #include "duckdb/parser/expression_map.hpp"
@@ -185,6 +186,29 @@ static void ModifyStatsIfLimit(optional_ptr<LogicalOperator> limit_op, RelationS
 	}
 }
 
+void RelationManager::ApplyCardinalityFeedback(LogicalOperator &op, RelationStats &stats) {
+	auto feedback = CardinalityFeedback::Get(context);
+	if (!feedback) {
+		return;
+	}
+	string table_name;
+	auto key = CardinalityFeedback::GetRelationKey(op, table_name);
+	idx_t observed_cardinality;
+	if (key.empty() || !feedback->TryGetCardinality(key, observed_cardinality)) {
+		return;
+	}
+	// a previous execution observed the actual cardinality of this relation - use it instead of the estimate
+	stats.cardinality = MaxValue<idx_t>(observed_cardinality, 1);
+	reference<LogicalOperator> current = op;
+	while (true) {
+		current.get().SetEstimatedCardinality(stats.cardinality);
+		if (current.get().children.size() != 1) {
+			break;
+		}
+		current = *current.get().children[0];
+	}
+}
+
 bool RelationManager::ExtractJoinRelations(JoinOrderOptimizer &optimizer, LogicalOperator &input_op,
                                            vector<reference<LogicalOperator>> &filter_operators,
                                            optional_ptr<LogicalOperator> parent) {
@@ -357,6 +381,7 @@ bool RelationManager::ExtractJoinRelations(JoinOrderOptimizer &optimizer, Logica
 			    (idx_t)MaxValue(double(stats.cardinality) * RelationStatisticsHelper::DEFAULT_SELECTIVITY, (double)1);
 		}
 		ModifyStatsIfLimit(limit_op.get(), stats);
+		ApplyCardinalityFeedback(input_op, stats);
 		AddRelation(input_op, parent, stats);
 		return true;
 	}
@@ -15,6 +15,7 @@
 #include "duckdb/planner/operator/logical_distinct.hpp"
 #include "duckdb/planner/operator/logical_filter.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_materialized_cte.hpp"
 #include "duckdb/planner/operator/logical_order.hpp"
 #include "duckdb/planner/operator/logical_projection.hpp"
 #include "duckdb/planner/operator/logical_set_operation.hpp"
@@ -306,12 +307,21 @@ void RemoveUnusedColumns::VisitOperator(LogicalOperator &op) {
 		break;
 	}
 	case LogicalOperatorType::LOGICAL_MATERIALIZED_CTE: {
-		everything_referenced = true;
-		break;
+		if (!op.Cast<LogicalMaterializedCTE>().is_shared_subplan) {
+			// user-written CTEs are left as they are
+			everything_referenced = true;
+			break;
+		}
+		// the CTE references read all columns of the CTE definition
+		RemoveUnusedColumns remove(binder, context, true);
+		remove.VisitOperator(*op.children[0]);
+		// the output of the CTE is the output of its second child - we can keep removing unused columns there
+		VisitOperator(*op.children[1]);
+		return;
 	}
 	case LogicalOperatorType::LOGICAL_CTE_REF: {
-		everything_referenced = true;
-		break;
+		// a CTE reference has no children - there is nothing to remove
+		return;
 	}
 	case LogicalOperatorType::LOGICAL_PIVOT: {
 		everything_referenced = true;
@@ -0,0 +1,138 @@
+#include "duckdb/optimizer/rule/contains_disjunction.hpp"
+
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/function/scalar/string_functions.hpp"
+#include "duckdb/planner/expression/bound_conjunction_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+
+namespace duckdb {
+
+ContainsDisjunctionRule::ContainsDisjunctionRule(ExpressionRewriter &rewriter) : Rule(rewriter) {
+	// match on an OR that has a (string) contains among its children
+	auto func = make_uniq<FunctionExpressionMatcher>();
+	func->function = make_uniq<ManyFunctionMatcher>(unordered_set<string> {"contains", InternalContainsAnyFun::Name});
+	func->matchers.push_back(make_uniq<ExpressionMatcher>());
+	func->matchers.push_back(make_uniq<FoldableConstantMatcher>());
+	func->policy = SetMatcher::Policy::SOME_ORDERED;
+
+	auto op = make_uniq<ConjunctionExpressionMatcher>();
+	op->expr_type = make_uniq<SpecificExpressionTypeMatcher>(ExpressionType::CONJUNCTION_OR);
+	op->matchers.push_back(std::move(func));
+	op->policy = SetMatcher::Policy::SOME;
+	root = std::move(op);
+}
+
+struct ContainsDisjunctionGroup {
+	//! The indexes of the OR children searching the haystack
+	vector<idx_t> child_indexes;
+	//! The (shared) string that is searched
+	unique_ptr<Expression> haystack;
+	//! The search strings
+	vector<Value> needles;
+};
+
+static bool IsStringSearch(Expression &expr) {
+	if (expr.GetExpressionClass() != ExpressionClass::BOUND_FUNCTION) {
+		return false;
+	}
+	auto &func = expr.Cast<BoundFunctionExpression>();
+	if (func.function.name != "contains" && func.function.name != InternalContainsAnyFun::Name) {
+		return false;
+	}
+	if (func.children.size() < 2 || func.children[0]->return_type.id() != LogicalTypeId::VARCHAR) {
+		return false;
+	}
+	for (idx_t i = 1; i < func.children.size(); i++) {
+		if (func.children[i]->return_type.id() != LogicalTypeId::VARCHAR || !func.children[i]->IsFoldable()) {
+			return false;
+		}
+	}
+	return true;
+}
+
+unique_ptr<Expression> ContainsDisjunctionRule::Apply(LogicalOperator &op, vector<reference<Expression>> &bindings,
+                                                      bool &changes_made, bool is_root) {
+	auto &conjunction = bindings[0].get().Cast<BoundConjunctionExpression>();
+
+	// group the string searches of the disjunction by the string they search in
+	vector<ContainsDisjunctionGroup> groups;
+	for (idx_t child_idx = 0; child_idx < conjunction.children.size(); child_idx++) {
+		auto &child = *conjunction.children[child_idx];
+		if (!IsStringSearch(child)) {
+			continue;
+		}
+		auto &func = child.Cast<BoundFunctionExpression>();
+		vector<Value> needles;
+		bool all_constant = true;
+		for (idx_t i = 1; i < func.children.size(); i++) {
+			Value needle;
+			if (!ExpressionExecutor::TryEvaluateScalar(GetContext(), *func.children[i], needle) || needle.IsNull()) {
+				// NULL needles are left alone, they affect the NULL semantics of the disjunction
+				all_constant = false;
+				break;
+			}
+			needles.push_back(std::move(needle));
+		}
+		if (!all_constant) {
+			continue;
+		}
+		optional_ptr<ContainsDisjunctionGroup> group;
+		for (auto &entry : groups) {
+			if (entry.haystack->Equals(*func.children[0])) {
+				group = entry;
+				break;
+			}
+		}
+		if (!group) {
+			groups.push_back(ContainsDisjunctionGroup {vector<idx_t>(), func.children[0]->Copy(), vector<Value>()});
+			group = groups.back();
+		}
+		group->child_indexes.push_back(child_idx);
+		for (auto &needle : needles) {
+			group->needles.push_back(std::move(needle));
+		}
+	}
+
+	// replace every group of two or more searches with a single multi-needle search
+	vector<bool> remove_child(conjunction.children.size(), false);
+	bool combined_any = false;
+	for (auto &group : groups) {
+		if (group.child_indexes.size() < 2) {
+			continue;
+		}
+		vector<unique_ptr<Expression>> children;
+		children.push_back(std::move(group.haystack));
+		for (auto &needle : group.needles) {
+			children.push_back(make_uniq<BoundConstantExpression>(std::move(needle)));
+		}
+		auto function = InternalContainsAnyFun::GetFunction();
+		auto bind_info = function.bind(GetContext(), function, children);
+		auto combined = make_uniq<BoundFunctionExpression>(LogicalType::BOOLEAN, std::move(function),
+		                                                   std::move(children), std::move(bind_info));
+		// the combined search takes the place of the first search, the others are removed
+		conjunction.children[group.child_indexes[0]] = std::move(combined);
+		for (idx_t i = 1; i < group.child_indexes.size(); i++) {
+			remove_child[group.child_indexes[i]] = true;
+		}
+		combined_any = true;
+	}
+	if (!combined_any) {
+		return nullptr;
+	}
+
+	vector<unique_ptr<Expression>> remaining_children;
+	for (idx_t child_idx = 0; child_idx < conjunction.children.size(); child_idx++) {
+		if (!remove_child[child_idx]) {
+			remaining_children.push_back(std::move(conjunction.children[child_idx]));
+		}
+	}
+	if (remaining_children.size() == 1) {
+		return std::move(remaining_children[0]);
+	}
+	conjunction.children = std::move(remaining_children);
+	changes_made = true;
+	return nullptr;
+}
+
+} // namespace duckdb
@@ -1,19 +1,29 @@
 #include "duckdb/optimizer/topn_optimizer.hpp"
 
+#include "duckdb/common/case_insensitive_map.hpp"
 #include "duckdb/common/limits.hpp"
+#include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/operator/logical_limit.hpp"
 #include "duckdb/planner/operator/logical_order.hpp"
 #include "duckdb/planner/operator/logical_top_n.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/filter/optional_filter.hpp"
 #include "duckdb/execution/operator/join/join_filter_pushdown.hpp"
 #include "duckdb/optimizer/join_filter_pushdown_optimizer.hpp"
+#include "duckdb/planner/expression/bound_cast_expression.hpp"
 #include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
 
 namespace duckdb {
 
+TopN::TopN(ClientContext &context) : context(context) {
+}
+
 bool TopN::CanOptimize(LogicalOperator &op) {
 	if (op.type == LogicalOperatorType::LOGICAL_LIMIT) {
 		auto &limit = op.Cast<LogicalLimit>();
@@ -39,26 +49,153 @@ bool TopN::CanOptimize(LogicalOperator &op) {
 	return false;
 }
 
+//! Whether a table filter can compare a column of this type against a boundary value
+static bool SupportsDynamicFilter(const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::VARCHAR:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+		return true;
+	default:
+		return TypeIsIntegral(type.InternalType());
+	}
+}
+
+//! Whether the range of a column of this type can be searched for the bound that matches a boundary value
+static bool SupportsColumnRange(const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static bool IsOrderPreservingTemporal(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_SEC:
+	case LogicalTypeId::TIMESTAMP_MS:
+	case LogicalTypeId::TIMESTAMP_NS:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static bool IsOrderPreservingCast(const LogicalType &source, const LogicalType &target) {
+	if (source.IsNumeric() && target.IsNumeric()) {
+		return true;
+	}
+	return IsOrderPreservingTemporal(source) && IsOrderPreservingTemporal(target);
+}
+
+//! Returns the argument that a function is non-decreasing in when all of its other arguments are constant, e.g.
+//! date_trunc(part, ts) is monotonic in "ts" but not in "part", and round(x, digits) is monotonic in "x" only
+static optional_idx GetMonotonicArgument(const string &name) {
+	static const case_insensitive_map_t<idx_t> MONOTONIC_FUNCTIONS {
+	    {"date_trunc", 1}, {"datetrunc", 1}, {"time_bucket", 1}, {"floor", 0},    {"ceil", 0},
+	    {"ceiling", 0},    {"trunc", 0},     {"round", 0},       {"year", 0},     {"epoch", 0},
+	    {"epoch_ms", 0},   {"epoch_us", 0},  {"epoch_ns", 0},    {"to_timestamp", 0}};
+	auto entry = MONOTONIC_FUNCTIONS.find(name);
+	if (entry == MONOTONIC_FUNCTIONS.end()) {
+		return optional_idx();
+	}
+	return entry->second;
+}
+
+//! Returns the column that the expression is a monotonic function of (if any), flipping "decreasing" for every
+//! decreasing step of the expression
+static optional_ptr<BoundColumnRefExpression> GetMonotonicColumn(ClientContext &context, Expression &expr,
+                                                                 bool &decreasing) {
+	switch (expr.GetExpressionClass()) {
+	case ExpressionClass::BOUND_COLUMN_REF:
+		return &expr.Cast<BoundColumnRefExpression>();
+	case ExpressionClass::BOUND_CAST: {
+		auto &cast = expr.Cast<BoundCastExpression>();
+		if (cast.try_cast || !IsOrderPreservingCast(cast.child->return_type, cast.return_type)) {
+			return nullptr;
+		}
+		return GetMonotonicColumn(context, *cast.child, decreasing);
+	}
+	case ExpressionClass::BOUND_FUNCTION: {
+		auto &func = expr.Cast<BoundFunctionExpression>();
+		// the function can have only a single non-constant argument
+		optional_idx arg_idx;
+		for (idx_t i = 0; i < func.children.size(); i++) {
+			if (func.children[i]->IsFoldable()) {
+				continue;
+			}
+			if (arg_idx.IsValid()) {
+				return nullptr;
+			}
+			arg_idx = i;
+		}
+		if (!arg_idx.IsValid()) {
+			return nullptr;
+		}
+		auto &name = func.function.name;
+		auto idx = arg_idx.GetIndex();
+		if (name == "+") {
+			// x + c or c + x
+		} else if (name == "-") {
+			// -x and c - x are decreasing, x - c is increasing
+			if (func.children.size() == 1 || idx == 1) {
+				decreasing = !decreasing;
+			}
+		} else if (name == "*") {
+			// x * c is increasing for positive c and decreasing for negative c
+			if (func.children.size() != 2 || !func.return_type.IsNumeric()) {
+				return nullptr;
+			}
+			Value constant;
+			if (!ExpressionExecutor::TryEvaluateScalar(context, *func.children[1 - idx], constant) ||
+			    !constant.DefaultTryCastAs(LogicalType::DOUBLE)) {
+				return nullptr;
+			}
+			if (constant.IsNull() || constant.GetValue<double>() == 0) {
+				return nullptr;
+			}
+			if (constant.GetValue<double>() < 0) {
+				decreasing = !decreasing;
+			}
+		} else {
+			// every argument other than the monotonic one must be a constant
+			auto monotonic_idx = GetMonotonicArgument(name);
+			if (!monotonic_idx.IsValid() || monotonic_idx.GetIndex() != idx) {
+				return nullptr;
+			}
+		}
+		return GetMonotonicColumn(context, *func.children[idx], decreasing);
+	}
+	default:
+		return nullptr;
+	}
+}
+
 void TopN::PushdownDynamicFilters(LogicalTopN &op) {
 	// pushdown dynamic filters through the Top-N operator
-	if (op.orders[0].null_order == OrderByNullType::NULLS_FIRST) {
-		// FIXME: not supported for NULLS FIRST quite yet
-		// we can support NULLS FIRST by doing (x IS NULL) OR [boundary value]
-		return;
-	}
-	auto &type = op.orders[0].expression->return_type;
-	if (!TypeIsIntegral(type.InternalType()) && type.id() != LogicalTypeId::VARCHAR) {
-		// only supported for integral types currently
+	// with multiple ORDER BY clauses, the boundary of the first clause still bounds the Top-N (non-strictly)
+	auto &order = op.orders[0];
+	bool decreasing = false;
+	auto colref = GetMonotonicColumn(context, *order.expression, decreasing);
+	if (!colref) {
+		// we can only pushdown on ORDER BY [col], or on a monotonic function of a column
 		return;
 	}
-	if (op.orders[0].expression->GetExpressionType() != ExpressionType::BOUND_COLUMN_REF) {
-		// we can only pushdown on ORDER BY [col] currently
+	// if we order on a function of the column, boundary values are mapped back to the column by searching its range
+	const bool map_to_column = order.expression->GetExpressionType() != ExpressionType::BOUND_COLUMN_REF;
+	auto &type = colref->return_type;
+	if (map_to_column ? !SupportsColumnRange(type) : !SupportsDynamicFilter(type)) {
 		return;
 	}
-	auto &colref = op.orders[0].expression->Cast<BoundColumnRefExpression>();
 	vector<JoinFilterPushdownColumn> columns;
 	JoinFilterPushdownColumn column;
-	column.probe_column_index = colref.binding;
+	column.probe_column_index = colref->binding;
 	columns.emplace_back(column);
 	vector<PushdownFilterTarget> pushdown_targets;
 	JoinFilterPushdownOptimizer::GetPushdownFilterTargets(*op.children[0], std::move(columns), pushdown_targets);
@@ -66,9 +203,42 @@ void TopN::PushdownDynamicFilters(LogicalTopN &op) {
 		// no pushdown targets
 		return;
 	}
+	unique_ptr<DynamicFilterColumnRange> column_range;
+	if (map_to_column) {
+		// get the range of the column from the statistics of all pushdown targets
+		column_range = make_uniq<DynamicFilterColumnRange>();
+		column_range->decreasing = decreasing;
+		for (auto &target : pushdown_targets) {
+			auto &get = target.get;
+			if (!get.function.statistics) {
+				return;
+			}
+			auto &column_index = get.GetColumnIds()[target.columns[0].probe_column_index.column_index];
+			if (column_index.IsRowIdColumn()) {
+				return;
+			}
+			auto stats = get.function.statistics(context, get.bind_data.get(), column_index.GetPrimaryIndex());
+			if (!stats || stats->GetType() != type || !NumericStats::HasMinMax(*stats)) {
+				return;
+			}
+			auto min = NumericStats::Min(*stats);
+			auto max = NumericStats::Max(*stats);
+			if (column_range->min.IsNull() || min < column_range->min) {
+				column_range->min = std::move(min);
+			}
+			if (column_range->max.IsNull() || max > column_range->max) {
+				column_range->max = std::move(max);
+			}
+		}
+	}
 	// found pushdown targets! generate dynamic filters
 	ExpressionType comparison_type;
-	if (op.orders[0].type == OrderType::ASCENDING) {
+	if (map_to_column) {
+		// the function can map different column values to the boundary - always filter non-strictly
+		comparison_type = (order.type == OrderType::ASCENDING) != decreasing
+		                      ? ExpressionType::COMPARE_LESSTHANOREQUALTO
+		                      : ExpressionType::COMPARE_GREATERTHANOREQUALTO;
+	} else if (order.type == OrderType::ASCENDING) {
 		// for ascending order, we want the lowest N elements, so we filter on C <= [boundary]
 		// if we only have a single order clause, we can filter on C < boundary
 		comparison_type =
@@ -80,12 +250,20 @@ void TopN::PushdownDynamicFilters(LogicalTopN &op) {
 		    op.orders.size() == 1 ? ExpressionType::COMPARE_GREATERTHAN : ExpressionType::COMPARE_GREATERTHANOREQUALTO;
 	}
 	Value minimum_value = type.InternalType() == PhysicalType::VARCHAR ? Value("") : Value::MinimumValue(type);
-	auto base_filter = make_uniq<ConstantFilter>(comparison_type, std::move(minimum_value));
+	unique_ptr<TableFilter> base_filter = make_uniq<ConstantFilter>(comparison_type, std::move(minimum_value));
+	if (order.null_order == OrderByNullType::NULLS_FIRST) {
+		// NULL values sort before the boundary and always qualify - filter on (C IS NULL) OR (C [cmp] boundary)
+		auto or_filter = make_uniq<ConjunctionOrFilter>();
+		or_filter->child_filters.push_back(make_uniq<IsNullFilter>());
+		or_filter->child_filters.push_back(std::move(base_filter));
+		base_filter = std::move(or_filter);
+	}
 	auto filter_data = make_shared_ptr<DynamicFilterData>();
 	filter_data->filter = std::move(base_filter);
 
 	// put the filter into the Top-N clause
 	op.dynamic_filter = filter_data;
+	op.dynamic_filter_range = std::move(column_range);
 
 	for (auto &target : pushdown_targets) {
 		auto &get = target.get;
@@ -101,6 +101,22 @@ bool BoundWindowExpression::PartitionsAreEquivalent(const BoundWindowExpression
 	return true;
 }
 
+bool BoundWindowExpression::PartitionsAreRefinedBy(const BoundWindowExpression &other) const {
+	if (partitions.empty() || partitions.size() >= other.partitions.size()) {
+		return false;
+	}
+	expression_set_t others;
+	for (const auto &partition : other.partitions) {
+		others.insert(*partition);
+	}
+	for (const auto &partition : partitions) {
+		if (!others.count(*partition)) {
+			return false;
+		}
+	}
+	return true;
+}
+
 idx_t BoundWindowExpression::GetSharedOrders(const vector<BoundOrderByNode> &lhs, const vector<BoundOrderByNode> &rhs) {
 	const auto overlap = MinValue<idx_t>(lhs.size(), rhs.size());
 
@@ -0,0 +1,114 @@
+#include "duckdb/planner/filter/bloom_filter.hpp"
+
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// Bloom Filter Data
+//===--------------------------------------------------------------------===//
+BloomFilterData::BloomFilterData(idx_t key_count) : probed(0), passed(0), disabled(false) {
+	// we use ~16 bits per key
+	auto block_count = NextPowerOfTwo(MaxValue<idx_t>(key_count / 4, 1));
+	blocks.resize(block_count, 0);
+	block_mask = block_count - 1;
+}
+
+BloomFilterData::BloomFilterData(vector<uint64_t> blocks_p, bool disabled_p)
+    : blocks(std::move(blocks_p)), probed(0), passed(0), disabled(disabled_p) {
+	if (blocks.empty() || !IsPowerOfTwo(blocks.size())) {
+		throw SerializationException("Bloom filter block count must be a power of two");
+	}
+	block_mask = blocks.size() - 1;
+}
+
+void BloomFilterData::Insert(Vector &hashes, idx_t count) {
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(count, hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+	for (idx_t i = 0; i < count; i++) {
+		auto hash = hash_data[hdata.sel->get_index(i)];
+		blocks[hash & block_mask] |= GetMask(hash);
+	}
+}
+
+void BloomFilterData::Update(idx_t probed_count, idx_t passed_count) {
+	auto total_probed = probed += probed_count;
+	auto total_passed = passed += passed_count;
+	if (total_probed < MIN_PROBED_TUPLES) {
+		return;
+	}
+	if (static_cast<double>(total_passed) > MAX_PASS_RATIO * static_cast<double>(total_probed)) {
+		// the filter is not selective - checking it is not worth the effort
+		disabled = true;
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Bloom Filter
+//===--------------------------------------------------------------------===//
+BloomFilter::BloomFilter() : TableFilter(TableFilterType::BLOOM_FILTER) {
+}
+
+BloomFilter::BloomFilter(shared_ptr<BloomFilterData> filter_data_p)
+    : TableFilter(TableFilterType::BLOOM_FILTER), filter_data(std::move(filter_data_p)) {
+}
+
+idx_t BloomFilter::Filter(Vector &vector, UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t scan_count,
+                          idx_t approved_tuple_count) const {
+	if (!filter_data || filter_data->IsDisabled() || approved_tuple_count == 0) {
+		return approved_tuple_count;
+	}
+	Vector hashes(LogicalType::HASH, scan_count);
+	VectorOperations::Hash(vector, hashes, scan_count);
+	idx_t result_count = 0;
+	if (hashes.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+		// all values are the same
+		auto hash = *ConstantVector::GetData<hash_t>(hashes);
+		if (!ConstantVector::IsNull(vector) && filter_data->Lookup(hash)) {
+			result_count = approved_tuple_count;
+		}
+	} else {
+		auto hash_data = FlatVector::GetData<hash_t>(hashes);
+		SelectionVector result_sel(approved_tuple_count);
+		for (idx_t i = 0; i < approved_tuple_count; i++) {
+			auto idx = sel.get_index(i);
+			// NULL values never match the keys of an equality join
+			bool found = vdata.validity.RowIsValid(vdata.sel->get_index(idx)) && filter_data->Lookup(hash_data[idx]);
+			result_sel.set_index(result_count, idx);
+			result_count += found;
+		}
+		sel.Initialize(result_sel);
+	}
+	filter_data->Update(approved_tuple_count, result_count);
+	return result_count;
+}
+
+FilterPropagateResult BloomFilter::CheckStatistics(BaseStatistics &stats) {
+	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+}
+
+string BloomFilter::ToString(const string &column_name) {
+	return "Bloom Filter (" + column_name + ")";
+}
+
+unique_ptr<Expression> BloomFilter::ToExpression(const Expression &column) const {
+	// the bloom filter is only a pre-filter - the exact filter is applied elsewhere
+	return make_uniq<BoundConstantExpression>(Value::BOOLEAN(true));
+}
+
+bool BloomFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<BloomFilter>();
+	return other.filter_data.get() == filter_data.get();
+}
+
+unique_ptr<TableFilter> BloomFilter::Copy() const {
+	return make_uniq<BloomFilter>(filter_data);
+}
+
+} // namespace duckdb
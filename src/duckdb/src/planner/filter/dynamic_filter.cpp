@@ -1,5 +1,6 @@
 #include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
 
 namespace duckdb {
@@ -51,12 +52,25 @@ unique_ptr<TableFilter> DynamicFilter::Copy() const {
 	return make_uniq<DynamicFilter>(filter_data);
 }
 
+static ConstantFilter &GetBoundaryFilter(TableFilter &filter) {
+	if (filter.filter_type == TableFilterType::CONJUNCTION_OR) {
+		// (C IS NULL) OR (C [cmp] boundary) - used for NULLS FIRST
+		for (auto &child : filter.Cast<ConjunctionOrFilter>().child_filters) {
+			if (child->filter_type == TableFilterType::CONSTANT_COMPARISON) {
+				return child->Cast<ConstantFilter>();
+			}
+		}
+		throw InternalException("Dynamic OR filter without a constant comparison");
+	}
+	return filter.Cast<ConstantFilter>();
+}
+
 void DynamicFilterData::SetValue(Value val) {
 	if (val.IsNull()) {
 		return;
 	}
 	lock_guard<mutex> l(lock);
-	filter->Cast<ConstantFilter>().constant = std::move(val);
+	GetBoundaryFilter(*filter).constant = std::move(val);
 	initialized = true;
 }
 
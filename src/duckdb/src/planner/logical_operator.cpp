@@ -1,6 +1,7 @@
 #include "duckdb/planner/logical_operator.hpp"
 
 #include "duckdb/common/enum_util.hpp"
+#include "duckdb/common/plan_node_counter.hpp"
 #include "duckdb/common/printer.hpp"
 #include "duckdb/common/serializer/binary_deserializer.hpp"
 #include "duckdb/common/serializer/binary_serializer.hpp"
@@ -17,10 +18,12 @@ namespace duckdb {
 
 LogicalOperator::LogicalOperator(LogicalOperatorType type)
     : type(type), estimated_cardinality(0), has_estimated_cardinality(false) {
+	PlanNodeCounter::Increment();
 }
 
 LogicalOperator::LogicalOperator(LogicalOperatorType type, vector<unique_ptr<Expression>> expressions)
     : type(type), expressions(std::move(expressions)), estimated_cardinality(0), has_estimated_cardinality(false) {
+	PlanNodeCounter::Increment();
 }
 
 LogicalOperator::~LogicalOperator() {
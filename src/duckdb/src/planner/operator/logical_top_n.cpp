@@ -1,5 +1,7 @@
 #include "duckdb/planner/operator/logical_top_n.hpp"
 
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+
 namespace duckdb {
 
 LogicalTopN::LogicalTopN(vector<BoundOrderByNode> orders, idx_t limit, idx_t offset)
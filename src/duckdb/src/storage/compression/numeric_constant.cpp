@@ -142,6 +142,7 @@ void FiltersNullValues(const TableFilter &filter, bool &filters_nulls, bool &fil
 		filters_valid_values = true;
 		break;
 	case TableFilterType::IS_NOT_NULL:
+	case TableFilterType::BLOOM_FILTER:
 		filters_nulls = true;
 		break;
 	default:
@@ -34,7 +34,8 @@ namespace duckdb {
 
 DataTableInfo::DataTableInfo(AttachedDatabase &db, shared_ptr<TableIOManager> table_io_manager_p, string schema,
                              string table)
-    : db(db), table_io_manager(std::move(table_io_manager_p)), schema(std::move(schema)), table(std::move(table)) {
+    : db(db), table_io_manager(std::move(table_io_manager_p)), schema(std::move(schema)), table(std::move(table)),
+      last_commit_id(0) {
 }
 
 void DataTableInfo::InitializeIndexes(ClientContext &context, const char *index_type) {
@@ -256,6 +257,10 @@ vector<PartitionStatistics> DataTable::GetPartitionStats(ClientContext &context)
 	return result;
 }
 
+bool DataTable::HasSortedRowGroups(const StorageIndex &column_index) const {
+	return row_groups->HasSortedRowGroups(column_index.GetPrimaryIndex());
+}
+
 idx_t DataTable::MaxThreads(ClientContext &context) const {
 	idx_t row_group_size = GetRowGroupSize();
 	idx_t parallel_scan_vector_count = row_group_size / STANDARD_VECTOR_SIZE;
@@ -378,6 +383,11 @@ void DataTableInfo::SetTableName(string name) {
 	table = std::move(name);
 }
 
+void DataTableInfo::SetLastCommitId(transaction_t commit_id) {
+	// commits are serialized by the transaction manager - so commit ids only move forward here
+	last_commit_id = commit_id;
+}
+
 string DataTable::GetTableName() const {
 	return info->GetTableName();
 }
@@ -410,6 +420,10 @@ void DataTable::Fetch(DuckTransaction &transaction, DataChunk &result, const vec
 	row_groups->Fetch(transaction, result, column_ids, row_identifiers, fetch_count, state);
 }
 
+bool DataTable::CanFetch(DuckTransaction &transaction, const row_t row_id) {
+	return row_groups->CanFetch(transaction, row_id);
+}
+
 //===--------------------------------------------------------------------===//
 // Append
 //===--------------------------------------------------------------------===//
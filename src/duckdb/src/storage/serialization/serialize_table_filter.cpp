@@ -13,6 +13,7 @@
 #include "duckdb/planner/filter/optional_filter.hpp"
 #include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 
 namespace duckdb {
 
@@ -24,6 +25,9 @@ unique_ptr<TableFilter> TableFilter::Deserialize(Deserializer &deserializer) {
 	auto filter_type = deserializer.ReadProperty<TableFilterType>(100, "filter_type");
 	unique_ptr<TableFilter> result;
 	switch (filter_type) {
+	case TableFilterType::BLOOM_FILTER:
+		result = BloomFilter::Deserialize(deserializer);
+		break;
 	case TableFilterType::CONJUNCTION_AND:
 		result = ConjunctionAndFilter::Deserialize(deserializer);
 		break;
@@ -57,6 +61,28 @@ unique_ptr<TableFilter> TableFilter::Deserialize(Deserializer &deserializer) {
 	return result;
 }
 
+void BloomFilter::Serialize(Serializer &serializer) const {
+	TableFilter::Serialize(serializer);
+	vector<uint64_t> blocks;
+	bool disabled = false;
+	if (filter_data) {
+		blocks = filter_data->GetBlocks();
+		disabled = filter_data->IsDisabled();
+	}
+	serializer.WritePropertyWithDefault<vector<uint64_t>>(200, "blocks", blocks);
+	serializer.WritePropertyWithDefault<bool>(201, "disabled", disabled);
+}
+
+unique_ptr<TableFilter> BloomFilter::Deserialize(Deserializer &deserializer) {
+	auto blocks = deserializer.ReadPropertyWithDefault<vector<uint64_t>>(200, "blocks");
+	auto disabled = deserializer.ReadPropertyWithDefault<bool>(201, "disabled");
+	auto result = duckdb::unique_ptr<BloomFilter>(new BloomFilter());
+	if (!blocks.empty()) {
+		result->filter_data = make_shared_ptr<BloomFilterData>(std::move(blocks), disabled);
+	}
+	return std::move(result);
+}
+
 void ConjunctionAndFilter::Serialize(Serializer &serializer) const {
 	TableFilter::Serialize(serializer);
 	serializer.WritePropertyWithDefault<vector<unique_ptr<TableFilter>>>(200, "child_filters", child_filters);
@@ -83,7 +83,7 @@ static const StorageVersionInfo storage_version_info[] = {
 static_assert(DEFAULT_STORAGE_VERSION_INFO == VERSION_NUMBER, "Check on VERSION_INFO");
 
 // START OF SERIALIZATION VERSION INFO
-const uint64_t LATEST_SERIALIZATION_VERSION_INFO = 4;
+const uint64_t LATEST_SERIALIZATION_VERSION_INFO = 5;
 const uint64_t DEFAULT_SERIALIZATION_VERSION_INFO = 1;
 static const SerializationVersionInfo serialization_version_info[] = {
 	{"v0.10.0", 1},
@@ -96,7 +96,8 @@ static const SerializationVersionInfo serialization_version_info[] = {
 	{"v1.1.2", 3},
 	{"v1.1.3", 3},
 	{"v1.2.0", 4},
-	{"latest", 4},
+	{"v1.3.0", 5},
+	{"latest", 5},
 	{nullptr, 0}
 };
 // END OF SERIALIZATION VERSION INFO
@@ -2,11 +2,13 @@
 #include "duckdb/common/exception/transaction_exception.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/function/compression_function.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/data_pointer.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/statistics/distinct_statistics.hpp"
 #include "duckdb/storage/table/column_data_checkpointer.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
 #include "duckdb/storage/table/list_column_data.hpp"
 #include "duckdb/storage/table/standard_column_data.hpp"
 #include "duckdb/storage/table/array_column_data.hpp"
@@ -344,9 +346,90 @@ idx_t ColumnData::ScanCount(ColumnScanState &state, Vector &result, idx_t scan_c
 	return ScanVector(state, result, scan_count, ScanVectorType::SCAN_FLAT_VECTOR);
 }
 
+//! Whether or not the result of the filter only depends on the filtered value (and not on run-time state)
+static bool IsStaticFilter(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::IS_NULL:
+	case TableFilterType::IS_NOT_NULL:
+		return true;
+	case TableFilterType::CONJUNCTION_AND: {
+		for (auto &child_filter : filter.Cast<ConjunctionAndFilter>().child_filters) {
+			if (!IsStaticFilter(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		for (auto &child_filter : filter.Cast<ConjunctionOrFilter>().child_filters) {
+			if (!IsStaticFilter(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+//! Evaluate the filter once per entry of a dictionary vector (instead of once per row), caching the result across
+//! vectors that share the same dictionary
+static bool TryFilterDictionary(ColumnScanState &state, Vector &result, SelectionVector &sel, idx_t &s_count,
+                                const TableFilter &filter) {
+	static constexpr idx_t MAX_DICTIONARY_SIZE_THRESHOLD = 20000;
+	if (result.GetVectorType() != VectorType::DICTIONARY_VECTOR) {
+		return false;
+	}
+	auto opt_dict_size = DictionaryVector::DictionarySize(result);
+	auto &dictionary_id = DictionaryVector::DictionaryId(result);
+	if (!opt_dict_size.IsValid() || dictionary_id.empty()) {
+		return false;
+	}
+	auto dict_size = opt_dict_size.GetIndex();
+	if (dict_size >= MAX_DICTIONARY_SIZE_THRESHOLD || !IsStaticFilter(filter)) {
+		return false;
+	}
+	auto &dictionary_result = state.filter_dictionary_result;
+	if (state.filter_dictionary_id != dictionary_id || state.filter_dictionary_filter.get() != &filter ||
+	    dictionary_result.size() != dict_size) {
+		// new dictionary - evaluate the filter for all of its entries
+		auto &dictionary = DictionaryVector::Child(result);
+		UnifiedVectorFormat dictionary_data;
+		dictionary.ToUnifiedFormat(dict_size, dictionary_data);
+		SelectionVector dictionary_sel;
+		dictionary_sel.Initialize(nullptr);
+		idx_t dictionary_count = dict_size;
+		ColumnSegment::FilterSelection(dictionary_sel, dictionary, dictionary_data, filter, dict_size,
+		                               dictionary_count);
+		dictionary_result.assign(dict_size, false);
+		for (idx_t i = 0; i < dictionary_count; i++) {
+			dictionary_result[dictionary_sel.get_index(i)] = true;
+		}
+		state.filter_dictionary_id = dictionary_id;
+		state.filter_dictionary_filter = &filter;
+	}
+	// look up the rows in the dictionary result
+	auto &offsets = DictionaryVector::SelVector(result);
+	SelectionVector new_sel(s_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < s_count; i++) {
+		auto idx = sel.get_index(i);
+		new_sel.set_index(result_count, idx);
+		result_count += dictionary_result[offsets.get_index(idx)];
+	}
+	sel.Initialize(new_sel);
+	s_count = result_count;
+	return true;
+}
+
 void ColumnData::Filter(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result,
                         SelectionVector &sel, idx_t &s_count, const TableFilter &filter) {
 	idx_t scan_count = Scan(transaction, vector_index, state, result);
+	if (TryFilterDictionary(state, result, sel, s_count, filter)) {
+		return;
+	}
 
 	UnifiedVectorFormat vdata;
 	result.ToUnifiedFormat(scan_count, vdata);
@@ -1,8 +1,10 @@
 #include "duckdb/storage/table/row_group.hpp"
 #include "duckdb/common/types/vector.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/operator/comparison_operators.hpp"
 #include "duckdb/storage/table/column_data.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
 #include "duckdb/storage/table/update_segment.hpp"
 #include "duckdb/storage/table_storage_info.hpp"
 #include "duckdb/planner/table_filter.hpp"
@@ -28,6 +30,7 @@ namespace duckdb {
 
 RowGroup::RowGroup(RowGroupCollection &collection_p, idx_t start, idx_t count)
     : SegmentBase<RowGroup>(start, count), collection(collection_p), version_info(nullptr), allocation_size(0) {
+	InitializeSorted();
 	Verify();
 }
 
@@ -46,6 +49,13 @@ RowGroup::RowGroup(RowGroupCollection &collection_p, RowGroupPointer pointer)
 	}
 	this->deletes_pointers = std::move(pointer.deletes_pointers);
 	this->deletes_is_loaded = false;
+	InitializeSorted();
+	for (auto &column_idx : pointer.sorted_columns) {
+		if (column_idx >= columns.size()) {
+			throw IOException("Sorted column index is out of range for row group. Corrupt file?");
+		}
+		this->is_sorted[column_idx] = true;
+	}
 
 	Verify();
 }
@@ -62,6 +72,7 @@ RowGroup::RowGroup(RowGroupCollection &collection_p, PersistentRowGroupData &dat
 		entry->InitializeColumn(data.column_data[c]);
 		columns.push_back(std::move(entry));
 	}
+	InitializeSorted();
 
 	Verify();
 }
@@ -150,6 +161,111 @@ void RowGroup::InitializeEmpty(const vector<LogicalType> &types) {
 	for (idx_t i = 0; i < types.size(); i++) {
 		auto column_data = ColumnData::CreateColumn(GetBlockManager(), GetTableInfo(), i, start, types[i]);
 		columns.push_back(std::move(column_data));
+		// an empty row group is trivially sorted - appends keep track of whether it stays sorted
+		is_sorted[i] = count == 0 && SupportsSortedTracking(types[i]);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Sorted Columns
+//===--------------------------------------------------------------------===//
+void RowGroup::InitializeSorted() {
+	auto column_count = collection.get().GetTypes().size();
+	is_sorted = unique_ptr<atomic<bool>[]>(new atomic<bool>[column_count]);
+	for (idx_t c = 0; c < column_count; c++) {
+		is_sorted[c] = false;
+	}
+}
+
+bool RowGroup::SupportsSortedTracking(const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool RowGroup::IsSorted(idx_t column_idx) const {
+	return is_sorted[column_idx];
+}
+
+template <class T>
+static bool IsSortedTemplated(UnifiedVectorFormat &format, idx_t count) {
+	auto data = UnifiedVectorFormat::GetData<T>(format);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = format.sel->get_index(i);
+		if (!format.validity.RowIsValid(idx)) {
+			return false;
+		}
+		if (i > 0 && LessThan::Operation(data[idx], data[format.sel->get_index(i - 1)])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//! Whether the values are non-NULL and non-decreasing
+static bool IsSortedVector(Vector &vector, idx_t count) {
+	UnifiedVectorFormat format;
+	vector.ToUnifiedFormat(count, format);
+	switch (vector.GetType().InternalType()) {
+	case PhysicalType::INT8:
+		return IsSortedTemplated<int8_t>(format, count);
+	case PhysicalType::INT16:
+		return IsSortedTemplated<int16_t>(format, count);
+	case PhysicalType::INT32:
+		return IsSortedTemplated<int32_t>(format, count);
+	case PhysicalType::INT64:
+		return IsSortedTemplated<int64_t>(format, count);
+	case PhysicalType::INT128:
+		return IsSortedTemplated<hugeint_t>(format, count);
+	case PhysicalType::UINT8:
+		return IsSortedTemplated<uint8_t>(format, count);
+	case PhysicalType::UINT16:
+		return IsSortedTemplated<uint16_t>(format, count);
+	case PhysicalType::UINT32:
+		return IsSortedTemplated<uint32_t>(format, count);
+	case PhysicalType::UINT64:
+		return IsSortedTemplated<uint64_t>(format, count);
+	case PhysicalType::UINT128:
+		return IsSortedTemplated<uhugeint_t>(format, count);
+	case PhysicalType::FLOAT:
+		return IsSortedTemplated<float>(format, count);
+	case PhysicalType::DOUBLE:
+		return IsSortedTemplated<double>(format, count);
+	default:
+		throw InternalException("Unsupported type for RowGroup sorted tracking");
+	}
+}
+
+void RowGroup::UpdateSorted(idx_t column_idx, Vector &vector, idx_t append_count) {
+	if (!is_sorted[column_idx] || append_count == 0) {
+		return;
+	}
+	if (!IsSortedVector(vector, append_count)) {
+		is_sorted[column_idx] = false;
+		return;
+	}
+	auto &col_data = GetColumn(column_idx);
+	if (col_data.count == 0) {
+		return;
+	}
+	// the appended values also have to be bigger than the values that are already in the row group
+	auto stats = col_data.GetStatistics();
+	if (!NumericStats::HasMax(*stats) || vector.GetValue(0) < NumericStats::Max(*stats)) {
+		is_sorted[column_idx] = false;
 	}
 }
 
@@ -606,6 +722,7 @@ void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &s
 						// this filter is always true - skip it
 						continue;
 					}
+					const auto input_count = approved_tuple_count;
 
 					const auto scan_idx = filter.scan_column_index;
 					const auto column_idx = filter.table_column_index;
@@ -634,6 +751,7 @@ void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &s
 
 						// Was this filter always true? If so, we dont need to apply it
 						if (prune_result == FilterPropagateResult::FILTER_ALWAYS_TRUE) {
+							adaptive_filter->EndPredicate(filter_state, filter_idx, input_count, input_count);
 							continue;
 						}
 
@@ -648,6 +766,7 @@ void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &s
 						col_data.Filter(transaction, state.vector_index, state.column_scans[scan_idx], result_vector,
 						                sel, approved_tuple_count, filter.filter);
 					}
+					adaptive_filter->EndPredicate(filter_state, filter_idx, input_count, approved_tuple_count);
 				}
 				for (auto &table_filter : filter_list) {
 					if (table_filter.IsAlwaysTrue()) {
@@ -656,6 +775,8 @@ void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &s
 					result.data[table_filter.scan_column_index].Slice(sel, approved_tuple_count);
 				}
 			}
+			// adapt runtime statistics
+			filter_info.EndFilter(filter_state);
 			if (approved_tuple_count == 0) {
 				// all rows were filtered out by the table filters
 				D_ASSERT(has_filters);
@@ -701,8 +822,6 @@ void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &s
 					}
 				}
 			}
-			filter_info.EndFilter(filter_state);
-
 			D_ASSERT(approved_tuple_count > 0);
 			count = approved_tuple_count;
 		}
@@ -887,6 +1006,7 @@ void RowGroup::Append(RowGroupAppendState &state, DataChunk &chunk, idx_t append
 	// append to the current row_group
 	D_ASSERT(chunk.ColumnCount() == GetColumnCount());
 	for (idx_t i = 0; i < GetColumnCount(); i++) {
+		UpdateSorted(i, chunk.data[i], append_count);
 		auto &col_data = GetColumn(i);
 		auto prev_allocation_size = col_data.GetAllocationSize();
 		col_data.Append(state.states[i], chunk.data[i], append_count);
@@ -912,6 +1032,7 @@ void RowGroup::Update(TransactionData transaction, DataChunk &update_chunk, row_
 		D_ASSERT(column.index != COLUMN_IDENTIFIER_ROW_ID);
 		auto &col_data = GetColumn(column.index);
 		D_ASSERT(col_data.type.id() == update_chunk.data[i].GetType().id());
+		is_sorted[column.index] = false;
 		if (offset > 0) {
 			Vector sliced_vector(update_chunk.data[i], offset, offset + count);
 			sliced_vector.Flatten(count);
@@ -932,6 +1053,7 @@ void RowGroup::UpdateColumn(TransactionData transaction, DataChunk &updates, Vec
 	D_ASSERT(primary_column_idx != COLUMN_IDENTIFIER_ROW_ID);
 	D_ASSERT(primary_column_idx < columns.size());
 	auto &col_data = GetColumn(primary_column_idx);
+	is_sorted[primary_column_idx] = false;
 	col_data.UpdateColumn(transaction, column_path, updates.data[0], ids, updates.size(), 1);
 	MergeStatistics(primary_column_idx, *col_data.GetUpdateStatistics());
 }
@@ -1038,6 +1160,11 @@ RowGroupPointer RowGroup::Checkpoint(RowGroupWriteData write_data, RowGroupWrite
 	D_ASSERT(write_data.states.size() == columns.size());
 	row_group_pointer.row_start = start;
 	row_group_pointer.tuple_count = count;
+	for (idx_t column_idx = 0; column_idx < GetColumnCount(); column_idx++) {
+		if (is_sorted[column_idx]) {
+			row_group_pointer.sorted_columns.push_back(column_idx);
+		}
+	}
 	for (auto &state : write_data.states) {
 		// get the current position of the table data writer
 		auto &data_writer = writer.GetPayloadWriter();
@@ -1102,6 +1229,9 @@ void RowGroup::Serialize(RowGroupPointer &pointer, Serializer &serializer) {
 	serializer.WriteProperty(101, "tuple_count", pointer.tuple_count);
 	serializer.WriteProperty(102, "data_pointers", pointer.data_pointers);
 	serializer.WriteProperty(103, "delete_pointers", pointer.deletes_pointers);
+	if (serializer.ShouldSerialize(5)) {
+		serializer.WritePropertyWithDefault(104, "sorted_columns", pointer.sorted_columns);
+	}
 }
 
 RowGroupPointer RowGroup::Deserialize(Deserializer &deserializer) {
@@ -1110,6 +1240,7 @@ RowGroupPointer RowGroup::Deserialize(Deserializer &deserializer) {
 	result.tuple_count = deserializer.ReadProperty<uint64_t>(101, "tuple_count");
 	result.data_pointers = deserializer.ReadProperty<vector<MetaBlockPointer>>(102, "data_pointers");
 	result.deletes_pointers = deserializer.ReadProperty<vector<MetaBlockPointer>>(103, "delete_pointers");
+	deserializer.ReadPropertyWithDefault<vector<idx_t>>(104, "sorted_columns", result.sorted_columns);
 	return result;
 }
 
@@ -305,6 +305,19 @@ void RowGroupCollection::Fetch(TransactionData transaction, DataChunk &result, c
 	result.SetCardinality(count);
 }
 
+bool RowGroupCollection::CanFetch(TransactionData transaction, const row_t row_id) {
+	RowGroup *row_group;
+	{
+		idx_t segment_index;
+		auto l = row_groups->Lock();
+		if (!row_groups->TryGetSegmentIndex(l, UnsafeNumericCast<idx_t>(row_id), segment_index)) {
+			return false;
+		}
+		row_group = row_groups->GetSegmentByIndex(l, UnsafeNumericCast<int64_t>(segment_index));
+	}
+	return row_group->Fetch(transaction, UnsafeNumericCast<idx_t>(row_id) - row_group->start);
+}
+
 //===--------------------------------------------------------------------===//
 // Append
 //===--------------------------------------------------------------------===//
@@ -1105,6 +1118,17 @@ vector<PartitionStatistics> RowGroupCollection::GetPartitionStats() const {
 	return result;
 }
 
+bool RowGroupCollection::HasSortedRowGroups(idx_t column_idx) const {
+	bool has_row_groups = false;
+	for (auto &row_group : row_groups->Segments()) {
+		if (!row_group.IsSorted(column_idx)) {
+			return false;
+		}
+		has_row_groups = true;
+	}
+	return has_row_groups;
+}
+
 //===--------------------------------------------------------------------===//
 // GetColumnSegmentInfo
 //===--------------------------------------------------------------------===//
@@ -157,6 +157,11 @@ void CommitState::CommitEntry(UndoFlags type, data_ptr_t data) {
 		lock_guard<mutex> read_lock(old_entry.set->GetCatalogLock());
 		// Set the timestamp of the catalog entry to the given commit_id, marking it as committed
 		CatalogSet::UpdateTimestamp(old_entry.Parent(), commit_id);
+		if (new_entry.type == CatalogType::TABLE_ENTRY) {
+			// the table was created or altered - mark it as modified
+			auto &table_entry = new_entry.Cast<DuckTableEntry>();
+			table_entry.GetStorage().GetDataTableInfo()->SetLastCommitId(commit_id);
+		}
 
 		// drop any blocks associated with the catalog entry if possible (e.g. in case of a DROP or ALTER)
 		CommitEntryDrop(old_entry, data + sizeof(CatalogEntry *));
@@ -167,6 +172,7 @@ void CommitState::CommitEntry(UndoFlags type, data_ptr_t data) {
 		auto info = reinterpret_cast<AppendInfo *>(data);
 		// mark the tuples as committed
 		info->table->CommitAppend(commit_id, info->start_row, info->count);
+		info->table->GetDataTableInfo()->SetLastCommitId(commit_id);
 		break;
 	}
 	case UndoFlags::DELETE_TUPLE: {
@@ -174,12 +180,14 @@ void CommitState::CommitEntry(UndoFlags type, data_ptr_t data) {
 		auto info = reinterpret_cast<DeleteInfo *>(data);
 		// mark the tuples as committed
 		info->version_info->CommitDelete(info->vector_idx, commit_id, *info);
+		info->table->GetDataTableInfo()->SetLastCommitId(commit_id);
 		break;
 	}
 	case UndoFlags::UPDATE_TUPLE: {
 		// update:
 		auto info = reinterpret_cast<UpdateInfo *>(data);
 		info->version_number = commit_id;
+		info->segment->column_data.GetTableInfo().SetLastCommitId(commit_id);
 		break;
 	}
 	case UndoFlags::SEQUENCE_VALUE: {
@@ -48,6 +48,8 @@
 
 #include "src/common/opener_file_system.cpp"
 
+#include "src/common/plan_node_counter.cpp"
+
 #include "src/common/printer.cpp"
 
 #include "src/common/radix_partitioning.cpp"
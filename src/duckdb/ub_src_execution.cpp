@@ -10,6 +10,8 @@
 
 #include "src/execution/expression_executor_state.cpp"
 
+#include "src/execution/fused_expression.cpp"
+
 #include "src/execution/join_hashtable.cpp"
 
 #include "src/execution/perfect_aggregate_hashtable.cpp"
@@ -0,0 +1,4 @@
+#include "src/execution/index/hnsw/hnsw_index.cpp"
+
+#include "src/execution/index/hnsw/plan_hnsw.cpp"
+
@@ -20,6 +20,8 @@
 
 #include "src/execution/operator/join/physical_nested_loop_join.cpp"
 
+#include "src/execution/operator/join/physical_partitioned_hash_join.cpp"
+
 #include "src/execution/operator/join/perfect_hash_join_executor.cpp"
 
 #include "src/execution/operator/join/physical_piecewise_merge_join.cpp"
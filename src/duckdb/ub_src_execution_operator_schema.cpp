@@ -4,6 +4,8 @@
 
 #include "src/execution/operator/schema/physical_create_art_index.cpp"
 
+#include "src/execution/operator/schema/physical_create_hnsw_index.cpp"
+
 #include "src/execution/operator/schema/physical_create_schema.cpp"
 
 #include "src/execution/operator/schema/physical_create_type.cpp"
@@ -52,6 +52,8 @@
 
 #include "src/main/query_result.cpp"
 
+#include "src/main/query_result_cache.cpp"
+
 #include "src/main/stream_query_result.cpp"
 
 #include "src/main/valid_checker.cpp"
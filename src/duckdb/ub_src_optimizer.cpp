@@ -1,3 +1,5 @@
+#include "src/optimizer/aggregate_pushdown.cpp"
+
 #include "src/optimizer/build_probe_side_optimizer.cpp"
 
 #include "src/optimizer/column_binding_replacer.cpp"
@@ -8,6 +10,8 @@
 
 #include "src/optimizer/common_aggregate_optimizer.cpp"
 
+#include "src/optimizer/common_subplan_optimizer.cpp"
+
 #include "src/optimizer/compressed_materialization.cpp"
 
 #include "src/optimizer/cse_optimizer.cpp"
@@ -26,6 +30,8 @@
 
 #include "src/optimizer/filter_pushdown.cpp"
 
+#include "src/optimizer/hnsw_index_scan.cpp"
+
 #include "src/optimizer/in_clause_rewriter.cpp"
 
 #include "src/optimizer/join_filter_pushdown_optimizer.cpp"
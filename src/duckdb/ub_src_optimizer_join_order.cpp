@@ -8,6 +8,8 @@
 
 #include "src/optimizer/join_order/cardinality_estimator.cpp"
 
+#include "src/optimizer/join_order/cardinality_feedback.cpp"
+
 #include "src/optimizer/join_order/cost_model.cpp"
 
 #include "src/optimizer/join_order/plan_enumerator.cpp"
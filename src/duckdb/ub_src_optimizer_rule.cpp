@@ -8,6 +8,8 @@
 
 #include "src/optimizer/rule/constant_folding.cpp"
 
+#include "src/optimizer/rule/contains_disjunction.cpp"
+
 #include "src/optimizer/rule/date_part_simplification.cpp"
 
 #include "src/optimizer/rule/distinct_aggregate_optimizer.cpp"
@@ -1,3 +1,5 @@
+#include "src/planner/filter/bloom_filter.cpp"
+
 #include "src/planner/filter/conjunction_filter.cpp"
 
 #include "src/planner/filter/constant_filter.cpp"
@@ -4708,6 +4708,1301 @@ public class TestDuckDBJDBC {
         }
     }
 
+    private static long queryLong(Statement stmt, String sql) throws SQLException {
+        try (ResultSet rs = stmt.executeQuery(sql)) {
+            assertTrue(rs.next());
+            long result = rs.getLong(1);
+            assertFalse(rs.next());
+            return result;
+        }
+    }
+
+    private static String queryString(Statement stmt, String sql) throws SQLException {
+        try (ResultSet rs = stmt.executeQuery(sql)) {
+            assertTrue(rs.next());
+            String result = rs.getString(1);
+            assertFalse(rs.next());
+            return result;
+        }
+    }
+
+    private static long queryResultCacheHits(Statement stmt) throws SQLException {
+        return queryLong(stmt, "SELECT hit_count FROM duckdb_query_result_cache()");
+    }
+
+    public static void test_query_result_cache_invalidation() throws Exception {
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement();
+             Connection conn2 = conn.unwrap(DuckDBConnection.class).duplicate();
+             Statement stmt2 = conn2.createStatement()) {
+            stmt.execute("SET enable_query_result_cache = true");
+            stmt.execute("CREATE TABLE t AS SELECT range AS i FROM range(10)");
+
+            assertEquals(queryLong(stmt, "SELECT sum(i) FROM t"), 45L);
+            long hits = queryResultCacheHits(stmt);
+            assertEquals(queryLong(stmt, "SELECT sum(i) FROM t"), 45L);
+            assertEquals(queryResultCacheHits(stmt), hits + 1);
+            // the result is shared between connections
+            assertEquals(queryLong(stmt2, "SELECT sum(i) FROM t"), 45L);
+            assertEquals(queryResultCacheHits(stmt), hits + 2);
+
+            // changes committed by another connection invalidate the cached result
+            stmt2.execute("INSERT INTO t VALUES (10)");
+            assertEquals(queryLong(stmt, "SELECT sum(i) FROM t"), 55L);
+            stmt2.execute("UPDATE t SET i = i + 1 WHERE i = 10");
+            assertEquals(queryLong(stmt, "SELECT sum(i) FROM t"), 56L);
+            stmt2.execute("DELETE FROM t WHERE i = 11");
+            assertEquals(queryLong(stmt, "SELECT sum(i) FROM t"), 45L);
+            stmt2.execute("ALTER TABLE t ALTER i TYPE BIGINT USING i * 2");
+            assertEquals(queryLong(stmt, "SELECT sum(i) FROM t"), 90L);
+
+            hits = queryResultCacheHits(stmt);
+            assertEquals(queryLong(stmt, "SELECT sum(i) FROM t"), 90L);
+            assertEquals(queryResultCacheHits(stmt), hits + 1);
+        }
+    }
+
+    public static void test_query_result_cache_transaction_local_changes() throws Exception {
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement()) {
+            stmt.execute("SET enable_query_result_cache = true");
+            stmt.execute("CREATE TABLE t AS SELECT range AS i FROM range(10)");
+            assertEquals(queryLong(stmt, "SELECT sum(i) FROM t"), 45L);
+
+            conn.setAutoCommit(false);
+            stmt.execute("INSERT INTO t VALUES (10)");
+            // the transaction has local changes - the cache is bypassed
+            long hits = queryResultCacheHits(stmt);
+            assertEquals(queryLong(stmt, "SELECT sum(i) FROM t"), 55L);
+            assertEquals(queryLong(stmt, "SELECT sum(i) FROM t"), 55L);
+            assertEquals(queryResultCacheHits(stmt), hits);
+            conn.rollback();
+            conn.setAutoCommit(true);
+
+            assertEquals(queryLong(stmt, "SELECT sum(i) FROM t"), 45L);
+        }
+    }
+
+    public static void test_query_result_cache_prepared_parameters() throws Exception {
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement()) {
+            stmt.execute("SET enable_query_result_cache = true");
+            stmt.execute("CREATE TABLE t AS SELECT range AS i FROM range(10)");
+
+            try (PreparedStatement ps = conn.prepareStatement("SELECT count(*) FROM t WHERE i < ?")) {
+                ps.setLong(1, 5);
+                try (ResultSet rs = ps.executeQuery()) {
+                    assertTrue(rs.next());
+                    assertEquals(rs.getLong(1), 5L);
+                }
+                ps.setLong(1, 8);
+                try (ResultSet rs = ps.executeQuery()) {
+                    assertTrue(rs.next());
+                    assertEquals(rs.getLong(1), 8L);
+                }
+                long hits = queryResultCacheHits(stmt);
+                ps.setLong(1, 5);
+                try (ResultSet rs = ps.executeQuery()) {
+                    assertTrue(rs.next());
+                    assertEquals(rs.getLong(1), 5L);
+                }
+                assertEquals(queryResultCacheHits(stmt), hits + 1);
+            }
+        }
+    }
+
+    public static void test_query_result_cache_temp_tables() throws Exception {
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement();
+             Connection conn2 = conn.unwrap(DuckDBConnection.class).duplicate();
+             Statement stmt2 = conn2.createStatement()) {
+            stmt.execute("SET enable_query_result_cache = true");
+            stmt.execute("CREATE TEMP TABLE tmp AS SELECT 1 AS i");
+            stmt2.execute("CREATE TEMP TABLE tmp AS SELECT 2 AS i");
+
+            for (int i = 0; i < 2; i++) {
+                assertEquals(queryLong(stmt, "SELECT i FROM tmp"), 1L);
+                assertEquals(queryLong(stmt2, "SELECT i FROM tmp"), 2L);
+            }
+        }
+    }
+
+    public static void test_query_result_cache_settings() throws Exception {
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement()) {
+            stmt.execute("SET enable_query_result_cache = true");
+            stmt.execute("CREATE TABLE t AS SELECT TIMESTAMPTZ '2024-01-01 12:00:00+00' AS ts");
+
+            // the TIMESTAMPTZ -> VARCHAR cast depends on the TimeZone setting
+            stmt.execute("SET TimeZone = 'UTC'");
+            assertEquals(queryString(stmt, "SELECT ts::VARCHAR FROM t"), "2024-01-01 12:00:00+00");
+            assertEquals(queryString(stmt, "SELECT ts::VARCHAR FROM t"), "2024-01-01 12:00:00+00");
+            stmt.execute("SET TimeZone = 'America/New_York'");
+            assertEquals(queryString(stmt, "SELECT ts::VARCHAR FROM t"), "2024-01-01 07:00:00-05");
+
+            // current_setting() is evaluated at bind time
+            assertEquals(queryString(stmt, "SELECT current_setting('TimeZone') FROM t"), "America/New_York");
+            stmt.execute("SET TimeZone = 'UTC'");
+            assertEquals(queryString(stmt, "SELECT current_setting('TimeZone') FROM t"), "UTC");
+
+            // the default collation changes how the comparison is bound
+            stmt.execute("CREATE TABLE s AS SELECT 'abc' AS v");
+            assertEquals(queryLong(stmt, "SELECT count(*) FROM s WHERE v = 'ABC'"), 0L);
+            stmt.execute("SET default_collation = 'nocase'");
+            assertEquals(queryLong(stmt, "SELECT count(*) FROM s WHERE v = 'ABC'"), 1L);
+            stmt.execute("RESET default_collation");
+            assertEquals(queryLong(stmt, "SELECT count(*) FROM s WHERE v = 'ABC'"), 0L);
+        }
+    }
+
+    public static void test_query_result_cache_eviction() throws Exception {
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement()) {
+            stmt.execute("SET enable_query_result_cache = true");
+            stmt.execute("SET query_result_cache_max_memory = '1MB'");
+            stmt.execute("CREATE TABLE t AS SELECT range AS i FROM range(1000)");
+
+            int query_count = 20;
+            for (int i = 0; i < query_count; i++) {
+                assertEquals(queryLong(stmt, "SELECT count(*) FROM t WHERE i < " + i), (long) i);
+            }
+            try (ResultSet rs =
+                     stmt.executeQuery("SELECT entry_count, memory_usage_bytes FROM duckdb_query_result_cache()")) {
+                assertTrue(rs.next());
+                assertTrue(rs.getLong(1) > 0);
+                assertTrue(rs.getLong(1) < query_count);
+                assertTrue(rs.getLong(2) <= 1024 * 1024);
+            }
+
+            // the most recently used result is still cached, the least recently used one was evicted
+            long hits = queryResultCacheHits(stmt);
+            assertEquals(queryLong(stmt, "SELECT count(*) FROM t WHERE i < " + (query_count - 1)),
+                         (long) (query_count - 1));
+            assertEquals(queryResultCacheHits(stmt), hits + 1);
+            assertEquals(queryLong(stmt, "SELECT count(*) FROM t WHERE i < 0"), 0L);
+            assertEquals(queryResultCacheHits(stmt), hits + 1);
+        }
+    }
+
+    private static List<List<Object>> queryRows(Statement stmt, String sql) throws SQLException {
+        List<List<Object>> rows = new ArrayList<>();
+        try (ResultSet rs = stmt.executeQuery(sql)) {
+            int column_count = rs.getMetaData().getColumnCount();
+            while (rs.next()) {
+                List<Object> row = new ArrayList<>();
+                for (int i = 1; i <= column_count; i++) {
+                    row.add(rs.getObject(i));
+                }
+                rows.add(row);
+            }
+        }
+        return rows;
+    }
+
+    private static String explainPlan(Statement stmt, String sql) throws SQLException {
+        try (ResultSet rs = stmt.executeQuery("EXPLAIN " + sql)) {
+            StringBuilder result = new StringBuilder();
+            while (rs.next()) {
+                result.append(rs.getString(2));
+            }
+            return result.toString();
+        }
+    }
+
+    // runs the query with and without the given optimizer, and checks that both produce the same result
+    private static List<List<Object>> assertOptimizerPreservesResult(Statement stmt, String optimizer, String sql)
+        throws Exception {
+        stmt.execute("SET disabled_optimizers = '" + optimizer + "'");
+        List<List<Object>> expected = queryRows(stmt, sql);
+        stmt.execute("RESET disabled_optimizers");
+        List<List<Object>> result = queryRows(stmt, sql);
+        assertEquals(result, expected);
+        return result;
+    }
+
+    public static void test_common_subplan_sharing() throws Exception {
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement()) {
+            stmt.execute("CREATE TABLE a AS SELECT range AS i, range % 7 AS j FROM range(10000)");
+            stmt.execute("CREATE TABLE b AS SELECT range % 1000 AS i, range AS k FROM range(5000)");
+
+            // identical UNION ALL branches
+            String union_query = "SELECT count(*), sum(a.j) FROM a JOIN b USING (i) UNION ALL "
+                                 + "SELECT count(*), sum(a.j) FROM a JOIN b USING (i)";
+            List<List<Object>> rows = assertOptimizerPreservesResult(stmt, "common_subplan", union_query);
+            assertEquals(rows.size(), 2);
+            assertEquals(rows.get(0), rows.get(1));
+            assertTrue(explainPlan(stmt, union_query).contains("__subplan"));
+
+            // a self-join of the same subplan
+            String self_join_query = "SELECT count(*), sum(s1.total - s2.total) FROM "
+                                     + "(SELECT a.i, sum(b.k) AS total FROM a JOIN b USING (i) GROUP BY a.i) s1 JOIN "
+                                     + "(SELECT a.i, sum(b.k) AS total FROM a JOIN b USING (i) GROUP BY a.i) s2 "
+                                     + "ON s1.i = s2.i + 1";
+            rows = assertOptimizerPreservesResult(stmt, "common_subplan", self_join_query);
+            assertEquals(rows.get(0).get(0), 999L);
+            assertTrue(explainPlan(stmt, self_join_query).contains("__subplan"));
+
+            // a LIMIT can stop each branch early - the branches are not materialized
+            String limit_query = "(SELECT a.i FROM a JOIN b USING (i) LIMIT 10) UNION ALL "
+                                 + "(SELECT a.i FROM a JOIN b USING (i) LIMIT 10)";
+            assertEquals(queryRows(stmt, limit_query).size(), 20);
+            assertFalse(explainPlan(stmt, limit_query).contains("__subplan"));
+
+            // plans with a recursive CTE are left alone
+            String recursive_query = "WITH RECURSIVE r(n) AS (SELECT 1 UNION ALL SELECT n + 1 FROM r WHERE n < 3) "
+                                     + "SELECT (SELECT count(*) FROM a JOIN b USING (i)), "
+                                     + "(SELECT count(*) FROM a JOIN b USING (i)), max(n) FROM r";
+            rows = assertOptimizerPreservesResult(stmt, "common_subplan", recursive_query);
+            assertEquals(rows.get(0).get(0), 5000L);
+            assertEquals(rows.get(0).get(2), 3);
+            assertFalse(explainPlan(stmt, recursive_query).contains("__subplan"));
+
+            // user-written materialized CTEs keep all of their columns
+            String user_cte_query = "WITH c AS MATERIALIZED (SELECT a.i, a.j, b.k FROM a JOIN b USING (i)) "
+                                    + "SELECT count(*), sum(c1.j) FROM c c1 JOIN c c2 ON c1.k = c2.k";
+            rows = assertOptimizerPreservesResult(stmt, "common_subplan", user_cte_query);
+            assertEquals(rows.get(0).get(0), 5000L);
+        }
+    }
+
+    // whether the table is scanned on the build (right) side of the first hash join in a rendered EXPLAIN plan
+    private static boolean hashJoinBuildSideScans(String plan, String table) throws Exception {
+        int node_width = 29;
+        int join_column = -1;
+        for (String line : plan.split("\n")) {
+            int join_offset = line.indexOf("HASH_JOIN");
+            if (join_column < 0 && join_offset >= 0) {
+                join_column = join_offset / node_width;
+            }
+            int table_offset = line.indexOf("Table: " + table + " ");
+            if (join_column >= 0 && table_offset >= 0) {
+                return table_offset / node_width > join_column;
+            }
+        }
+        fail("table " + table + " not found below a hash join");
+        return false;
+    }
+
+    public static void test_cardinality_feedback() throws Exception {
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement()) {
+            stmt.execute("SET cardinality_feedback_threshold = 2");
+            stmt.execute("CREATE TABLE big AS SELECT range AS k, range AS v FROM range(100000)");
+            stmt.execute("CREATE TABLE small AS SELECT range AS k FROM range(30000)");
+
+            // the filter on "big" is estimated to be selective, but it does not remove any rows
+            String query = "SELECT count(*) FROM big JOIN small USING (k) WHERE big.v::VARCHAR <> 'x'";
+            assertTrue(hashJoinBuildSideScans(explainPlan(stmt, query), "big"));
+            try (PreparedStatement ps = conn.prepareStatement(query)) {
+                try (ResultSet rs = ps.executeQuery()) {
+                    assertTrue(rs.next());
+                    assertEquals(rs.getLong(1), 30000L);
+                }
+                // the observed build side cardinality is used when re-planning - the build side flips
+                assertFalse(hashJoinBuildSideScans(explainPlan(stmt, query), "big"));
+                // the prepared statement was planned with the old estimates, it is re-planned on its next execution
+                try (ResultSet rs = ps.executeQuery()) {
+                    assertTrue(rs.next());
+                    assertEquals(rs.getLong(1), 30000L);
+                }
+            }
+
+            // the feedback no longer applies once the table changes
+            stmt.execute("INSERT INTO big VALUES (-1, -1)");
+            assertTrue(hashJoinBuildSideScans(explainPlan(stmt, query), "big"));
+        }
+    }
+
+    private static String explainAnalyzePlan(Statement stmt, String sql) throws SQLException {
+        try (ResultSet rs = stmt.executeQuery("EXPLAIN ANALYZE " + sql)) {
+            StringBuilder result = new StringBuilder();
+            while (rs.next()) {
+                result.append(rs.getString(2));
+            }
+            return result.toString();
+        }
+    }
+
+    // the number of rows emitted by the operator whose box in a rendered EXPLAIN ANALYZE plan contains the given text
+    private static long renderedOperatorRows(String plan, String text) throws Exception {
+        int node_width = 29;
+        int column = -1;
+        for (String line : plan.split("\n")) {
+            if (column < 0) {
+                int offset = line.indexOf(text);
+                if (offset >= 0) {
+                    column = offset / node_width;
+                }
+                continue;
+            }
+            if (line.length() < (column + 1) * node_width) {
+                continue;
+            }
+            String box = line.substring(column * node_width, (column + 1) * node_width).trim();
+            if (box.matches("│\\s*\\d+ Rows\\s*│")) {
+                return Long.parseLong(box.replaceAll("[^0-9]", ""));
+            }
+        }
+        fail("no operator with \"" + text + "\" found");
+        return -1;
+    }
+
+    public static void test_join_filter_pushdown_semi_anti() throws Exception {
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement()) {
+            stmt.execute("CREATE TABLE outer_t AS SELECT CASE WHEN range % 10 = 0 THEN NULL ELSE range * 1000 END AS k "
+                         + "FROM range(100)");
+            stmt.execute("CREATE TABLE inner_t AS SELECT range AS k FROM range(200000)");
+            // a single constant value: the scan of this table produces constant vectors
+            stmt.execute("CREATE TABLE constant_t AS SELECT 42000 AS k FROM range(200000)");
+
+            // the semi/anti joins are flipped, so that the small outer table is the build side
+            String exists_query =
+                "SELECT count(*) FROM outer_t WHERE EXISTS (SELECT 1 FROM inner_t WHERE inner_t.k = outer_t.k)";
+            assertTrue(explainPlan(stmt, exists_query).contains("RIGHT_SEMI"));
+            List<List<Object>> rows =
+                assertOptimizerPreservesResult(stmt, "build_side_probe_side,join_filter_pushdown", exists_query);
+            assertEquals(rows.get(0).get(0), 90L);
+
+            String not_exists_query = "SELECT count(*) FROM outer_t WHERE NOT EXISTS "
+                                      + "(SELECT 1 FROM inner_t WHERE inner_t.k = outer_t.k)";
+            assertTrue(explainPlan(stmt, not_exists_query).contains("RIGHT_ANTI"));
+            rows = assertOptimizerPreservesResult(stmt, "build_side_probe_side,join_filter_pushdown", not_exists_query);
+            // rows with a NULL key have no match
+            assertEquals(rows.get(0).get(0), 10L);
+
+            String in_query = "SELECT count(*), count(k) FROM outer_t WHERE k IN (SELECT k FROM inner_t)";
+            rows = assertOptimizerPreservesResult(stmt, "build_side_probe_side,join_filter_pushdown", in_query);
+            assertEquals(rows.get(0), Arrays.asList(90L, 90L));
+
+            String constant_query = "SELECT count(*) FROM outer_t WHERE EXISTS "
+                                    + "(SELECT 1 FROM constant_t WHERE constant_t.k = outer_t.k)";
+            rows = assertOptimizerPreservesResult(stmt, "build_side_probe_side,join_filter_pushdown", constant_query);
+            assertEquals(rows.get(0).get(0), 1L);
+            String constant_anti_query = "SELECT count(*) FROM outer_t WHERE NOT EXISTS "
+                                         + "(SELECT 1 FROM constant_t WHERE constant_t.k = outer_t.k)";
+            rows =
+                assertOptimizerPreservesResult(stmt, "build_side_probe_side,join_filter_pushdown", constant_anti_query);
+            assertEquals(rows.get(0).get(0), 99L);
+        }
+    }
+
+    public static void test_join_bloom_filter() throws Exception {
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement()) {
+            // the decision to disable the filter depends on the order in which the vectors are probed
+            stmt.execute("SET threads = 1");
+            stmt.execute("CREATE TABLE probe AS SELECT range AS k FROM range(200000)");
+            // the keys span the entire range of the probe side, so the min/max filter cannot prune anything
+            stmt.execute("CREATE TABLE sparse AS SELECT range * 200 AS k FROM range(1000)");
+            stmt.execute("CREATE TABLE dense AS SELECT range AS k FROM range(200000) WHERE range % 20 <> 0");
+
+            // the bloom filter is applied in the scan of the probe side
+            String selective_query = "SELECT count(*) FROM probe JOIN sparse USING (k)";
+            assertEquals(queryLong(stmt, selective_query), 1000L);
+            String plan = explainAnalyzePlan(stmt, selective_query);
+            assertTrue(plan.contains("Bloom Filter (k)"));
+            assertTrue(renderedOperatorRows(plan, "Bloom Filter (k)") < 50000L);
+
+            // the bloom filter lets through 95% of the tuples - it disables itself after the first vectors
+            String unselective_query = "SELECT count(*) FROM probe JOIN dense USING (k)";
+            assertEquals(queryLong(stmt, unselective_query), 190000L);
+            plan = explainAnalyzePlan(stmt, unselective_query);
+            assertTrue(plan.contains("Bloom Filter (k)"));
+            assertTrue(renderedOperatorRows(plan, "Bloom Filter (k)") > 195000L);
+        }
+    }
+
+    private static int countOccurrences(String text, String pattern) {
+        int count = 0;
+        for (int offset = text.indexOf(pattern); offset >= 0; offset = text.indexOf(pattern, offset + 1)) {
+            count++;
+        }
+        return count;
+    }
+
+    public static void test_aggregate_pushdown() throws Exception {
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement()) {
+            stmt.execute("CREATE TABLE facts AS SELECT range % 100 AS key, range % 7 AS key2, range % 5 AS category, "
+                         + "range::INTEGER AS i, (range / 100)::DECIMAL(18, 2) AS d, NULL::INTEGER AS n "
+                         + "FROM range(100000)");
+            // every key appears twice on the dimension side
+            stmt.execute("CREATE TABLE dims AS SELECT range % 100 AS key, range // 100 AS dup, range % 3 AS level, "
+                         + "'name' || (range % 10) AS name FROM range(200)");
+            stmt.execute("CREATE TABLE dims2 AS SELECT range AS key2, 'group' || (range % 2) AS name2 FROM range(7)");
+
+            String[] queries = new String[] {
+                // COUNT(*) with duplicate join keys
+                "SELECT dims.name, count(*) FROM facts JOIN dims USING (key) GROUP BY ALL ORDER BY ALL",
+                // SUM of INTEGER and DECIMAL
+                "SELECT dims.name, sum(facts.i), sum(facts.d), min(facts.d), max(facts.i) FROM facts "
+                    + "JOIN dims USING (key) GROUP BY ALL ORDER BY ALL",
+                // all-NULL inputs
+                "SELECT dims.name, sum(facts.n), count(facts.n), min(facts.n) FROM facts JOIN dims USING (key) "
+                    + "GROUP BY ALL ORDER BY ALL",
+                // group columns from both sides of the join
+                "SELECT dims.name, facts.category, count(*), sum(facts.i) FROM facts JOIN dims USING (key) "
+                    + "GROUP BY ALL ORDER BY ALL",
+                // a non-equality join condition
+                "SELECT dims.name, count(*), sum(facts.d) FROM facts JOIN dims "
+                    + "ON facts.key = dims.key AND facts.category <= dims.level GROUP BY ALL ORDER BY ALL",
+            };
+            for (String query : queries) {
+                assertTrue(countOccurrences(explainPlan(stmt, query), "HASH_GROUP_BY") >= 2);
+                assertOptimizerPreservesResult(stmt, "aggregate_pushdown", query);
+            }
+
+            // a chain of joins - the partial aggregate is pushed down again through the next join
+            String chain_query = "SELECT dims2.name2, count(*), sum(facts.i), sum(facts.d) FROM facts "
+                                 + "JOIN dims USING (key) JOIN dims2 USING (key2) GROUP BY ALL ORDER BY ALL";
+            assertTrue(countOccurrences(explainPlan(stmt, chain_query), "HASH_GROUP_BY") >= 3);
+            List<List<Object>> rows = assertOptimizerPreservesResult(stmt, "aggregate_pushdown", chain_query);
+            assertEquals(rows.size(), 2);
+            assertEquals(((Number) rows.get(0).get(1)).longValue() + ((Number) rows.get(1).get(1)).longValue(),
+                         200000L);
+        }
+    }
+
+    public static void test_wide_query_planning() throws Exception {
+        int column_count = 1500;
+        StringBuilder columns = new StringBuilder();
+        StringBuilder sums = new StringBuilder();
+        for (int i = 0; i < column_count; i++) {
+            columns.append(", range + ").append(i).append(" AS c").append(i);
+            sums.append(i == 0 ? "" : ", ").append("sum(c").append(i).append(") AS s").append(i);
+        }
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement()) {
+            stmt.execute("CREATE TABLE wide AS SELECT range AS i" + columns + " FROM range(100)");
+            stmt.execute("CREATE TABLE keys AS SELECT range AS i FROM range(50)");
+
+            // the aggregate resolves its inputs against the thousands of columns produced by the join
+            String aggregate_query = "SELECT " + sums + " FROM wide JOIN keys USING (i)";
+            List<List<Object>> rows = queryRows(stmt, aggregate_query);
+            assertEquals(rows.size(), 1);
+            assertEquals(rows.get(0).size(), column_count);
+            for (int i = 0; i < column_count; i += 499) {
+                assertEquals(((Number) rows.get(0).get(i)).longValue(), 1225L + 50L * i);
+            }
+
+            // sharing the wide subplan replaces the bindings of every column of both branches
+            String grouped_query = "SELECT i % 5 AS g, " + sums + " FROM wide JOIN keys USING (i) GROUP BY g";
+            String union_query = grouped_query + " UNION ALL " + grouped_query + " ORDER BY g, s0";
+            rows = assertOptimizerPreservesResult(stmt, "common_subplan", union_query);
+            assertEquals(rows.size(), 10);
+            assertEquals(rows.get(0), rows.get(1));
+            assertTrue(explainPlan(stmt, union_query).contains("__subplan"));
+            assertOptimizerPreservesResult(stmt, "compressed_materialization,column_lifetime", union_query);
+
+            // the number of plan nodes created by every phase is reported by the profiler
+            Path profile_file = Files.createTempFile("duckdb-wide-query-profile-", ".json");
+            try {
+                stmt.execute("SET enable_profiling = 'json'");
+                stmt.execute("SET profiling_output = '" + profile_file + "'");
+                stmt.execute("SET custom_profiling_settings = '{\"PHASE_PLAN_NODES\": \"true\"}'");
+                queryRows(stmt, union_query);
+                stmt.execute("PRAGMA disable_profiling");
+                long optimizer_plan_nodes = queryLong(
+                    stmt, "SELECT phase_plan_nodes['all_optimizers'] FROM read_json('" + profile_file + "')");
+                long subplan_plan_nodes = queryLong(
+                    stmt, "SELECT phase_plan_nodes['optimizer_common_subplan'] FROM read_json('" + profile_file +
+                              "')");
+                assertTrue(optimizer_plan_nodes > 0);
+                assertTrue(subplan_plan_nodes <= optimizer_plan_nodes);
+            } finally {
+                Files.deleteIfExists(profile_file);
+            }
+        }
+    }
+
+    public static void test_hive_partitioned_join_aggregate() throws Exception {
+        Path dir = Files.createTempDirectory("duckdb-hive-partitioned-");
+        String facts_dir = dir.resolve("facts").toString();
+        String dims_dir = dir.resolve("dims").toString();
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement()) {
+            stmt.execute("CREATE TABLE facts AS SELECT range % 8 AS p, range % 100 AS key, range AS v "
+                         + "FROM range(50000)");
+            stmt.execute("CREATE TABLE dims AS SELECT range % 8 AS p, range % 100 AS key, "
+                         + "'name' || (range % 13) AS name FROM range(300) WHERE range % 8 <> 3");
+            stmt.execute("COPY facts TO '" + facts_dir + "' (FORMAT parquet, PARTITION_BY (p))");
+            stmt.execute("COPY dims TO '" + dims_dir + "' (FORMAT parquet, PARTITION_BY (p))");
+            String facts_scan = "read_parquet('" + facts_dir + "/*/*.parquet', hive_partitioning = true)";
+            String dims_scan = "read_parquet('" + dims_dir + "/*/*.parquet', hive_partitioning = true)";
+
+            // a join on the partition key (and another key) is executed partition by partition
+            String join_query = "SELECT f.p, d.name, count(*), sum(f.v) FROM %s f JOIN %s d "
+                                + "ON f.p = d.p AND f.key = d.key GROUP BY ALL ORDER BY ALL";
+            String partitioned_join = String.format(join_query, facts_scan, dims_scan);
+            assertTrue(explainPlan(stmt, partitioned_join).contains("Partitioned By"));
+            List<List<Object>> rows = queryRows(stmt, partitioned_join);
+            assertEquals(rows, queryRows(stmt, String.format(join_query, "facts", "dims")));
+            assertFalse(rows.isEmpty());
+            for (List<Object> row : rows) {
+                // the partition without dimension rows does not produce any output
+                assertTrue(((Number) row.get(0)).longValue() != 3L);
+            }
+            // if the partitions do not fit in memory, the join falls back to the spilling hash join
+            stmt.execute("SET debug_force_external = true");
+            assertEquals(queryRows(stmt, partitioned_join), rows);
+            stmt.execute("RESET debug_force_external");
+
+            // grouping by the partition key and another column aggregates every partition separately
+            String aggregate_query = "SELECT p, key % 10 AS k, count(*), sum(v), min(v), max(v) FROM %s "
+                                     + "GROUP BY ALL ORDER BY ALL";
+            String partitioned_aggregate = String.format(aggregate_query, facts_scan);
+            assertTrue(explainPlan(stmt, partitioned_aggregate).contains("PARTITIONED_AGGREGATE"));
+            rows = queryRows(stmt, partitioned_aggregate);
+            assertEquals(rows, queryRows(stmt, String.format(aggregate_query, "facts")));
+            // key % 10 only takes even values in the even partitions and odd values in the odd ones
+            assertEquals(rows.size(), 40);
+
+            // the aggregate over the partitioned join result
+            String total_query = "SELECT count(*), sum(f.v) FROM %s f JOIN %s d ON f.p = d.p AND f.key = d.key";
+            assertEquals(queryRows(stmt, String.format(total_query, facts_scan, dims_scan)),
+                         queryRows(stmt, String.format(total_query, "facts", "dims")));
+        } finally {
+            deleteRecursively(dir);
+        }
+    }
+
+    private static void deleteRecursively(Path path) throws Exception {
+        if (Files.isDirectory(path)) {
+            try (java.util.stream.Stream<Path> children = Files.list(path)) {
+                for (Path child : (Iterable<Path>) children::iterator) {
+                    deleteRecursively(child);
+                }
+            }
+        }
+        Files.deleteIfExists(path);
+    }
+
+    public static void test_external_sort_multiway_merge() throws Exception {
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement()) {
+            // many small sorted runs that have to be merged (partly) out of memory
+            stmt.execute("SET threads = 4");
+            stmt.execute("SET memory_limit = '100MB'");
+            stmt.execute("CREATE TABLE t AS SELECT (range * 7919) % 1000003 AS k, 'str' || (range % 997) AS s, "
+                         + "repeat('x', ((range * 7919) % 1000003 % 50)::INTEGER) AS payload FROM range(1000000)");
+
+            // fixed-size sort key
+            try (ResultSet rs = stmt.executeQuery("SELECT k, payload FROM t ORDER BY k DESC")) {
+                long count = 0;
+                long previous = Long.MAX_VALUE;
+                while (rs.next()) {
+                    long k = rs.getLong(1);
+                    assertTrue(k <= previous);
+                    previous = k;
+                    count++;
+                }
+                assertEquals(count, 1000000L);
+            }
+
+            // variable-size sort key with ties, broken by a second key
+            try (ResultSet rs = stmt.executeQuery("SELECT s, k, payload FROM t ORDER BY s, k")) {
+                long count = 0;
+                String previous_s = null;
+                long previous_k = -1;
+                while (rs.next()) {
+                    String s = rs.getString(1);
+                    long k = rs.getLong(2);
+                    if (previous_s != null) {
+                        int comp = s.compareTo(previous_s);
+                        assertTrue(comp > 0 || (comp == 0 && k > previous_k));
+                    }
+                    assertEquals(rs.getString(3).length(), (int) (k % 50));
+                    previous_s = s;
+                    previous_k = k;
+                    count++;
+                }
+                assertEquals(count, 1000000L);
+            }
+        }
+    }
+
+    public static void test_order_by_shared_prefix_strings() throws Exception {
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement()) {
+            // URL-like strings with a long common prefix, that are only distinguished after the radix prefix
+            stmt.execute("CREATE TABLE urls AS SELECT 'https://example.com/path/to/' || (range % 1000)::VARCHAR || "
+                         + "CASE WHEN range % 3 = 0 THEN '' ELSE '/page' || (range % 7)::VARCHAR END AS url, "
+                         + "range AS id FROM range(20000)");
+
+            for (String order : new String[] {"ASC", "DESC"}) {
+                try (ResultSet rs = stmt.executeQuery("SELECT url, id FROM urls ORDER BY url " + order + ", id")) {
+                    String previous_url = null;
+                    long previous_id = -1;
+                    long count = 0;
+                    while (rs.next()) {
+                        String url = rs.getString(1);
+                        long id = rs.getLong(2);
+                        if (previous_url != null) {
+                            int comp = order.equals("ASC") ? url.compareTo(previous_url) : previous_url.compareTo(url);
+                            assertTrue(comp > 0 || (comp == 0 && id > previous_id));
+                        }
+                        previous_url = url;
+                        previous_id = id;
+                        count++;
+                    }
+                    assertEquals(count, 20000L);
+                }
+            }
+        }
+    }
+
+    public static void test_top_n_dynamic_filter_pushdown() throws Exception {
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement()) {
+            stmt.execute("CREATE TABLE events AS SELECT range AS id, (range * 0.37)::DOUBLE AS score, "
+                         + "TIMESTAMP '2024-01-01' + to_minutes(range) AS ts, "
+                         + "CASE WHEN range % 1000 = 7 THEN NULL ELSE range % 5000 END AS bucket FROM range(500000)");
+
+            String[] queries = new String[] {
+                // floating point keys
+                "SELECT id, score FROM events ORDER BY score DESC LIMIT 5",
+                // a monotonic function of a column
+                "SELECT id, ts FROM events ORDER BY date_trunc('day', ts) DESC, id LIMIT 5",
+                "SELECT id, ts FROM events ORDER BY time_bucket(INTERVAL '1 day', ts, TIMESTAMP '2024-01-01 06:00:00'), "
+                    + "id LIMIT 5",
+                "SELECT id, score FROM events ORDER BY round(score, 1) DESC, id LIMIT 5",
+                "SELECT id FROM events ORDER BY -id LIMIT 5",
+                "SELECT id FROM events ORDER BY 100 - id DESC LIMIT 5",
+                // NULLS FIRST
+                "SELECT id, bucket FROM events ORDER BY bucket NULLS FIRST, id LIMIT 10",
+                "SELECT id, bucket FROM events ORDER BY bucket DESC NULLS FIRST, id LIMIT 10",
+                // multiple ORDER BY keys - the filter is on the leading key
+                "SELECT id, bucket FROM events ORDER BY bucket DESC, id DESC LIMIT 5",
+            };
+            for (String query : queries) {
+                assertTrue(explainPlan(stmt, query).contains("Dynamic Filter"));
+                assertOptimizerPreservesResult(stmt, "top_n", query);
+            }
+            // the functions are not monotonic in their other arguments
+            String[] non_monotonic = new String[] {
+                "SELECT id FROM events WHERE id < 8 ORDER BY round(-12.345::DOUBLE, id::INTEGER), id LIMIT 3",
+                "SELECT id FROM events ORDER BY time_bucket(INTERVAL '1 day', TIMESTAMP '2024-06-01', ts) DESC, id "
+                    + "LIMIT 5",
+            };
+            for (String query : non_monotonic) {
+                assertFalse(explainPlan(stmt, query).contains("Dynamic Filter"));
+                assertOptimizerPreservesResult(stmt, "top_n", query);
+            }
+
+            List<List<Object>> rows = queryRows(stmt, "SELECT id FROM events ORDER BY -id LIMIT 3");
+            assertEquals(((Number) rows.get(0).get(0)).longValue(), 499999L);
+            assertEquals(((Number) rows.get(2).get(0)).longValue(), 499997L);
+            rows = queryRows(stmt, "SELECT id FROM events ORDER BY bucket NULLS FIRST, id LIMIT 3");
+            assertEquals(((Number) rows.get(0).get(0)).longValue(), 7L);
+            assertEquals(((Number) rows.get(2).get(0)).longValue(), 2007L);
+        }
+    }
+
+    public static void test_top_n_dynamic_filter_stale_statistics() throws Exception {
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement()) {
+            stmt.execute("CREATE TABLE ids AS SELECT range AS id FROM range(10000, 14096)");
+            // the column range of the prepared plan does not cover the rows that are inserted afterwards
+            try (PreparedStatement ps = conn.prepareStatement("SELECT id FROM ids ORDER BY -id LIMIT 4196")) {
+                stmt.execute("INSERT INTO ids SELECT range FROM range(100, 2148)");
+                stmt.execute("INSERT INTO ids SELECT range FROM range(2100, 2148)");
+                List<Long> prepared = new ArrayList<>();
+                try (ResultSet rs = ps.executeQuery()) {
+                    while (rs.next()) {
+                        prepared.add(rs.getLong(1));
+                    }
+                }
+                List<Long> expected = new ArrayList<>();
+                try (ResultSet rs = stmt.executeQuery("SELECT id FROM ids ORDER BY -id LIMIT 4196")) {
+                    while (rs.next()) {
+                        expected.add(rs.getLong(1));
+                    }
+                }
+                assertEquals(prepared, expected);
+                assertEquals(prepared.get(prepared.size() - 1), 2098L);
+            }
+        }
+    }
+
+    public static void test_order_by_sorted_row_groups() throws Exception {
+        Path database_file = Files.createTempFile("duckdb-sorted-row-groups-", ".duckdb");
+        Files.deleteIfExists(database_file);
+        String query = "SELECT ts, v FROM db.events ORDER BY ts, v";
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement()) {
+            stmt.execute("SET threads=4");
+            stmt.execute("ATTACH '" + database_file + "' AS db (STORAGE_VERSION 'v1.3.0')");
+            // appended in timestamp order - every row group is sorted on ts
+            stmt.execute("CREATE TABLE db.events AS SELECT TIMESTAMP '2024-01-01' + to_seconds(range) AS ts, "
+                         + "range % 97 AS v FROM range(1000000)");
+            stmt.execute("CREATE TABLE db.shuffled AS SELECT * FROM db.events ORDER BY v, ts DESC");
+            assertTrue(explainPlan(stmt, query).contains("Sorted Runs"));
+            assertFalse(explainPlan(stmt, "SELECT ts, v FROM db.shuffled ORDER BY ts").contains("Sorted Runs"));
+            assertFalse(explainPlan(stmt, "SELECT ts, v FROM db.events ORDER BY ts DESC").contains("Sorted Runs"));
+
+            // the sorted runs are merged into the correct order
+            try (ResultSet rs = stmt.executeQuery(query)) {
+                long count = 0;
+                Timestamp prev = null;
+                while (rs.next()) {
+                    Timestamp ts = rs.getTimestamp(1);
+                    assertTrue(prev == null || !ts.before(prev));
+                    prev = ts;
+                    count++;
+                }
+                assertEquals(count, 1000000L);
+            }
+
+            // the sorted flags are persisted in the checkpoint
+            stmt.execute("CHECKPOINT db");
+            stmt.execute("DETACH db");
+            stmt.execute("ATTACH '" + database_file + "' AS db");
+            assertTrue(explainPlan(stmt, query).contains("Sorted Runs"));
+            // a row group with earlier timestamps than all others
+            stmt.execute("INSERT INTO db.events SELECT TIMESTAMP '2023-01-01' + to_seconds(range), 1 FROM range(1000)");
+            assertEquals(queryLong(stmt, "SELECT count(*) FROM (SELECT ts, lag(ts) OVER () AS prev FROM "
+                                             + "(SELECT ts FROM db.events ORDER BY ts)) WHERE prev > ts"),
+                         0L);
+
+            // an update can make a row group unsorted
+            stmt.execute("UPDATE db.events SET ts = TIMESTAMP '2020-01-01' WHERE v = 3");
+            assertFalse(explainPlan(stmt, query).contains("Sorted Runs"));
+            stmt.execute("DETACH db");
+        } finally {
+            Files.deleteIfExists(database_file);
+            Files.deleteIfExists(database_file.resolveSibling(database_file.getFileName() + ".wal"));
+        }
+    }
+
+    public static void test_window_nested_partitions() throws Exception {
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement()) {
+            stmt.execute("CREATE TABLE w AS SELECT range % 10 AS a, range % 7 AS b, range AS t, "
+                         + "(range * 37) % 101 AS x FROM range(100000)");
+            // the partition-wide aggregates share the sort of the finer partitioning
+            String query = "SELECT a, b, t, sum(x) OVER (PARTITION BY a), count(*) OVER (PARTITION BY a), "
+                           + "row_number() OVER (PARTITION BY a, b ORDER BY t), "
+                           + "sum(x) OVER (PARTITION BY b, a ORDER BY t ROWS 3 PRECEDING), "
+                           + "sum(x) OVER (PARTITION BY a, b ORDER BY t ROWS BETWEEN 10 PRECEDING AND 10 FOLLOWING) "
+                           + "FROM w ORDER BY ALL";
+            assertEquals(countOccurrences(explainPlan(stmt, query), "WINDOW"), 1);
+            List<List<Object>> rows = queryRows(stmt, query);
+            assertEquals(rows.size(), 100000);
+
+            stmt.execute("PRAGMA disable_optimizer");
+            assertEquals(countOccurrences(explainPlan(stmt, query), "WINDOW"), 2);
+            assertEquals(queryRows(stmt, query), rows);
+            stmt.execute("PRAGMA enable_optimizer");
+
+            // ordered functions over the coarser partitioning still need their own sort
+            String ordered = "SELECT rank() OVER (PARTITION BY a ORDER BY x), "
+                             + "row_number() OVER (PARTITION BY a, b ORDER BY t) FROM w";
+            assertEquals(countOccurrences(explainPlan(stmt, ordered), "WINDOW"), 2);
+
+            // the moments share the segment tree of their common state but finalize it differently
+            String frame = " OVER (PARTITION BY a ORDER BY t ROWS BETWEEN 5 PRECEDING AND 5 FOLLOWING)";
+            String[] moments = new String[] {"var_samp(x)", "var_pop(x)", "stddev_samp(x)", "stddev_pop(x)"};
+            StringBuilder shared = new StringBuilder("SELECT t");
+            for (String moment : moments) {
+                shared.append(", ").append(moment).append(frame);
+            }
+            rows = queryRows(stmt, shared.append(" FROM w ORDER BY t").toString());
+            for (int i = 0; i < moments.length; i++) {
+                List<List<Object>> single = queryRows(stmt, "SELECT " + moments[i] + frame + " FROM w ORDER BY t");
+                for (int r = 0; r < rows.size(); r += 997) {
+                    assertEquals(rows.get(r).get(i + 1), single.get(r).get(0));
+                }
+            }
+        }
+    }
+
+    public static void test_streaming_window_sorted_input() throws Exception {
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement()) {
+            stmt.execute("CREATE TABLE series AS SELECT range % 5 AS id, range AS t, (range * 7) % 13 AS v "
+                         + "FROM range(20000)");
+            String[] queries = new String[] {
+                // moving aggregates, running totals and row numbers per partition
+                "SELECT id, t, avg(v) OVER (PARTITION BY id ORDER BY t ROWS BETWEEN 10 PRECEDING AND CURRENT ROW), "
+                    + "count(*) OVER (PARTITION BY id ORDER BY t ROWS 3 PRECEDING), "
+                    + "sum(v) OVER (PARTITION BY id ORDER BY t ROWS UNBOUNDED PRECEDING), "
+                    + "row_number() OVER (PARTITION BY id ORDER BY t) FROM (SELECT * FROM series ORDER BY id, t)",
+                // frames that span several chunks and end before the current row
+                "SELECT t, sum(v) OVER (ORDER BY t ROWS BETWEEN 1500 PRECEDING AND 3 PRECEDING), "
+                    + "max(v) FILTER (WHERE v > 6) OVER (ORDER BY t ROWS 100 PRECEDING) "
+                    + "FROM (SELECT * FROM series ORDER BY t)",
+            };
+            for (String query : queries) {
+                String plan = explainPlan(stmt, query);
+                assertTrue(plan.contains("STREAMING_WINDOW"));
+                assertEquals(countOccurrences(plan, "WINDOW"), countOccurrences(plan, "STREAMING_WINDOW"));
+
+                List<List<Object>> rows = queryRows(stmt, query + " ORDER BY ALL");
+                assertEquals(rows.size(), 20000);
+                stmt.execute("PRAGMA disable_optimizer");
+                assertEquals(queryRows(stmt, query + " ORDER BY ALL"), rows);
+                stmt.execute("PRAGMA enable_optimizer");
+            }
+
+            // the input is not known to be sorted
+            String unsorted = "SELECT avg(v) OVER (PARTITION BY id ORDER BY t ROWS 10 PRECEDING) FROM series";
+            assertFalse(explainPlan(stmt, unsorted).contains("STREAMING_WINDOW"));
+        }
+    }
+
+    public static void test_fused_expressions() throws Exception {
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement()) {
+            stmt.execute("CREATE TABLE nums AS SELECT range::INTEGER AS a, (range % 17)::INTEGER AS b, "
+                         + "CASE WHEN range % 11 = 0 THEN NULL ELSE (range % 5)::INTEGER END AS c, "
+                         + "(range * 3)::INTEGER AS d, range::DOUBLE / 7 AS x, (range % 13)::DOUBLE AS y "
+                         + "FROM range(10000)");
+            String[] queries = new String[] {
+                // arithmetic chains with NULLs, constants on either side and non-commutative operations
+                "SELECT a * b + c, 100 - (a * b) - c, (a + 1) * 2 - d, x * y + x - 2.5 FROM nums",
+                // fused comparisons in projections and filters
+                "SELECT a * b + c > d, x * y <= x + y FROM nums",
+                "SELECT a FROM nums WHERE a * b + c > d AND b < 10",
+                "SELECT a FROM nums WHERE x * y - 1 >= x + y OR c * 3 = b",
+            };
+            // the fused kernels are opt-in
+            assertEquals(queryRows(stmt, "SELECT current_setting('enable_fused_expressions')").get(0).get(0), false);
+            for (String query : queries) {
+                List<List<Object>> rows = queryRows(stmt, query + " ORDER BY ALL");
+                stmt.execute("SET enable_fused_expressions = true");
+                assertEquals(queryRows(stmt, query + " ORDER BY ALL"), rows);
+                stmt.execute("RESET enable_fused_expressions");
+            }
+
+            // overflow errors are raised just like in the interpreted path
+            String overflow = "SELECT a * a * a + b FROM nums";
+            for (String setting : new String[] {"true", "false"}) {
+                stmt.execute("SET enable_fused_expressions = " + setting);
+                assertThrows(() -> { stmt.executeQuery(overflow).close(); }, SQLException.class);
+            }
+        }
+    }
+
+    public static void test_adaptive_filter_ordering() throws Exception {
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement()) {
+            stmt.execute("CREATE TABLE preds AS SELECT range AS i, range % 7 AS a, range % 11 AS b, "
+                         + "md5(range::VARCHAR) AS s FROM range(500000)");
+            // many predicates with very different costs and selectivities, both as scan filters and as expressions
+            StringBuilder and = new StringBuilder();
+            StringBuilder or = new StringBuilder();
+            StringBuilder expected = new StringBuilder();
+            for (int k = 0; k < 12; k++) {
+                String predicate = k % 3 == 0   ? "s NOT LIKE '%" + Integer.toHexString(k) + "a%'"
+                                   : k % 3 == 1 ? "(a + " + k + ") % 7 <> 0"
+                                                : "i % " + (k + 2) + " <> 1";
+                and.append(k == 0 ? "" : " AND ").append(predicate);
+                or.append(k == 0 ? "" : " OR ").append("NOT (").append(predicate).append(")");
+                expected.append(k == 0 ? "" : " * ").append("(").append(predicate).append(")::INT");
+            }
+            Object expected_count = queryRows(stmt, "SELECT sum(" + expected + ") FROM preds").get(0).get(0);
+            Object and_count = queryRows(stmt, "SELECT count(*) FROM preds WHERE " + and).get(0).get(0);
+            Object or_count = queryRows(stmt, "SELECT count(*) FROM preds WHERE " + or).get(0).get(0);
+            assertEquals(((Number) and_count).longValue(), ((Number) expected_count).longValue());
+            assertEquals(((Number) or_count).longValue(), 500000 - ((Number) expected_count).longValue());
+
+            // range filters on several columns are pushed into the scan as a table filter set
+            assertEquals(queryRows(stmt, "SELECT count(*) FROM preds WHERE i > 1000 AND a < 3 AND b >= 5 AND "
+                                             + "s > 'c' AND i < 400000")
+                             .get(0)
+                             .get(0),
+                         queryRows(stmt, "SELECT count(*) FILTER (i > 1000 AND a < 3 AND b >= 5 AND s > 'c' AND "
+                                             + "i < 400000) FROM preds")
+                             .get(0)
+                             .get(0));
+        }
+    }
+
+    public static void test_dictionary_expression_execution() throws Exception {
+        Path dir = Files.createTempDirectory("duckdb-dictionary-");
+        String parquet_file = dir.resolve("dict.parquet").toString();
+        String database_file = dir.resolve("dict.duckdb").toString();
+        try (Connection conn = DriverManager.getConnection(JDBC_URL + database_file);
+             Statement stmt = conn.createStatement()) {
+            stmt.execute("CREATE TABLE plain AS SELECT range AS i, CASE WHEN range % 1000 = 999 THEN 'x' "
+                         + "WHEN range % 97 = 0 THEN NULL ELSE (range % 50)::VARCHAR END AS s FROM range(100000)");
+            stmt.execute("COPY plain TO '" + parquet_file + "' (FORMAT parquet)");
+            // force dictionary compressed storage for the table filter path
+            stmt.execute("PRAGMA force_compression='dictionary'");
+            stmt.execute("CREATE TABLE dict AS SELECT * FROM plain");
+            stmt.execute("CHECKPOINT");
+            stmt.execute("PRAGMA force_compression='auto'");
+
+            String[] queries = new String[] {
+                // functions and comparisons of a dictionary column with constants
+                "SELECT i, concat(s, '-suffix'), s LIKE '%1%', s = '7', s > '3', "
+                    + "s IS NOT DISTINCT FROM '4' FROM tbl",
+                "SELECT i FROM tbl WHERE s LIKE '%2' OR s = 'x'",
+                "SELECT i, length(s) FROM tbl WHERE s >= '25' AND s < '4'",
+                // the cast fails for 'x', which is in the dictionary but filtered out
+                "SELECT i, s::INTEGER + 1 FROM tbl WHERE s <> 'x'",
+            };
+            for (String query : queries) {
+                List<List<Object>> expected = queryRows(stmt, query.replace("tbl", "plain") + " ORDER BY ALL");
+                assertFalse(expected.isEmpty());
+                assertEquals(queryRows(stmt, query.replace("tbl", "dict") + " ORDER BY ALL"), expected);
+                String parquet_scan = "read_parquet('" + parquet_file + "')";
+                assertEquals(queryRows(stmt, query.replace("tbl", parquet_scan) + " ORDER BY ALL"), expected);
+            }
+            // the cast still fails when 'x' is referenced
+            assertThrows(() -> {
+                stmt.executeQuery("SELECT sum(s::INTEGER) FROM read_parquet('" + parquet_file + "')").close();
+            }, SQLException.class);
+        } finally {
+            deleteRecursively(dir);
+        }
+    }
+
+    public static void test_string_search_kernels() throws Exception {
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement()) {
+            stmt.execute("CREATE TABLE strs AS SELECT range AS i, CASE WHEN range % 101 = 0 THEN NULL ELSE "
+                         + "repeat(chr((97 + range % 3)::INTEGER), (range % 40)::INTEGER) || md5(range::VARCHAR) || "
+                         + "CASE WHEN range % 7 = 0 THEN 'needle_in_haystack' ELSE '' END END AS s FROM range(20000)");
+            // compare the search kernels against the naive search of replace()
+            String[] needles =
+                new String[] {"f", "ab", "needle", "aaaaaaaaa", "needle_in_haystack", "bbbbbbbbbbbbbbbbbbbb", "ccccz"};
+            for (String needle : needles) {
+                String query = "SELECT count(*) FILTER (WHERE contains(s, '" + needle + "')), count(*) FILTER "
+                               + "(WHERE length(replace(s, '" + needle + "', '')) < length(s)) FROM strs";
+                List<List<Object>> rows = queryRows(stmt, query);
+                assertEquals(rows.get(0).get(0), rows.get(0).get(1));
+            }
+
+            // disjunctions of substring searches on the same string are combined into a single search
+            String disjunction = "SELECT i FROM strs WHERE s LIKE '%needle_in%' OR contains(s, 'bbbbbbbbbbbbbbb') "
+                                 + "OR s LIKE '%ff%' OR s LIKE '%a' OR i < 10 OR s LIKE '%0%' ORDER BY i";
+            assertTrue(explainPlan(stmt, disjunction).contains("__internal_contains_any"));
+            List<List<Object>> rows = assertOptimizerPreservesResult(stmt, "expression_rewriter", disjunction);
+            assertFalse(rows.isEmpty());
+
+            // NULL strings and NULL search strings keep their semantics
+            String nulls = "SELECT i, contains(s, 'f') OR contains(s, 'abc') OR contains(s, NULL) FROM strs ORDER BY i";
+            assertOptimizerPreservesResult(stmt, "expression_rewriter", nulls);
+        }
+    }
+
+    private static List<Object> nearestNeighbors(Statement stmt, String sql) throws SQLException {
+        List<Object> ids = new ArrayList<>();
+        for (List<Object> row : queryRows(stmt, sql)) {
+            ids.add(row.get(0));
+        }
+        return ids;
+    }
+
+    public static void test_hnsw_index() throws Exception {
+        Path dir = Files.createTempDirectory("duckdb-hnsw-");
+        String db_url = JDBC_URL + dir.resolve("vectors.db").toString();
+        String create = "CREATE TABLE items AS SELECT range AS id, [(hash(range, 1) % 1000)::FLOAT / 1000, "
+                        + "(hash(range, 2) % 1000)::FLOAT / 1000, (hash(range, 3) % 1000)::FLOAT / 1000, "
+                        + "(hash(range, 4) % 1000)::FLOAT / 1000]::FLOAT[4] AS vec FROM range(5000)";
+        String query_vector = "[0.25, 0.5, 0.75, 0.5]::FLOAT[4]";
+        String knn = "SELECT id FROM items ORDER BY array_distance(vec, " + query_vector + ") LIMIT 10";
+        try {
+            List<Object> expected;
+            try (Connection conn = DriverManager.getConnection(db_url); Statement stmt = conn.createStatement()) {
+                stmt.execute(create);
+                expected = nearestNeighbors(stmt, knn.replace(") LIMIT", "), id LIMIT"));
+                stmt.execute("CREATE INDEX items_vec ON items USING HNSW (vec) WITH (metric = 'l2sq', m = 8)");
+
+                // ORDER BY distance LIMIT k fetches the candidates from the index and re-ranks them exactly
+                assertTrue(explainPlan(stmt, knn).contains("HNSW Index Scan"));
+                assertEquals(nearestNeighbors(stmt, knn), expected);
+                // the index does not apply to other metrics, filters, or multiple orders
+                assertFalse(explainPlan(stmt, knn.replace("array_distance", "array_cosine_distance"))
+                                .contains("HNSW Index Scan"));
+                assertFalse(explainPlan(stmt, knn.replace("FROM items", "FROM items WHERE id > 100"))
+                                .contains("HNSW Index Scan"));
+                assertFalse(explainPlan(stmt, knn.replace(") LIMIT", "), id LIMIT")).contains("HNSW Index Scan"));
+
+                // deleted rows are no longer returned, inserted rows are
+                stmt.execute("DELETE FROM items WHERE id = " + expected.get(0));
+                List<Object> after_delete = nearestNeighbors(stmt, knn);
+                assertFalse(after_delete.contains(expected.get(0)));
+                stmt.execute("INSERT INTO items VALUES (100000, [0.25, 0.5, 0.75, 0.5])");
+                assertEquals(nearestNeighbors(stmt, knn).get(0), 100000L);
+
+                // rows deleted by the open transaction are still in the index, but the scan still returns k rows
+                String exact_knn = knn.replace(") LIMIT", "), id LIMIT");
+                conn.setAutoCommit(false);
+                stmt.execute("DELETE FROM items WHERE id IN (" + exact_knn.replace("LIMIT 10", "LIMIT 20") + ")");
+                List<Object> in_transaction = nearestNeighbors(stmt, knn);
+                assertEquals(in_transaction.size(), 10);
+                assertEquals(in_transaction, nearestNeighbors(stmt, exact_knn));
+                conn.rollback();
+                conn.setAutoCommit(true);
+
+                // NULL vectors are not indexed, but still fill the LIMIT
+                stmt.execute("CREATE TABLE sparse AS SELECT range AS id, "
+                             + "CASE WHEN range < 3 THEN [range, 0, 0, 0] END::FLOAT[4] AS vec FROM range(8)");
+                stmt.execute("CREATE INDEX sparse_vec ON sparse USING HNSW (vec)");
+                String sparse_knn = "SELECT id FROM sparse ORDER BY array_distance(vec, " + query_vector + ") LIMIT 5";
+                assertTrue(explainPlan(stmt, sparse_knn).contains("HNSW Index Scan"));
+                assertEquals(nearestNeighbors(stmt, sparse_knn).size(), 5);
+                stmt.execute("CHECKPOINT");
+            }
+
+            // the graph is persisted with the database
+            try (Connection conn = DriverManager.getConnection(db_url); Statement stmt = conn.createStatement()) {
+                assertTrue(explainPlan(stmt, knn).contains("HNSW Index Scan"));
+                List<Object> result = nearestNeighbors(stmt, knn);
+                assertEquals(result.get(0), 100000L);
+                stmt.execute("SET disabled_optimizers = 'hnsw_index_scan'");
+                assertEquals(result, nearestNeighbors(stmt, knn));
+                stmt.execute("RESET disabled_optimizers");
+
+                // invalid options and columns
+                assertThrows(() -> stmt.execute("CREATE INDEX bad ON items USING HNSW (vec) WITH (metric = 'l1')"),
+                             SQLException.class);
+                assertThrows(() -> stmt.execute("CREATE INDEX bad ON items USING HNSW (vec) WITH (m = 1)"),
+                             SQLException.class);
+                assertThrows(() -> stmt.execute("CREATE INDEX bad ON items USING HNSW (id)"), SQLException.class);
+            }
+        } finally {
+            deleteRecursively(dir);
+        }
+    }
+
+    public static void test_array_distance_kernels() throws Exception {
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement()) {
+            // 19 elements: the kernels handle full blocks of lanes and a remainder
+            stmt.execute("CREATE TABLE vecs AS SELECT range AS id, list_transform(range(19), x -> "
+                         + "(hash(range, x) % 100)::FLOAT / 10 - 5)::FLOAT[19] AS a FROM range(3000)");
+            stmt.execute("INSERT INTO vecs VALUES (3000, NULL)");
+            String query = "list_transform(range(19), x -> x::FLOAT / 4)::FLOAT[19]";
+
+            // compare against the element-wise computation, for a constant and for a non-constant argument
+            for (String rhs : new String[] {query, "list_reverse(a::FLOAT[])::FLOAT[19]"}) {
+                String sql = "SELECT count(*) FROM (SELECT id, array_distance(a, b) AS d, array_inner_product(a, b) AS "
+                             + "ip, array_cosine_distance(a, b) AS cd, list_distance(a::FLOAT[], b::FLOAT[]) AS ld, "
+                             + "sqrt(sum((a[i] - b[i]) ^ 2)) AS rd, sum(a[i] * b[i]) AS rip, 1 - sum(a[i] * b[i]) / "
+                             + "sqrt(sum(a[i] ^ 2) * sum(b[i] ^ 2)) AS rcd FROM (SELECT id, a, " + rhs + " AS b FROM "
+                             + "vecs), range(1, 20) r(i) WHERE a IS NOT NULL GROUP BY ALL) WHERE abs(d - rd) > 1e-3 "
+                             + "OR abs(ip - rip) > 1e-2 OR abs(cd - rcd) > 1e-5 OR abs(ld - rd) > 1e-3";
+                assertEquals(queryRows(stmt, sql).get(0).get(0), 0L);
+            }
+
+            // NULL arrays produce NULL, NULL elements are an error
+            assertEquals(queryRows(stmt, "SELECT count(array_distance(a, " + query + ")) FROM vecs").get(0).get(0),
+                         3000L);
+            assertThrows(() -> stmt.execute("SELECT array_distance([1, NULL, 3]::FLOAT[3], [1, 2, 3]::FLOAT[3])"),
+                         SQLException.class);
+        }
+    }
+
+    public static void test_approximate_holistic_aggregates() throws Exception {
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement()) {
+            stmt.execute("CREATE TABLE skewed AS SELECT range % 10 AS g, (range * 7919 % 100000) / 10 AS v, "
+                         + "CASE WHEN range % 3 = 0 THEN 42 ELSE range END AS m, "
+                         + "CASE WHEN range % 5 = 0 THEN 'frequent' ELSE (range % 20)::VARCHAR END AS s, "
+                         + "DATE '2000-01-01' + (range % 400)::INT AS d FROM range(200000)");
+            String sql = "SELECT g, median(v), quantile_cont(v, 0.9), quantile_disc(v, 0.1), "
+                         + "quantile_cont(v, [0.25, 0.75])[2], mode(m), mode(s), median(d) FROM skewed GROUP BY g "
+                         + "ORDER BY g";
+            List<List<Object>> exact = queryRows(stmt, sql);
+
+            stmt.execute("SET approximate_holistic_aggregates = true");
+            List<List<Object>> approximate = queryRows(stmt, sql);
+            assertEquals(approximate.size(), exact.size());
+            for (int i = 0; i < exact.size(); i++) {
+                for (int col = 1; col <= 4; col++) {
+                    double expected = ((Number) exact.get(i).get(col)).doubleValue();
+                    double actual = ((Number) approximate.get(i).get(col)).doubleValue();
+                    assertTrue(Math.abs(actual - expected) <= 0.01 * Math.abs(expected));
+                }
+                // the frequent value is kept, and DATE quantiles stay exact
+                assertEquals(approximate.get(i).get(5), exact.get(i).get(5));
+                assertEquals(approximate.get(i).get(6), exact.get(i).get(6));
+                assertEquals(approximate.get(i).get(7), exact.get(i).get(7));
+            }
+
+            // windowed aggregates merge the sketches of the segment tree
+            String window = "SELECT count(*) FROM (SELECT median(v) OVER w AS med, mode(m) OVER w AS mo FROM skewed "
+                            + "WINDOW w AS (ORDER BY v ROWS BETWEEN 500 PRECEDING AND 500 FOLLOWING)) WHERE med IS NULL "
+                            + "OR mo IS NULL";
+            assertEquals(queryRows(stmt, window).get(0).get(0), 0L);
+            double median = (Double) queryRows(stmt, "SELECT median(x) FROM range(1, 1001) t(x)").get(0).get(0);
+            assertTrue(Math.abs(median - 500.5) <= 5);
+            assertEquals(queryRows(stmt, "SELECT mode(x) FROM (SELECT NULL::INT AS x)").get(0).get(0), null);
+
+            // all-distinct input ties every count when the summary is pruned: the earliest values are kept
+            assertEquals(queryRows(stmt, "SELECT mode(x) FROM range(2049) t(x)").get(0).get(0), 0L);
+            assertNotNull(queryRows(stmt, "SELECT mode(x) FROM range(100000) t(x)").get(0).get(0));
+            assertNotNull(queryRows(stmt, "SELECT mode(x::VARCHAR) FROM range(10000) t(x)").get(0).get(0));
+            // every value occurs equally often
+            long tied = (Long) queryRows(stmt, "SELECT mode(x % 5000) FROM range(50000) t(x)").get(0).get(0);
+            assertTrue(tied >= 0 && tied < 5000);
+        }
+    }
+
+    public static void test_holistic_aggregate_spilling() throws Exception {
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement()) {
+            stmt.execute("CREATE TABLE wide AS SELECT range % 200000 AS g, range AS v, "
+                         + "'value_' || range::VARCHAR AS s FROM range(2000000)");
+            String sql = "SELECT count(*), sum(l), sum(sl), sum(med), sum(q), sum(qs), sum(h), sum(hs) FROM (SELECT g, "
+                         + "list_sum(list(v)) AS l, length(string_agg(s, ',')) AS sl, median(v) AS med, "
+                         + "quantile_disc(v, 0.75) AS q, length(quantile_disc(s, 0.5)) AS qs, "
+                         + "list_sum(map_values(histogram(v % 7))) AS h, cardinality(histogram(s)) AS hs "
+                         + "FROM wide GROUP BY g)";
+            List<List<Object>> expected = queryRows(stmt, sql);
+
+            // force the aggregation out-of-core so that the holistic states are spilled
+            stmt.execute("SET threads = 2");
+            stmt.execute("SET memory_limit = '300MB'");
+            List<List<Object>> spilled = queryRows(stmt, sql);
+            assertEquals(spilled, expected);
+            assertEquals(expected.get(0).get(0), 200000L);
+            assertTrue(explainAnalyzePlan(stmt, sql).contains("Spilled States"));
+
+            // windowed string_agg keeps its buffers outside of the (spillable) aggregate arena
+            assertEquals(queryLong(stmt, "SELECT max(length(string_agg(s, ',') OVER (ORDER BY v ROWS BETWEEN 9 "
+                                             + "PRECEDING AND CURRENT ROW))) FROM wide WHERE v < 100000"),
+                         10L * "value_99999".length() + 9L);
+        }
+    }
+
+    public static void test_hll_sketches() throws Exception {
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement()) {
+            stmt.execute("CREATE TABLE visits AS SELECT range % 30 AS day, (range * 7919) % 50000 AS user_id "
+                         + "FROM range(300000)");
+            stmt.execute("CREATE TABLE daily AS SELECT day, hll_state(user_id) AS sketch FROM visits GROUP BY day");
+
+            // rolling up the persisted sketches matches a scan of the raw data
+            Object total = queryRows(stmt, "SELECT approx_count_distinct(user_id) FROM visits").get(0).get(0);
+            assertEquals(queryRows(stmt, "SELECT hll_count(sketch) FROM daily").get(0).get(0), total);
+            String rollup = "SELECT hll_count(sketch) FROM (SELECT hll_merge(sketch) AS sketch FROM daily "
+                            + "GROUP BY day // 7)";
+            assertEquals(queryRows(stmt, rollup).get(0).get(0), total);
+            List<List<Object>> weekly = queryRows(stmt, "SELECT day // 7 AS week, hll_count(sketch) FROM daily "
+                                                            + "GROUP BY week ORDER BY week");
+            List<List<Object>> expected = queryRows(stmt, "SELECT day // 7 AS week, approx_count_distinct(user_id) "
+                                                              + "FROM visits GROUP BY week ORDER BY week");
+            assertEquals(weekly, expected);
+
+            assertEquals(queryRows(stmt, "SELECT hll_count(NULL::BLOB)").get(0).get(0), 0L);
+            String message =
+                assertThrows(() -> stmt.executeQuery("SELECT hll_count('\\x01'::BLOB)"), SQLException.class);
+            assertTrue(message.contains("Invalid HyperLogLog sketch"));
+
+            // register values out of range are rejected instead of being used as counter indexes
+            StringBuilder corrupted = new StringBuilder("'\\x02\\xFF");
+            for (int i = 1; i < 64; i++) {
+                corrupted.append("\\x00");
+            }
+            corrupted.append("'::BLOB");
+            String sketch = corrupted.toString();
+            message = assertThrows(() -> stmt.executeQuery("SELECT hll_count(" + sketch + ")"), SQLException.class);
+            assertTrue(message.contains("Invalid HyperLogLog sketch"));
+            message = assertThrows(() -> stmt.executeQuery("SELECT hll_merge(s) FROM (SELECT " + sketch + " AS s)"),
+                                   SQLException.class);
+            assertTrue(message.contains("Invalid HyperLogLog sketch"));
+        }
+    }
+
+    public static void test_regexp_pattern_cache_and_prefilter() throws Exception {
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement()) {
+            stmt.execute("CREATE TABLE logs AS SELECT CASE range % 4 WHEN 0 THEN 'ERROR: connection timeout' "
+                         + "WHEN 1 THEN 'warning: disk 9' WHEN 2 THEN 'Info: Ünïcode timeout' ELSE 'ok' END || "
+                         + "range::VARCHAR AS line FROM range(10000)");
+            stmt.execute("CREATE TABLE rules AS SELECT * FROM (VALUES ('error.*timeout'), ('(?i)error.*timeout'), "
+                         + "('disk [0-9]+'), ('ünïcode|nothing'), ('(?i)ÜNÏCODE')) t(pattern)");
+
+            // per-row patterns go through the pattern cache
+            String join = "SELECT pattern, count(*) FILTER (WHERE regexp_matches(line, pattern)), "
+                          + "count(*) FILTER (WHERE regexp_full_match(line, '.*' || pattern || '.*')), "
+                          + "count(*) FILTER (WHERE regexp_replace(line, pattern, '') <> line), "
+                          + "count(*) FILTER (WHERE regexp_extract(line, pattern) <> ''), "
+                          + "count(*) FILTER (WHERE len(regexp_extract_all(line, pattern)) > 0) FROM logs, rules "
+                          + "GROUP BY pattern ORDER BY pattern";
+            List<List<Object>> rows = queryRows(stmt, join);
+            assertEquals(rows.size(), 5);
+            long[] expected = {2500L, 2500L, 2500L, 0L, 0L};
+            for (int i = 0; i < rows.size(); i++) {
+                for (int col = 1; col <= 5; col++) {
+                    assertEquals(rows.get(i).get(col), expected[i]);
+                }
+            }
+
+            // constant patterns are prefiltered on their required literals
+            assertEquals(queryRows(stmt, "SELECT count(*) FROM logs WHERE regexp_matches(line, 'connection.*out')")
+                             .get(0)
+                             .get(0),
+                         2500L);
+            assertEquals(queryRows(stmt, "SELECT count(*) FROM logs WHERE regexp_matches(line, 'CONNECTION', 'i')")
+                             .get(0)
+                             .get(0),
+                         2500L);
+            assertEquals(queryRows(stmt, "SELECT count(*) FROM logs WHERE regexp_matches(line, 'Ünïcode time')")
+                             .get(0)
+                             .get(0),
+                         2500L);
+
+            assertEquals(queryString(stmt, "SELECT regexp_extract_all('a1b22c333', '[0-9]+')::VARCHAR"),
+                         "[1, 22, 333]");
+            assertEquals(queryString(stmt, "SELECT regexp_split_to_array('a1b22c', '[0-9]+')::VARCHAR"),
+                         "[a, b, c]");
+
+            String message = assertThrows(
+                () -> stmt.executeQuery("SELECT regexp_matches(line, pattern) FROM logs, (SELECT '(' AS pattern)"),
+                SQLException.class);
+            assertTrue(message.contains("missing )"));
+        }
+    }
+
+    public static void test_icu_offset_cache() throws Exception {
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement()) {
+            stmt.execute("SET TimeZone = 'America/New_York'");
+
+            // around the spring forward transition
+            assertEquals(queryString(stmt, "SELECT date_part('hour', TIMESTAMPTZ '2021-03-14 06:59:59+00')"), "1");
+            assertEquals(queryString(stmt, "SELECT date_part('hour', TIMESTAMPTZ '2021-03-14 07:00:00+00')"), "3");
+            assertEquals(queryString(stmt, "SELECT date_part('timezone_hour', TIMESTAMPTZ '2021-07-15 12:00:00+00')"),
+                         "-4");
+            // outside of the cached years
+            assertEquals(queryString(stmt, "SELECT date_part('hour', TIMESTAMPTZ '2150-07-01 16:00:00+00')"), "12");
+
+            assertEquals(queryString(stmt, "SELECT date_trunc('day', TIMESTAMPTZ '2021-03-14 12:00:00-04')::VARCHAR"),
+                         "2021-03-14 00:00:00-05");
+            assertEquals(queryString(stmt, "SELECT date_trunc('month', TIMESTAMPTZ '2021-07-15 12:00:00-04')::VARCHAR"),
+                         "2021-07-01 00:00:00-04");
+            assertEquals(
+                queryString(stmt, "SELECT date_trunc('minute', TIMESTAMPTZ '2021-07-15 12:34:56-04')::VARCHAR"),
+                "2021-07-15 12:34:00-04");
+
+            assertEquals(queryString(stmt, "SELECT time_bucket(INTERVAL '1 day', TIMESTAMPTZ '2021-07-15 12:00:00-04', "
+                                               + "'America/New_York')::VARCHAR"),
+                         "2021-07-15 00:00:00-04");
+            assertEquals(
+                queryString(stmt,
+                            "SELECT time_bucket(INTERVAL '1 month', TIMESTAMPTZ '2021-07-15 12:00:00-04')::VARCHAR"),
+                "2021-06-30 20:00:00-04");
+
+            assertEquals(queryString(stmt, "SELECT TIMESTAMP '2021-07-15 12:00:00'::TIMESTAMPTZ::VARCHAR"),
+                         "2021-07-15 12:00:00-04");
+            assertEquals(queryString(stmt, "SELECT TIMESTAMPTZ '2021-07-15 16:00:00+00'::TIMESTAMP::VARCHAR"),
+                         "2021-07-15 12:00:00");
+
+            // only the repeated hour in the fall does not round trip
+            stmt.execute("CREATE TABLE hours AS SELECT * FROM range(TIMESTAMPTZ '2021-01-01 00:00:00+00', "
+                         + "TIMESTAMPTZ '2022-01-01 00:00:00+00', INTERVAL '1 hour') t(ts)");
+            assertEquals(queryString(stmt, "SELECT count(*) FROM hours WHERE ts::TIMESTAMP::TIMESTAMPTZ <> ts"), "1");
+            assertEquals(queryString(stmt, "SELECT count(*) FROM hours WHERE date_part('hour', ts) <> "
+                                               + "hour(ts::TIMESTAMP) OR date_part('day', ts) <> day(ts::TIMESTAMP)"),
+                         "0");
+            stmt.execute("SET TimeZone = 'UTC'");
+        }
+    }
+
+    public static void test_lambda_batch_execution() throws Exception {
+        try (Connection conn = DriverManager.getConnection(JDBC_URL); Statement stmt = conn.createStatement()) {
+            stmt.execute("CREATE TABLE lists AS SELECT range AS id, CASE WHEN range % 7 = 0 THEN NULL "
+                         + "ELSE range(range % 5 + 1) END AS l FROM range(10000)");
+
+            // the lambdas reference the index and another column, and lists of many rows share a chunk
+            assertEquals(queryString(stmt, "SELECT sum(list_sum(list_transform(l, (x, i) -> x * i + id))) FROM lists"),
+                         queryString(stmt, "SELECT sum((len(l) - 1) * len(l) * (len(l) + 1) // 3 + len(l) * id) "
+                                               + "FROM lists"));
+            assertEquals(queryString(stmt, "SELECT sum(len(list_filter(l, x -> x % 2 = id % 2))) FROM lists"),
+                         queryString(stmt, "SELECT sum(CASE WHEN id % 2 = 0 THEN (len(l) + 1) // 2 ELSE len(l) // 2 "
+                                               + "END) FROM lists"));
+            assertEquals(queryString(stmt, "SELECT sum(list_reduce(l, (a, b) -> a + b + id % 3)) FROM lists"),
+                         queryString(stmt, "SELECT sum(list_sum(l) + (len(l) - 1) * (id % 3)) FROM lists"));
+            assertEquals(queryString(stmt, "SELECT count(*) FROM lists WHERE list_reduce(l, (a, b) -> a + b) IS NULL"),
+                         "1429");
+
+            // filtered rows do not reference contiguous list entries
+            assertEquals(queryString(stmt, "SELECT sum(list_sum(list_transform(l, x -> x + 1))) FROM lists "
+                                               + "WHERE id % 3 = 0"),
+                         queryString(stmt, "SELECT sum(list_sum(l) + len(l)) FROM lists WHERE id % 3 = 0"));
+
+            assertEquals(queryString(stmt, "SELECT list_reduce(['a', 'b', 'c'], (x, y, i) -> x || y || i)"), "ab2c3");
+        }
+    }
+
     public static void main(String[] args) throws Exception {
         System.exit(runTests(args, TestDuckDBJDBC.class, TestExtensionTypes.class));
     }